@@ -0,0 +1,624 @@
+#ifndef DZCHESS_ANALYSIS_SERVER_HPP_INCLUDED
+#define DZCHESS_ANALYSIS_SERVER_HPP_INCLUDED
+
+#include <algorithm>          // for std::clamp, std::max
+#include <chrono>             // for std::chrono::steady_clock
+#include <cerrno>             // for errno, EINTR, ECONNABORTED
+#include <condition_variable> // for std::condition_variable
+#include <cstddef>            // for std::size_t
+#include <cstdint>            // for std::uint64_t
+#include <cstdio>             // for std::snprintf
+#include <cstring>            // for std::strncpy
+#include <deque>              // for std::deque
+#include <map>                // for std::map
+#include <memory>             // for std::shared_ptr, std::unique_ptr
+#include <mutex>              // for std::mutex, std::lock_guard
+#include <sstream>            // for std::ostringstream
+#include <string>             // for std::string, std::to_string
+#include <string_view>        // for std::string_view
+#include <thread>             // for std::thread, std::this_thread
+#include <utility>            // for std::move
+#include <vector>             // for std::vector
+
+#include <sys/socket.h>       // for socket, bind, accept, send, shutdown
+#include <sys/un.h>           // for sockaddr_un
+#include <unistd.h>           // for close, unlink
+
+#include "ChessPiece.hpp"
+#include "ChessBoard.hpp"
+#include "MoveList.hpp"
+#include "Evaluation.hpp"
+#include "EvaluationCache.hpp"
+#include "TranspositionTable.hpp"
+#include "Search.hpp"
+#include "Tablebase.hpp"
+#include "NNUE.hpp"
+#include "Fen.hpp"
+#include "UCI.hpp"
+#include "ParseNumber.hpp"
+
+namespace DZChess {
+
+
+// Requests to the analysis server are flat JSON objects whose values are
+// strings, numbers, booleans or null, so only that subset is parsed.
+// String values are unescaped; other values are kept as written, which is
+// safe because they are validated first and may be echoed into replies.
+struct JsonValue {
+    std::string text;
+    bool is_string;
+};
+
+
+// Whether text is a JSON number, true, false or null.
+constexpr bool is_json_literal(std::string_view text) noexcept {
+    if ((text == "true") || (text == "false") || (text == "null")) {
+        return true;
+    }
+    std::size_t i = 0;
+    const auto digits = [&] {
+        const std::size_t start = i;
+        while ((i < text.size()) && ('0' <= text[i]) && (text[i] <= '9')) {
+            ++i;
+        }
+        return i - start;
+    };
+    if ((i < text.size()) && (text[i] == '-')) { ++i; }
+    const std::size_t start = i;
+    const std::size_t integer = digits();
+    if ((integer == 0) || ((integer > 1) && (text[start] == '0'))) {
+        return false;
+    }
+    if ((i < text.size()) && (text[i] == '.')) {
+        ++i;
+        if (digits() == 0) { return false; }
+    }
+    if ((i < text.size()) && ((text[i] == 'e') || (text[i] == 'E'))) {
+        ++i;
+        if ((i < text.size()) && ((text[i] == '+') || (text[i] == '-'))) {
+            ++i;
+        }
+        if (digits() == 0) { return false; }
+    }
+    return i == text.size();
+}
+
+
+// Parses one object, which must be all of text apart from whitespace.
+inline bool parse_json_object(std::string_view text,
+                              std::map<std::string, JsonValue> &fields) {
+    std::size_t i = 0;
+    const auto skip_space = [&] {
+        while ((i < text.size()) && ((text[i] == ' ') || (text[i] == '\t') ||
+                                     (text[i] == '\r') || (text[i] == '\n'))) {
+            ++i;
+        }
+    };
+    const auto read_string = [&](std::string &out) {
+        if ((i >= text.size()) || (text[i] != '"')) { return false; }
+        for (++i; i < text.size(); ++i) {
+            if (text[i] == '"') {
+                ++i;
+                return true;
+            }
+            if (text[i] == '\\') {
+                if (++i >= text.size()) { return false; }
+                switch (text[i]) {
+                    case 'n': out += '\n'; break;
+                    case 't': out += '\t'; break;
+                    case 'r': out += '\r'; break;
+                    case 'b': out += '\b'; break;
+                    case 'f': out += '\f'; break;
+                    case 'u': return false; // not needed by any request
+                    default: out += text[i]; break;
+                }
+            } else {
+                out += text[i];
+            }
+        }
+        return false;
+    };
+    skip_space();
+    if ((i >= text.size()) || (text[i] != '{')) { return false; }
+    ++i;
+    const auto at_end = [&] {
+        ++i;
+        skip_space();
+        return i == text.size();
+    };
+    skip_space();
+    if ((i < text.size()) && (text[i] == '}')) { return at_end(); }
+    while (true) {
+        std::string key;
+        JsonValue value{};
+        skip_space();
+        if (!read_string(key)) { return false; }
+        skip_space();
+        if ((i >= text.size()) || (text[i] != ':')) { return false; }
+        ++i;
+        skip_space();
+        value.is_string = (i < text.size()) && (text[i] == '"');
+        if (value.is_string) {
+            if (!read_string(value.text)) { return false; }
+        } else {
+            const std::size_t start = i;
+            while ((i < text.size()) && (text[i] != ',') &&
+                   (text[i] != '}') && (text[i] != ' ')) {
+                ++i;
+            }
+            value.text = std::string{text.substr(start, i - start)};
+            if (!is_json_literal(value.text)) { return false; }
+        }
+        fields[key] = value;
+        skip_space();
+        if (i >= text.size()) { return false; }
+        if (text[i] == '}') { return at_end(); }
+        if (text[i] != ',') { return false; }
+        ++i;
+    }
+}
+
+
+inline std::string json_string(std::string_view text) {
+    std::string result{"\""};
+    for (const char c : text) {
+        switch (c) {
+            case '"': result += "\\\""; break;
+            case '\\': result += "\\\\"; break;
+            case '\n': result += "\\n"; break;
+            case '\r': result += "\\r"; break;
+            case '\t': result += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char escape[8];
+                    std::snprintf(escape, sizeof(escape), "\\u%04x", c);
+                    result += escape;
+                } else {
+                    result += c;
+                }
+        }
+    }
+    return result + '"';
+}
+
+
+// Analysis service on a Unix domain socket. Clients send one JSON request
+// per line, such as
+//     {"id": 7, "fen": "<FEN>", "depth": 12, "multipv": 3}
+// and receive, per request, "info" lines for each line of each completed
+// iteration and a final "result" line, all tagged with the request id.
+// Limits may also be given as "movetime" in milliseconds and "nodes". The
+// request {"type": "metrics"} returns server counters instead.
+//
+// Each connection has a thread that reads its requests into a bounded
+// queue; requests arriving when it is full are rejected at once rather
+// than delaying everyone. A fixed set of workers, each with a searcher
+// allocated at startup, serve the queue and share one transposition
+// table and evaluation cache, which stay warm across requests, and any
+// tablebases loaded before the server starts.
+class AnalysisServer {
+
+    using Clock = std::chrono::steady_clock;
+
+    struct Connection {
+
+        const int fd;
+        std::mutex write_mutex;
+
+        explicit Connection(int fd) : fd(fd), write_mutex() {}
+
+        Connection(const Connection &) = delete;
+        Connection &operator=(const Connection &) = delete;
+
+        ~Connection() { ::close(fd); }
+
+        // Lines from different workers may interleave, but never within
+        // a line. Write errors mean the client has gone and are ignored.
+        void send_line(const std::string &line) {
+            std::lock_guard<std::mutex> lock{write_mutex};
+            const std::string data = line + '\n';
+            std::size_t sent = 0;
+            while (sent < data.size()) {
+                const ssize_t n = ::send(fd, data.data() + sent,
+                                         data.size() - sent, MSG_NOSIGNAL);
+                if (n <= 0) { return; }
+                sent += static_cast<std::size_t>(n);
+            }
+        }
+
+    }; // struct Connection
+
+    static constexpr int DEFAULT_DEPTH = 8;
+
+    // Longest request line buffered while waiting for its newline. A
+    // client that sends more is disconnected.
+    static constexpr std::size_t MAX_LINE_LENGTH = 64 * 1024;
+
+    static constexpr int ACCEPT_BACKOFF_MS = 100;
+
+    struct Request {
+        std::shared_ptr<Connection> connection;
+        std::string id; // JSON text of the id, echoed in every response
+        ChessBoard board{};
+        PositionState state{};
+        int depth = DEFAULT_DEPTH;
+        long long movetime = 0;
+        std::uint64_t nodes = 0;
+        int multipv = 1;
+        Clock::time_point received{};
+        std::size_t queue_depth = 0; // requests ahead of this one on arrival
+    };
+
+    struct Metrics {
+        std::uint64_t completed = 0;
+        std::uint64_t rejected = 0;
+        std::uint64_t invalid = 0;
+        std::uint64_t nodes = 0;
+        double total_latency_ms = 0.0;
+        double max_latency_ms = 0.0;
+        double total_queue_ms = 0.0;
+        std::size_t max_queue_depth = 0;
+    };
+
+    // Worker state allocated once, so requests pay only for searching.
+    struct Worker {
+        Searcher<PositionalEvaluationVisitor> positional;
+        Searcher<NNUEEvaluationVisitor> nnue;
+    };
+
+    const std::string path;
+    const std::size_t queue_capacity;
+    TranspositionTable table;
+    EvaluationCache cache;
+    Tablebases tablebases;
+
+    std::mutex queue_mutex;
+    std::condition_variable queue_signal;
+    std::deque<Request> queue;
+    std::size_t active;
+
+    std::mutex metrics_mutex;
+    Metrics metrics;
+
+    std::vector<std::unique_ptr<Worker>> worker_state;
+    std::vector<std::thread> workers;
+
+    static double milliseconds(Clock::duration duration) noexcept {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    }
+
+    std::string metrics_json() {
+        std::size_t depth = 0;
+        std::size_t busy = 0;
+        {
+            std::lock_guard<std::mutex> lock{queue_mutex};
+            depth = queue.size();
+            busy = active;
+        }
+        std::lock_guard<std::mutex> lock{metrics_mutex};
+        const double completed =
+            static_cast<double>(std::max(metrics.completed, std::uint64_t{1}));
+        std::ostringstream out{};
+        out << "{\"type\": \"metrics\", \"completed\": " << metrics.completed
+            << ", \"rejected\": " << metrics.rejected
+            << ", \"invalid\": " << metrics.invalid
+            << ", \"queue_depth\": " << depth
+            << ", \"max_queue_depth\": " << metrics.max_queue_depth
+            << ", \"busy_workers\": " << busy
+            << ", \"workers\": " << workers.size()
+            << ", \"mean_latency_ms\": " << metrics.total_latency_ms / completed
+            << ", \"max_latency_ms\": " << metrics.max_latency_ms
+            << ", \"mean_queue_ms\": " << metrics.total_queue_ms / completed
+            << ", \"nodes\": " << metrics.nodes
+            << ", \"hashfull\": " << table.permille_full() << "}";
+        return out.str();
+    }
+
+    void reply_error(Connection &connection, const std::string &id,
+                     const std::string &message) {
+        connection.send_line("{\"id\": " + id + ", \"type\": \"error\", "
+                             "\"message\": " + json_string(message) + "}");
+    }
+
+    // Parses and queues one request line, or answers it directly.
+    void accept_request(const std::shared_ptr<Connection> &connection,
+                        const std::string &line) {
+        const Clock::time_point received = Clock::now();
+        std::map<std::string, JsonValue> fields{};
+        if (!parse_json_object(line, fields)) {
+            {
+                std::lock_guard<std::mutex> lock{metrics_mutex};
+                ++metrics.invalid;
+            }
+            reply_error(*connection, "null", "malformed JSON");
+            return;
+        }
+        const auto field = [&fields](const std::string &key) {
+            const auto it = fields.find(key);
+            return (it == fields.end()) ? std::string{} : it->second.text;
+        };
+        if (field("type") == "metrics") {
+            connection->send_line(metrics_json());
+            return;
+        }
+
+        Request request{};
+        request.connection = connection;
+        const auto id = fields.find("id");
+        request.id = (id == fields.end()) ? std::string{"null"}
+            : id->second.is_string ? json_string(id->second.text)
+            : id->second.text;
+        request.received = received;
+        const std::string fen = field("fen");
+        if (!parse_fen((fen.empty() || (fen == "startpos"))
+                           ? STARTING_FEN : std::string_view{fen},
+                       request.board, request.state)) {
+            {
+                std::lock_guard<std::mutex> lock{metrics_mutex};
+                ++metrics.invalid;
+            }
+            reply_error(*connection, request.id, "invalid FEN");
+            return;
+        }
+        // Limits are optional, but must be whole numbers when present. A
+        // time or node limit raises the depth limit, so it must be positive
+        // or the search would run unbounded.
+        const auto read_limit = [&](const std::string &key, auto &value) {
+            return !fields.count(key) || parse_number(field(key), value);
+        };
+        int depth = DEFAULT_DEPTH;
+        int multipv = 1;
+        if (!read_limit("depth", depth) ||
+            !read_limit("movetime", request.movetime) ||
+            !read_limit("nodes", request.nodes) ||
+            !read_limit("multipv", multipv) ||
+            (fields.count("movetime") && (request.movetime <= 0)) ||
+            (fields.count("nodes") && (request.nodes == 0))) {
+            {
+                std::lock_guard<std::mutex> lock{metrics_mutex};
+                ++metrics.invalid;
+            }
+            reply_error(*connection, request.id, "invalid limit");
+            return;
+        }
+        const bool timed = fields.count("movetime") || fields.count("nodes");
+        request.depth = fields.count("depth")
+            ? std::clamp(depth, 1, MAX_PLY - 1)
+            : (timed ? MAX_PLY - 1 : DEFAULT_DEPTH);
+        request.multipv = std::clamp(multipv, 1, 256);
+
+        bool queued = false;
+        {
+            std::lock_guard<std::mutex> lock{queue_mutex};
+            request.queue_depth = queue.size();
+            if (queue.size() < queue_capacity) {
+                queue.push_back(std::move(request));
+                queued = true;
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock{metrics_mutex};
+            if (queued) {
+                metrics.max_queue_depth = std::max(
+                    metrics.max_queue_depth, request.queue_depth + 1);
+            } else {
+                ++metrics.rejected;
+            }
+        }
+        if (queued) {
+            queue_signal.notify_one();
+        } else {
+            reply_error(*connection, request.id, "queue full");
+        }
+    }
+
+    void read_connection(std::shared_ptr<Connection> connection) {
+        std::string pending;
+        char buffer[4096];
+        while (true) {
+            const ssize_t n = ::recv(connection->fd, buffer, sizeof(buffer), 0);
+            if (n <= 0) { return; }
+            pending.append(buffer, static_cast<std::size_t>(n));
+            std::size_t start = 0;
+            std::size_t end = 0;
+            while ((end = pending.find('\n', start)) != std::string::npos) {
+                const std::string line = pending.substr(start, end - start);
+                if (line.find_first_not_of(" \t\r") != std::string::npos) {
+                    accept_request(connection, line);
+                }
+                start = end + 1;
+            }
+            pending.erase(0, start);
+            if (pending.size() > MAX_LINE_LENGTH) {
+                {
+                    std::lock_guard<std::mutex> lock{metrics_mutex};
+                    ++metrics.invalid;
+                }
+                reply_error(*connection, "null", "request too long");
+                // Queued requests still hold the connection, so close it
+                // for both directions now rather than on destruction.
+                ::shutdown(connection->fd, SHUT_RDWR);
+                return;
+            }
+        }
+    }
+
+    // The members of a JSON object describing one line of analysis.
+    static std::string line_json(const SearchResult &line, int sign) {
+        std::ostringstream out{};
+        out << "\"depth\": " << line.depth << ", \"score\": "
+            << sign * line.score << ", \"pv\": [";
+        const auto &pv = line.principal_variation;
+        for (std::size_t i = 0; i < pv.size(); ++i) {
+            out << (i ? ", " : "") << '"' << uci_move_name(pv[i]) << '"';
+        }
+        out << "]";
+        return out.str();
+    }
+
+    template <PieceColor COLOR, typename SearcherType>
+    void analyse(SearcherType &searcher, const Request &request) {
+        const Clock::time_point start = Clock::now();
+        searcher.statistics = {};
+        searcher.limits.nodes = request.nodes;
+        searcher.halfmove_clock =
+            static_cast<int>(request.state.halfmove_clock);
+        searcher.limits.deadline = (request.movetime > 0)
+            ? start + std::chrono::milliseconds{request.movetime}
+            : Clock::time_point::max();
+        Connection &connection = *request.connection;
+        // Scores are reported from the side to move, as in UCI.
+        const int sign = (COLOR == PieceColor::WHITE) ? 1 : -1;
+        const std::vector<SearchResult> lines =
+            searcher.template search_lines<COLOR>(
+            request.board, request.depth,
+            static_cast<std::size_t>(request.multipv),
+            [&](const std::vector<SearchResult> &iteration) {
+                for (std::size_t i = 0; i < iteration.size(); ++i) {
+                    connection.send_line("{\"id\": " + request.id +
+                        ", \"type\": \"info\", \"multipv\": " +
+                        std::to_string(i + 1) + ", " +
+                        line_json(iteration[i], sign) + "}");
+                }
+            }
+        );
+        const SearchResult &result = lines.front();
+        const Clock::time_point stop = Clock::now();
+        const std::uint64_t nodes =
+            searcher.statistics.nodes + searcher.statistics.quiescence_nodes;
+        const double queue_ms = milliseconds(start - request.received);
+        const double search_ms = milliseconds(stop - start);
+        const double latency_ms = milliseconds(stop - request.received);
+
+        MoveList moves{};
+        generate_legal_moves<COLOR>(request.board, moves);
+        std::ostringstream line{};
+        line << "{\"id\": " << request.id << ", \"type\": \"result\""
+             << ", \"bestmove\": " << (moves.empty() ? std::string{"null"}
+                 : '"' + uci_move_name(result.best_move) + '"')
+             << ", \"score\": " << sign * result.score
+             << ", \"depth\": " << result.depth
+             << ", \"lines\": [";
+        for (std::size_t i = 0; i < lines.size(); ++i) {
+            line << (i ? ", " : "") << "{" << line_json(lines[i], sign) << "}";
+        }
+        line << "], \"nodes\": " << nodes
+             << ", \"queue_depth\": " << request.queue_depth
+             << ", \"queue_ms\": " << queue_ms
+             << ", \"search_ms\": " << search_ms
+             << ", \"latency_ms\": " << latency_ms << "}";
+        connection.send_line(line.str());
+
+        std::lock_guard<std::mutex> lock{metrics_mutex};
+        ++metrics.completed;
+        metrics.nodes += nodes;
+        metrics.total_latency_ms += latency_ms;
+        metrics.max_latency_ms = std::max(metrics.max_latency_ms, latency_ms);
+        metrics.total_queue_ms += queue_ms;
+    }
+
+    void run_worker(Worker &worker) {
+        while (true) {
+            Request request{};
+            {
+                std::unique_lock<std::mutex> lock{queue_mutex};
+                queue_signal.wait(lock, [this] { return !queue.empty(); });
+                request = std::move(queue.front());
+                queue.pop_front();
+                ++active;
+            }
+            const bool white =
+                (request.state.side_to_move == PieceColor::WHITE);
+            if (active_nnue_network()) {
+                if (white) {
+                    analyse<PieceColor::WHITE>(worker.nnue, request);
+                } else {
+                    analyse<PieceColor::BLACK>(worker.nnue, request);
+                }
+            } else {
+                if (white) {
+                    analyse<PieceColor::WHITE>(worker.positional, request);
+                } else {
+                    analyse<PieceColor::BLACK>(worker.positional, request);
+                }
+            }
+            std::lock_guard<std::mutex> lock{queue_mutex};
+            --active;
+        }
+    }
+
+public:
+
+    explicit AnalysisServer(std::string path, std::size_t worker_count,
+                            std::size_t queue_capacity = 256,
+                            std::size_t hash_megabytes = 256) :
+        path(std::move(path)), queue_capacity(queue_capacity),
+        table(hash_megabytes), cache(20), tablebases(), queue_mutex(),
+        queue_signal(), queue(), active(0), metrics_mutex(), metrics(),
+        worker_state(), workers() {
+        worker_count = std::max(worker_count, std::size_t{1});
+        for (std::size_t i = 0; i < worker_count; ++i) {
+            worker_state.push_back(std::make_unique<Worker>());
+            Worker &worker = *worker_state.back();
+            worker.positional.evaluation_cache = &cache;
+            worker.positional.transposition_table = &table;
+            worker.positional.tablebases = &tablebases;
+            worker.nnue.evaluation_cache = &cache;
+            worker.nnue.transposition_table = &table;
+            worker.nnue.tablebases = &tablebases;
+        }
+    }
+
+    AnalysisServer(const AnalysisServer &) = delete;
+    AnalysisServer &operator=(const AnalysisServer &) = delete;
+
+    // Maps the tablebase files in a directory for all workers to probe.
+    // Must be called before run.
+    std::size_t load_tablebases(const std::string &directory) {
+        return tablebases.load_directory(directory);
+    }
+
+    // Listens on the socket and serves requests until the process is
+    // terminated. Returns only if the socket cannot be opened.
+    bool run() {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(address.sun_path)) { return false; }
+        std::strncpy(address.sun_path, path.c_str(),
+                     sizeof(address.sun_path) - 1);
+        const int listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listener < 0) { return false; }
+        ::unlink(path.c_str());
+        if ((::bind(listener, reinterpret_cast<const sockaddr *>(&address),
+                    sizeof(address)) < 0) ||
+            (::listen(listener, 64) < 0)) {
+            ::close(listener);
+            return false;
+        }
+        for (const std::unique_ptr<Worker> &worker : worker_state) {
+            workers.emplace_back([this, &worker] { run_worker(*worker); });
+        }
+        while (true) {
+            const int fd = ::accept(listener, nullptr, nullptr);
+            if (fd < 0) {
+                // Errors other than these, such as running out of file
+                // descriptors, persist for a while; retrying at once would
+                // spin until they clear.
+                if ((errno != EINTR) && (errno != ECONNABORTED)) {
+                    std::this_thread::sleep_for(
+                        std::chrono::milliseconds{ACCEPT_BACKOFF_MS});
+                }
+                continue;
+            }
+            std::thread{[this, connection = std::make_shared<Connection>(fd)] {
+                read_connection(connection);
+            }}.detach();
+        }
+    }
+
+}; // class AnalysisServer
+
+
+} // namespace DZChess
+
+#endif // DZCHESS_ANALYSIS_SERVER_HPP_INCLUDED
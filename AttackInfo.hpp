@@ -0,0 +1,352 @@
+#ifndef DZCHESS_ATTACK_INFO_HPP_INCLUDED
+#define DZCHESS_ATTACK_INFO_HPP_INCLUDED
+
+#include <algorithm> // for std::max
+#include <array>     // for std::array
+#include <cstddef>   // for std::size_t
+#include <cstdint>   // for std::uint64_t
+
+#include "ChessPiece.hpp"
+#include "BitBoard.hpp"
+#include "ChessBoard.hpp"
+
+namespace DZChess {
+
+
+// Counts magic bitboard lookups (one per rook or bishop table access) made
+// while building attack maps, and the lookups that consumers of the maps
+// would otherwise have made themselves to answer the same questions.
+struct AttackStatistics {
+    std::uint64_t maps = 0;
+    std::uint64_t lookups = 0;
+    std::uint64_t lookups_saved = 0;
+};
+
+
+// Each thread keeps its own counters, so recording them needs no locking.
+inline AttackStatistics &attack_statistics() noexcept {
+    thread_local AttackStatistics statistics{};
+    return statistics;
+}
+
+
+// Attack information for both colors, computed once per search node and
+// shared by legality checking, evaluation and static exchange evaluation.
+// Attack sets include squares occupied by friendly pieces, so that they
+// also describe which pieces are defended.
+class AttackInfo {
+
+    static constexpr std::size_t index(PieceColor color) noexcept {
+        return static_cast<std::size_t>(color);
+    }
+
+    static constexpr BitBoard square_bit(std::uint64_t square) noexcept {
+        return BitBoard{std::uint64_t{1} << square};
+    }
+
+    // Squares strictly between two squares on a common line. The blocker
+    // set contains only the two endpoints, so each ray stops at the other.
+    template <bool DIAGONAL>
+    static constexpr BitBoard between(std::uint64_t a,
+                                      std::uint64_t b) noexcept {
+        const BitBoard endpoints = square_bit(a) | square_bit(b);
+        const BitBoard none{0};
+        if constexpr (DIAGONAL) {
+            return endpoints.bishop_moves(a, none) &
+                   endpoints.bishop_moves(b, none);
+        } else {
+            return endpoints.rook_moves(a, none) &
+                   endpoints.rook_moves(b, none);
+        }
+    }
+
+public:
+
+    // Attacks of the piece standing on each square; empty for empty squares.
+    std::array<BitBoard, 64> attacks_from;
+    std::array<std::array<BitBoard, 6>, 2> attacks_by_type;
+    std::array<BitBoard, 2> attacks;
+
+    // checkers[c] holds the enemy pieces attacking the king of color c, and
+    // pinners[c] the enemy sliders pinning one of its pieces to it.
+    std::array<BitBoard, 2> checkers;
+    std::array<BitBoard, 2> pinners;
+    std::array<BitBoard, 2> pinned;
+
+    // Destination squares that resolve a check on the king of each color:
+    // every square when not in check, the checker and the squares between
+    // it and the king in single check, and none in double check.
+    std::array<BitBoard, 2> evasions;
+
+    // For each pinned piece, the squares along its pin it may move to.
+    std::array<BitBoard, 64> pin_rays;
+
+    std::uint64_t lookups;
+
+    explicit AttackInfo(const ChessBoard &board) noexcept :
+        attacks_from(), attacks_by_type(), attacks(), checkers(), pinners(),
+        pinned(), evasions(), pin_rays(), lookups(0) {
+        compute_attacks<PieceColor::WHITE>(board);
+        compute_attacks<PieceColor::BLACK>(board);
+        compute_king_safety<PieceColor::WHITE>(board);
+        compute_king_safety<PieceColor::BLACK>(board);
+        AttackStatistics &statistics = attack_statistics();
+        ++statistics.maps;
+        statistics.lookups += lookups;
+    }
+
+private:
+
+    template <PieceColor COLOR, PieceType TYPE>
+    void compute_piece_attacks(const ChessBoard &board) noexcept {
+        const BitBoard all_pieces = board.get_all_pieces();
+        const BitBoard none{0};
+        BitBoard &by_type =
+            attacks_by_type[index(COLOR)][static_cast<std::size_t>(TYPE)];
+        for (const std::uint64_t src : board.get_piece<COLOR, TYPE>()) {
+            BitBoard result{0};
+            if constexpr (TYPE == PieceType::PAWN) {
+                result = BitBoard{(COLOR == PieceColor::WHITE)
+                    ? WHITE_PAWN_CAPTURE_TABLE[src]
+                    : BLACK_PAWN_CAPTURE_TABLE[src]};
+            } else {
+                result = all_pieces.moves<COLOR, TYPE>(src, none);
+            }
+            if constexpr (TYPE == PieceType::QUEEN) {
+                lookups += 2;
+            } else if constexpr ((TYPE == PieceType::ROOK) ||
+                                 (TYPE == PieceType::BISHOP)) {
+                lookups += 1;
+            }
+            attacks_from[src] = result;
+            by_type |= result;
+        }
+        attacks[index(COLOR)] |= by_type;
+    }
+
+    template <PieceColor COLOR>
+    void compute_attacks(const ChessBoard &board) noexcept {
+        compute_piece_attacks<COLOR, PieceType::KING  >(board);
+        compute_piece_attacks<COLOR, PieceType::QUEEN >(board);
+        compute_piece_attacks<COLOR, PieceType::ROOK  >(board);
+        compute_piece_attacks<COLOR, PieceType::BISHOP>(board);
+        compute_piece_attacks<COLOR, PieceType::KNIGHT>(board);
+        compute_piece_attacks<COLOR, PieceType::PAWN  >(board);
+    }
+
+    // Finds enemy sliders aligned with the king with no enemy piece in
+    // between. With nothing in between they give check, and blocking the
+    // squares in between evades it; with exactly one friendly piece in
+    // between, that piece is pinned.
+    template <PieceColor COLOR, bool DIAGONAL>
+    void compute_slider_lines(const ChessBoard &board,
+                              std::uint64_t king) noexcept {
+        constexpr PieceColor OTHER = other(COLOR);
+        const BitBoard enemy = board.get_pieces<OTHER>();
+        const BitBoard none{0};
+        const BitBoard sliders = board.get_piece<OTHER, PieceType::QUEEN>() |
+            (DIAGONAL ? board.get_piece<OTHER, PieceType::BISHOP>()
+                      : board.get_piece<OTHER, PieceType::ROOK>());
+        const BitBoard candidates = sliders & (DIAGONAL
+            ? enemy.bishop_moves(king, none)
+            : enemy.rook_moves(king, none));
+        ++lookups;
+        for (const std::uint64_t slider : candidates) {
+            const BitBoard ray = between<DIAGONAL>(king, slider);
+            lookups += 2;
+            const BitBoard blockers = ray & board.get_all_pieces();
+            if (blockers.is_empty()) {
+                evasions[index(COLOR)] |= ray;
+            } else if (blockers.popcount() == 1) {
+                const std::uint64_t pinned_square = *blockers.begin();
+                pinners[index(COLOR)] |= square_bit(slider);
+                pinned[index(COLOR)] |= blockers;
+                pin_rays[pinned_square] = ray | square_bit(slider);
+            }
+        }
+    }
+
+    template <PieceColor COLOR>
+    void compute_king_safety(const ChessBoard &board) noexcept {
+        constexpr PieceColor OTHER = other(COLOR);
+        const BitBoard king = board.get_piece<COLOR, PieceType::KING>();
+        if (king.popcount() != 1) {
+            evasions[index(COLOR)] = ~BitBoard{0};
+            return;
+        }
+        const std::uint64_t square = *king.begin();
+        for (const std::uint64_t src : board.get_pieces<OTHER>()) {
+            if (attacks_from[src].is_set(square)) {
+                checkers[index(COLOR)] |= square_bit(src);
+            }
+        }
+        // Collects the squares between the king and any checking slider.
+        compute_slider_lines<COLOR, false>(board, square);
+        compute_slider_lines<COLOR, true >(board, square);
+        const int count = checkers[index(COLOR)].popcount();
+        if (count == 0) {
+            evasions[index(COLOR)] = ~BitBoard{0};
+        } else if (count == 1) {
+            evasions[index(COLOR)] |= checkers[index(COLOR)];
+        } else {
+            evasions[index(COLOR)] = BitBoard{0};
+        }
+    }
+
+public:
+
+    template <PieceColor COLOR>
+    bool in_check() const noexcept {
+        // ChessBoard::in_check makes one rook and one bishop lookup.
+        attack_statistics().lookups_saved += 2;
+        return !checkers[index(COLOR)].is_empty();
+    }
+
+    template <PieceColor COLOR>
+    constexpr BitBoard attacks_of() const noexcept {
+        return attacks[index(COLOR)];
+    }
+
+    template <PieceColor COLOR, PieceType TYPE>
+    constexpr BitBoard attacks_of() const noexcept {
+        return attacks_by_type[index(COLOR)][static_cast<std::size_t>(TYPE)];
+    }
+
+    // Returns true if the pseudo-legal move does not leave the king of the
+    // moving side attacked. Boards without exactly one king of the moving
+    // color have no notion of check, so every move is accepted.
+    template <PieceColor COLOR>
+    bool is_legal(const ChessBoard &board,
+                  const ChessMove &move) const noexcept {
+        constexpr PieceColor OTHER = other(COLOR);
+        // Checking by making the move and calling in_check costs two lookups.
+        AttackStatistics &statistics = attack_statistics();
+        statistics.lookups_saved += 2;
+        if (board.piece_count<COLOR, PieceType::KING>() != 1) { return true; }
+        if (move.src_type == PieceType::KING) {
+            if (attacks[index(OTHER)].is_set(move.dst)) { return false; }
+            // A checking slider still attacks the squares behind the king
+            // once the king steps out of its line.
+            const BitBoard vacated =
+                board.get_all_pieces() & ~square_bit(move.src);
+            const BitBoard none{0};
+            for (const std::uint64_t src : checkers[index(COLOR)]) {
+                const PieceType type = board.piece_type_at<OTHER>(src);
+                BitBoard reach{0};
+                if (type == PieceType::QUEEN) {
+                    reach = vacated.queen_moves(src, none);
+                    statistics.lookups += 2;
+                } else if (type == PieceType::ROOK) {
+                    reach = vacated.rook_moves(src, none);
+                    statistics.lookups += 1;
+                } else if (type == PieceType::BISHOP) {
+                    reach = vacated.bishop_moves(src, none);
+                    statistics.lookups += 1;
+                }
+                if (reach.is_set(move.dst)) { return false; }
+            }
+            return true;
+        }
+        if (!evasions[index(COLOR)].is_set(move.dst)) { return false; }
+        if (pinned[index(COLOR)].is_set(move.src) &&
+            !pin_rays[move.src].is_set(move.dst)) { return false; }
+        return true;
+    }
+
+    // Pieces of both colors that attack the given square.
+    BitBoard attackers_to(const ChessBoard &board,
+                          std::uint64_t square) const noexcept {
+        // Recomputing this from the square would cost two lookups.
+        attack_statistics().lookups_saved += 2;
+        BitBoard result{0};
+        for (const std::uint64_t src : board.get_all_pieces()) {
+            if (attacks_from[src].is_set(square)) {
+                result |= square_bit(src);
+            }
+        }
+        return result;
+    }
+
+}; // class AttackInfo
+
+
+// Piece values for static exchange evaluation, indexed by PieceType. The
+// king may only capture last, which its large value enforces.
+constexpr std::array<int, 6> EXCHANGE_VALUE = {
+    20'000, 900, 500, 300, 300, 100
+};
+
+
+template <PieceType TYPE>
+constexpr BitBoard both_colors(const ChessBoard &board) noexcept {
+    return board.get_piece<PieceColor::WHITE, TYPE>() |
+           board.get_piece<PieceColor::BLACK, TYPE>();
+}
+
+
+// Static exchange evaluation: the material balance, from the point of view
+// of the moving side, of the sequence of captures on the destination square
+// when both sides always recapture with their least valuable attacker and
+// may stop at any time. Promotions are valued as plain pawn moves.
+template <PieceColor COLOR>
+int static_exchange_evaluation(const ChessBoard &board,
+                               const AttackInfo &info,
+                               const ChessMove &move) noexcept {
+    using enum PieceType;
+    const std::array<BitBoard, 6> pieces = {
+        both_colors<KING  >(board), both_colors<QUEEN >(board),
+        both_colors<ROOK  >(board), both_colors<BISHOP>(board),
+        both_colors<KNIGHT>(board), both_colors<PAWN  >(board),
+    };
+    const BitBoard diagonal = pieces[1] | pieces[3];
+    const BitBoard straight = pieces[1] | pieces[2];
+    const BitBoard none{0};
+
+    std::array<int, 32> gain{};
+    gain[0] = board.is_occupied(move.dst)
+        ? EXCHANGE_VALUE[static_cast<std::size_t>(
+              board.piece_type_at<other(COLOR)>(move.dst))]
+        : 0;
+    BitBoard occupied =
+        board.get_all_pieces() & ~BitBoard{std::uint64_t{1} << move.src};
+    BitBoard attackers = info.attackers_to(board, move.dst) & occupied;
+    int on_square = EXCHANGE_VALUE[static_cast<std::size_t>(move.src_type)];
+    bool white_to_capture = (COLOR != PieceColor::WHITE);
+
+    std::size_t depth = 0;
+    while (depth + 1 < gain.size()) {
+        const BitBoard side = attackers & (white_to_capture
+            ? board.get_pieces<PieceColor::WHITE>()
+            : board.get_pieces<PieceColor::BLACK>());
+        // Least valuable attacker first; types are ordered king to pawn.
+        std::size_t type = 6;
+        while ((type > 0) && (side & pieces[type - 1]).is_empty()) {
+            --type;
+        }
+        if (type == 0) { break; }
+        const BitBoard attacker{
+            std::uint64_t{1} << *(side & pieces[type - 1]).begin()
+        };
+        ++depth;
+        gain[depth] = on_square - gain[depth - 1];
+        on_square = EXCHANGE_VALUE[type - 1];
+        occupied = occupied & ~attacker;
+        // Removing a piece may uncover a slider behind it.
+        attackers = (attackers |
+                     (occupied.bishop_moves(move.dst, none) & diagonal) |
+                     (occupied.rook_moves(move.dst, none) & straight)) &
+                    occupied;
+        attack_statistics().lookups += 2;
+        white_to_capture = !white_to_capture;
+    }
+    while (depth > 0) {
+        gain[depth - 1] = -std::max(-gain[depth - 1], gain[depth]);
+        --depth;
+    }
+    return gain[0];
+}
+
+
+} // namespace DZChess
+
+#endif // DZCHESS_ATTACK_INFO_HPP_INCLUDED
@@ -0,0 +1,79 @@
+#include <chrono>   // for std::chrono::steady_clock
+#include <cstddef>  // for std::size_t
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ChessPiece.hpp"
+#include "ChessBoard.hpp"
+#include "Evaluation.hpp"
+#include "BatchEvaluation.hpp"
+#include "RandomGames.hpp"
+
+
+using namespace DZChess;
+
+
+template <typename Function>
+void benchmark(const std::string &name, std::size_t count, Function f) {
+    const auto start = std::chrono::steady_clock::now();
+    const long long checksum = f();
+    const auto stop = std::chrono::steady_clock::now();
+    const double seconds = std::chrono::duration<double>(stop - start).count();
+    std::cout << "    " << name << ": "
+              << static_cast<double>(count) / seconds << " evals/s"
+              << " (checksum " << checksum << ")" << std::endl;
+}
+
+
+long long checksum(const std::vector<int> &scores) {
+    long long result = 0;
+    for (const int score : scores) { result += score; }
+    return result;
+}
+
+
+int main() {
+
+    const std::size_t count = 1'000'000;
+    std::vector<ChessBoard> boards{};
+    boards.reserve(count);
+    for (const auto &[board, color] : random_game_positions(count, 2)) {
+        boards.push_back(board);
+    }
+    std::vector<int> scores(count);
+
+    std::cout << "per-board loop:" << std::endl;
+    benchmark("piece-square", count, [&]() {
+        for (std::size_t i = 0; i < count; ++i) {
+            scores[i] = PieceSquareEvaluationVisitor<
+                PieceColor::WHITE, 0>::visit(boards[i]);
+        }
+        return checksum(scores);
+    });
+    benchmark("positional", count, [&]() {
+        for (std::size_t i = 0; i < count; ++i) {
+            scores[i] = PositionalEvaluationVisitor<
+                PieceColor::WHITE, 0>::visit(boards[i]);
+        }
+        return checksum(scores);
+    });
+
+    const BatchKernels *detected = batch_kernels();
+    std::cout << "batch:" << std::endl;
+    batch_kernels() = &BATCH_SCALAR_KERNELS;
+    benchmark("scalar", count, [&]() {
+        evaluate_batch(boards, scores);
+        return checksum(scores);
+    });
+    if (detected != &BATCH_SCALAR_KERNELS) {
+        batch_kernels() = detected;
+        benchmark(detected->name, count, [&]() {
+            evaluate_batch(boards, scores);
+            return checksum(scores);
+        });
+    } else {
+        std::cout << "AVX2 not available on this CPU." << std::endl;
+    }
+
+}
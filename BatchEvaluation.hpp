@@ -0,0 +1,499 @@
+#ifndef DZCHESS_BATCH_EVALUATION_HPP_INCLUDED
+#define DZCHESS_BATCH_EVALUATION_HPP_INCLUDED
+
+#include <algorithm> // for std::min, std::fill
+#include <array>     // for std::array
+#include <bit>       // for std::popcount
+#include <cstddef>   // for std::size_t, std::ptrdiff_t
+#include <cstdint>   // for std::uint64_t, std::int64_t, UINT64_C
+#include <span>      // for std::span
+#include <vector>    // for std::vector
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define DZCHESS_BATCH_AVX2
+#endif
+
+#include "ChessPiece.hpp"
+#include "ChessBoard.hpp"
+#include "PieceSquareTables.hpp"
+#include "Mobility.hpp"
+
+namespace DZChess {
+
+
+// Batch evaluation scores many independent positions at once. Boards are
+// transposed into structure-of-arrays buffers, one array per piece
+// bitboard, so that the same bitboard of consecutive boards can be loaded
+// into one vector register. The evaluation is the material and
+// piece-square score that every ChessBoard already carries, plus area
+// mobility: the number of safe squares attacked by each piece type,
+// computed setwise with occluded fills rather than per piece, so that it
+// needs no table lookups and vectorizes across boards.
+
+
+// Structure-of-arrays copy of a batch of boards. The number of boards is
+// padded to a multiple of BATCH_WIDTH with empty boards, so that kernels
+// never need a scalar tail loop.
+constexpr std::size_t BATCH_WIDTH = 4;
+
+class BoardBatch {
+
+    // Indexed by 6 * color + type, then by board.
+    std::array<std::vector<std::uint64_t>, 12> pieces;
+    std::size_t count;
+
+    template <PieceColor COLOR, PieceType TYPE>
+    void store(std::size_t i, const ChessBoard &board) noexcept {
+        pieces[6 * static_cast<std::size_t>(COLOR) +
+               static_cast<std::size_t>(TYPE)][i] =
+            board.get_piece<COLOR, TYPE>().get_data();
+    }
+
+    template <PieceColor COLOR>
+    void store(std::size_t i, const ChessBoard &board) noexcept {
+        store<COLOR, PieceType::KING  >(i, board);
+        store<COLOR, PieceType::QUEEN >(i, board);
+        store<COLOR, PieceType::ROOK  >(i, board);
+        store<COLOR, PieceType::BISHOP>(i, board);
+        store<COLOR, PieceType::KNIGHT>(i, board);
+        store<COLOR, PieceType::PAWN  >(i, board);
+    }
+
+public:
+
+    explicit BoardBatch() noexcept : pieces(), count(0) {}
+
+    // Each board is read once and scattered into the twelve buffers.
+    void assign(std::span<const ChessBoard> boards) {
+        count = boards.size();
+        const std::size_t padded =
+            (count + BATCH_WIDTH - 1) / BATCH_WIDTH * BATCH_WIDTH;
+        for (auto &buffer : pieces) {
+            buffer.resize(padded);
+            std::fill(buffer.begin() + static_cast<std::ptrdiff_t>(count),
+                      buffer.end(), 0);
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            store<PieceColor::WHITE>(i, boards[i]);
+            store<PieceColor::BLACK>(i, boards[i]);
+        }
+    }
+
+    constexpr std::size_t size() const noexcept { return count; }
+
+    std::size_t padded_size() const noexcept { return pieces[0].size(); }
+
+    const std::uint64_t *data(std::size_t index) const noexcept {
+        return pieces[index].data();
+    }
+
+}; // class BoardBatch
+
+
+// Midgame and endgame scores and game phase of each board in a batch, from
+// white's point of view, before tapering.
+struct BatchScores {
+    std::vector<std::int64_t> midgame;
+    std::vector<std::int64_t> endgame;
+    std::vector<std::int64_t> phase;
+};
+
+
+constexpr std::uint64_t BATCH_FILE_A = UINT64_C(0x0101010101010101);
+constexpr std::uint64_t BATCH_FILE_H = UINT64_C(0x8080808080808080);
+constexpr std::uint64_t BATCH_FILE_AB = UINT64_C(0x0303030303030303);
+constexpr std::uint64_t BATCH_FILE_GH = UINT64_C(0xC0C0C0C0C0C0C0C0);
+
+
+// Kernels add the mobility of each board to its scores.
+struct BatchKernels {
+    void (*add_mobility)(const BoardBatch &, BatchScores &) noexcept;
+    const char *name;
+};
+
+
+////////////////////////////////////////////////////////////////// SCALAR KERNEL
+
+
+template <int SHIFT>
+constexpr std::uint64_t batch_shift(std::uint64_t b) noexcept {
+    if constexpr (SHIFT > 0) {
+        return b << SHIFT;
+    } else {
+        return b >> -SHIFT;
+    }
+}
+
+
+// Kogge-Stone occluded fill: every square reached from a slider in the
+// direction SHIFT before hitting a blocker, including the blocker itself.
+// WRAP excludes squares that a shift would wrap onto from the other edge.
+template <int SHIFT, std::uint64_t WRAP>
+constexpr std::uint64_t batch_slide(std::uint64_t sliders,
+                                    std::uint64_t empty) noexcept {
+    std::uint64_t propagator = empty & ~WRAP;
+    sliders |= propagator & batch_shift<SHIFT>(sliders);
+    propagator &= batch_shift<SHIFT>(propagator);
+    sliders |= propagator & batch_shift<2 * SHIFT>(sliders);
+    propagator &= batch_shift<2 * SHIFT>(propagator);
+    sliders |= propagator & batch_shift<4 * SHIFT>(sliders);
+    return batch_shift<SHIFT>(sliders) & ~WRAP;
+}
+
+
+constexpr std::uint64_t batch_orthogonal(std::uint64_t sliders,
+                                         std::uint64_t empty) noexcept {
+    return batch_slide<+8, 0>(sliders, empty) |
+           batch_slide<-8, 0>(sliders, empty) |
+           batch_slide<+1, BATCH_FILE_A>(sliders, empty) |
+           batch_slide<-1, BATCH_FILE_H>(sliders, empty);
+}
+
+
+constexpr std::uint64_t batch_diagonal(std::uint64_t sliders,
+                                       std::uint64_t empty) noexcept {
+    return batch_slide<+9, BATCH_FILE_A>(sliders, empty) |
+           batch_slide<+7, BATCH_FILE_H>(sliders, empty) |
+           batch_slide<-7, BATCH_FILE_A>(sliders, empty) |
+           batch_slide<-9, BATCH_FILE_H>(sliders, empty);
+}
+
+
+constexpr std::uint64_t batch_knights(std::uint64_t knights) noexcept {
+    const std::uint64_t one = ((knights << 1) & ~BATCH_FILE_A) |
+                              ((knights >> 1) & ~BATCH_FILE_H);
+    const std::uint64_t two = ((knights << 2) & ~BATCH_FILE_AB) |
+                              ((knights >> 2) & ~BATCH_FILE_GH);
+    return (one << 16) | (one >> 16) | (two << 8) | (two >> 8);
+}
+
+
+template <bool WHITE>
+constexpr std::uint64_t batch_pawn_attacks(std::uint64_t pawns) noexcept {
+    if constexpr (WHITE) {
+        return ((pawns << 9) & ~BATCH_FILE_A) | ((pawns << 7) & ~BATCH_FILE_H);
+    } else {
+        return ((pawns >> 7) & ~BATCH_FILE_A) | ((pawns >> 9) & ~BATCH_FILE_H);
+    }
+}
+
+
+// Area mobility of one color: the safe squares attacked by its queens,
+// rooks, bishops and knights, weighted per piece type.
+template <bool WHITE>
+constexpr void batch_mobility_scalar(const std::uint64_t *p,
+                                     std::int64_t &midgame,
+                                     std::int64_t &endgame) noexcept {
+    const std::size_t own = WHITE ? 0 : 6;
+    const std::size_t opp = WHITE ? 6 : 0;
+    std::uint64_t occupied = 0;
+    std::uint64_t own_pieces = 0;
+    for (std::size_t t = 0; t < 6; ++t) {
+        occupied |= p[t] | p[6 + t];
+        own_pieces |= p[own + t];
+    }
+    const std::uint64_t empty = ~occupied;
+    const std::uint64_t targets = ~own_pieces &
+        ~batch_pawn_attacks<!WHITE>(p[opp + 5]);
+    const std::array<std::uint64_t, 6> attacks = {
+        0,
+        batch_orthogonal(p[own + 1], empty) |
+            batch_diagonal(p[own + 1], empty),
+        batch_orthogonal(p[own + 2], empty),
+        batch_diagonal(p[own + 3], empty),
+        batch_knights(p[own + 4]),
+        0,
+    };
+    const int sign = WHITE ? +1 : -1;
+    for (std::size_t t = 1; t < 5; ++t) {
+        const int area = std::popcount(attacks[t] & targets);
+        midgame += sign * MOBILITY_MIDGAME[t] * area;
+        endgame += sign * MOBILITY_ENDGAME[t] * area;
+    }
+}
+
+
+inline void batch_add_mobility_scalar(const BoardBatch &batch,
+                                      BatchScores &scores) noexcept {
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+        std::array<std::uint64_t, 12> p;
+        for (std::size_t t = 0; t < 12; ++t) { p[t] = batch.data(t)[i]; }
+        batch_mobility_scalar<true >(p.data(), scores.midgame[i],
+                                     scores.endgame[i]);
+        batch_mobility_scalar<false>(p.data(), scores.midgame[i],
+                                     scores.endgame[i]);
+    }
+}
+
+
+constexpr BatchKernels BATCH_SCALAR_KERNELS = {
+    batch_add_mobility_scalar,
+    "scalar",
+};
+
+
+//////////////////////////////////////////////////////////////////// AVX2 KERNEL
+
+
+#ifdef DZCHESS_BATCH_AVX2
+
+
+// Popcount of each 64-bit lane: a nibble lookup table in a shuffle, then
+// horizontal byte sums against zero.
+__attribute__((target("avx2")))
+inline __m256i batch_popcount_avx2(__m256i v) noexcept {
+    const __m256i lookup = _mm256_setr_epi8(
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4
+    );
+    const __m256i low_mask = _mm256_set1_epi8(0x0F);
+    const __m256i low = _mm256_and_si256(v, low_mask);
+    const __m256i high = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask);
+    const __m256i counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low),
+                                           _mm256_shuffle_epi8(lookup, high));
+    return _mm256_sad_epu8(counts, _mm256_setzero_si256());
+}
+
+
+template <int SHIFT>
+__attribute__((target("avx2")))
+inline __m256i batch_shift_avx2(__m256i b) noexcept {
+    if constexpr (SHIFT > 0) {
+        return _mm256_slli_epi64(b, SHIFT);
+    } else {
+        return _mm256_srli_epi64(b, -SHIFT);
+    }
+}
+
+
+template <int SHIFT, std::uint64_t WRAP>
+__attribute__((target("avx2")))
+inline __m256i batch_slide_avx2(__m256i sliders, __m256i empty) noexcept {
+    const __m256i keep = _mm256_set1_epi64x(
+        static_cast<long long>(~WRAP));
+    __m256i propagator = _mm256_and_si256(empty, keep);
+    sliders = _mm256_or_si256(sliders, _mm256_and_si256(
+        propagator, batch_shift_avx2<SHIFT>(sliders)));
+    propagator = _mm256_and_si256(propagator,
+                                  batch_shift_avx2<SHIFT>(propagator));
+    sliders = _mm256_or_si256(sliders, _mm256_and_si256(
+        propagator, batch_shift_avx2<2 * SHIFT>(sliders)));
+    propagator = _mm256_and_si256(propagator,
+                                  batch_shift_avx2<2 * SHIFT>(propagator));
+    sliders = _mm256_or_si256(sliders, _mm256_and_si256(
+        propagator, batch_shift_avx2<4 * SHIFT>(sliders)));
+    return _mm256_and_si256(batch_shift_avx2<SHIFT>(sliders), keep);
+}
+
+
+__attribute__((target("avx2")))
+inline __m256i batch_orthogonal_avx2(__m256i sliders,
+                                     __m256i empty) noexcept {
+    return _mm256_or_si256(
+        _mm256_or_si256(batch_slide_avx2<+8, 0>(sliders, empty),
+                        batch_slide_avx2<-8, 0>(sliders, empty)),
+        _mm256_or_si256(batch_slide_avx2<+1, BATCH_FILE_A>(sliders, empty),
+                        batch_slide_avx2<-1, BATCH_FILE_H>(sliders, empty)));
+}
+
+
+__attribute__((target("avx2")))
+inline __m256i batch_diagonal_avx2(__m256i sliders, __m256i empty) noexcept {
+    return _mm256_or_si256(
+        _mm256_or_si256(batch_slide_avx2<+9, BATCH_FILE_A>(sliders, empty),
+                        batch_slide_avx2<+7, BATCH_FILE_H>(sliders, empty)),
+        _mm256_or_si256(batch_slide_avx2<-7, BATCH_FILE_A>(sliders, empty),
+                        batch_slide_avx2<-9, BATCH_FILE_H>(sliders, empty)));
+}
+
+
+__attribute__((target("avx2")))
+inline __m256i batch_andnot_avx2(__m256i b, std::uint64_t mask) noexcept {
+    return _mm256_andnot_si256(
+        _mm256_set1_epi64x(static_cast<long long>(mask)), b);
+}
+
+
+__attribute__((target("avx2")))
+inline __m256i batch_knights_avx2(__m256i knights) noexcept {
+    const __m256i one = _mm256_or_si256(
+        batch_andnot_avx2(_mm256_slli_epi64(knights, 1), BATCH_FILE_A),
+        batch_andnot_avx2(_mm256_srli_epi64(knights, 1), BATCH_FILE_H));
+    const __m256i two = _mm256_or_si256(
+        batch_andnot_avx2(_mm256_slli_epi64(knights, 2), BATCH_FILE_AB),
+        batch_andnot_avx2(_mm256_srli_epi64(knights, 2), BATCH_FILE_GH));
+    return _mm256_or_si256(
+        _mm256_or_si256(_mm256_slli_epi64(one, 16),
+                        _mm256_srli_epi64(one, 16)),
+        _mm256_or_si256(_mm256_slli_epi64(two, 8),
+                        _mm256_srli_epi64(two, 8)));
+}
+
+
+template <bool WHITE>
+__attribute__((target("avx2")))
+inline __m256i batch_pawn_attacks_avx2(__m256i pawns) noexcept {
+    if constexpr (WHITE) {
+        return _mm256_or_si256(
+            batch_andnot_avx2(_mm256_slli_epi64(pawns, 9), BATCH_FILE_A),
+            batch_andnot_avx2(_mm256_slli_epi64(pawns, 7), BATCH_FILE_H));
+    } else {
+        return _mm256_or_si256(
+            batch_andnot_avx2(_mm256_srli_epi64(pawns, 7), BATCH_FILE_A),
+            batch_andnot_avx2(_mm256_srli_epi64(pawns, 9), BATCH_FILE_H));
+    }
+}
+
+
+// Multiplies each lane, which must fit in 32 bits, by a signed weight.
+__attribute__((target("avx2")))
+inline __m256i batch_scale_avx2(__m256i counts,
+                                std::int64_t weight) noexcept {
+    return _mm256_mul_epi32(
+        counts, _mm256_set1_epi64x(static_cast<long long>(weight)));
+}
+
+
+// Adds weight * popcount(b) to each lane of an accumulator.
+__attribute__((target("avx2")))
+inline __m256i batch_weighted_count_avx2(__m256i accumulator, __m256i b,
+                                         std::int64_t weight) noexcept {
+    return _mm256_add_epi64(
+        accumulator, batch_scale_avx2(batch_popcount_avx2(b), weight));
+}
+
+
+template <bool WHITE>
+__attribute__((target("avx2")))
+inline void batch_mobility_avx2(const __m256i *p, __m256i &midgame,
+                                __m256i &endgame) noexcept {
+    const std::size_t own = WHITE ? 0 : 6;
+    const std::size_t opp = WHITE ? 6 : 0;
+    __m256i occupied = _mm256_setzero_si256();
+    __m256i own_pieces = _mm256_setzero_si256();
+    for (std::size_t t = 0; t < 6; ++t) {
+        occupied = _mm256_or_si256(occupied, _mm256_or_si256(p[t], p[6 + t]));
+        own_pieces = _mm256_or_si256(own_pieces, p[own + t]);
+    }
+    const __m256i ones = _mm256_set1_epi64x(-1);
+    const __m256i empty = _mm256_xor_si256(occupied, ones);
+    const __m256i blocked = _mm256_or_si256(
+        own_pieces, batch_pawn_attacks_avx2<!WHITE>(p[opp + 5]));
+    const __m256i attacks[6] = {
+        _mm256_setzero_si256(),
+        _mm256_or_si256(batch_orthogonal_avx2(p[own + 1], empty),
+                        batch_diagonal_avx2(p[own + 1], empty)),
+        batch_orthogonal_avx2(p[own + 2], empty),
+        batch_diagonal_avx2(p[own + 3], empty),
+        batch_knights_avx2(p[own + 4]),
+        _mm256_setzero_si256(),
+    };
+    const std::int64_t sign = WHITE ? +1 : -1;
+    for (std::size_t t = 1; t < 5; ++t) {
+        const __m256i area = _mm256_andnot_si256(blocked, attacks[t]);
+        midgame = batch_weighted_count_avx2(
+            midgame, area, sign * MOBILITY_MIDGAME[t]);
+        endgame = batch_weighted_count_avx2(
+            endgame, area, sign * MOBILITY_ENDGAME[t]);
+    }
+}
+
+
+__attribute__((target("avx2")))
+inline void batch_add_mobility_avx2(const BoardBatch &batch,
+                                    BatchScores &scores) noexcept {
+    for (std::size_t i = 0; i < batch.padded_size(); i += BATCH_WIDTH) {
+        __m256i p[12];
+        for (std::size_t t = 0; t < 12; ++t) {
+            p[t] = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i *>(batch.data(t) + i));
+        }
+        auto *midgame = reinterpret_cast<__m256i *>(scores.midgame.data() + i);
+        auto *endgame = reinterpret_cast<__m256i *>(scores.endgame.data() + i);
+        __m256i mg = _mm256_loadu_si256(midgame);
+        __m256i eg = _mm256_loadu_si256(endgame);
+        batch_mobility_avx2<true >(p, mg, eg);
+        batch_mobility_avx2<false>(p, mg, eg);
+        _mm256_storeu_si256(midgame, mg);
+        _mm256_storeu_si256(endgame, eg);
+    }
+}
+
+
+constexpr BatchKernels BATCH_AVX2_KERNELS = {
+    batch_add_mobility_avx2,
+    "avx2",
+};
+
+
+#endif // DZCHESS_BATCH_AVX2
+
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+inline bool batch_avx2_supported() noexcept {
+#ifdef DZCHESS_BATCH_AVX2
+    return __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+}
+
+
+// Kernels used by evaluate_batch, chosen once at startup from the CPU's
+// capabilities. Benchmarks may reassign it to compare implementations.
+inline const BatchKernels *&batch_kernels() noexcept {
+#ifdef DZCHESS_BATCH_AVX2
+    static const BatchKernels *kernels = batch_avx2_supported()
+        ? &BATCH_AVX2_KERNELS : &BATCH_SCALAR_KERNELS;
+#else
+    static const BatchKernels *kernels = &BATCH_SCALAR_KERNELS;
+#endif
+    return kernels;
+}
+
+
+// Evaluates every board from white's point of view and writes the scores
+// to the corresponding entries of the output, which must be at least as
+// long. Boards are transposed in blocks small enough to stay in cache.
+inline void evaluate_batch(std::span<const ChessBoard> boards,
+                           std::span<int> output) {
+    constexpr std::size_t BLOCK = 1024;
+    BoardBatch batch{};
+    BatchScores scores{std::vector<std::int64_t>(BLOCK),
+                       std::vector<std::int64_t>(BLOCK),
+                       std::vector<std::int64_t>(BLOCK)};
+    const BatchKernels &kernels = *batch_kernels();
+    for (std::size_t begin = 0; begin < boards.size(); begin += BLOCK) {
+        const std::size_t end = std::min(begin + BLOCK, boards.size());
+        batch.assign(boards.subspan(begin, end - begin));
+        for (std::size_t i = begin; i < end; ++i) {
+            const PieceSquareScore &board_scores = boards[i].get_scores();
+            scores.midgame[i - begin] = board_scores.midgame;
+            scores.endgame[i - begin] = board_scores.endgame;
+            scores.phase[i - begin] = board_scores.phase;
+        }
+        kernels.add_mobility(batch, scores);
+        for (std::size_t i = begin; i < end; ++i) {
+            const ChessBoard &b = boards[i];
+            const std::size_t j = i - begin;
+            if (b.get_piece<PieceColor::WHITE, PieceType::KING>().is_empty()) {
+                output[i] = -1'000'000;
+            } else if (b.get_piece<PieceColor::BLACK,
+                                   PieceType::KING>().is_empty()) {
+                output[i] = +1'000'000;
+            } else {
+                output[i] = taper(static_cast<int>(scores.midgame[j]),
+                                  static_cast<int>(scores.endgame[j]),
+                                  static_cast<int>(scores.phase[j]));
+            }
+        }
+    }
+}
+
+
+} // namespace DZChess
+
+#endif // DZCHESS_BATCH_EVALUATION_HPP_INCLUDED
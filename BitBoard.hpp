@@ -2,7 +2,7 @@
 #define DZCHESS_BIT_BOARD_HPP_INCLUDED
 
 #include <bit>     // for std::countr_zero, std::popcount
-#include <cstdint> // for std::uint64_t
+#include <cstdint> // for std::uint64_t, UINT64_C
 
 #include "ChessPiece.hpp"
 #include "MoveTables.hpp"
@@ -41,8 +41,14 @@ class BitBoard {
 
 public:
 
+    constexpr BitBoard() noexcept : data(0) {}
+
     constexpr BitBoard(std::uint64_t data) noexcept : data(data) {}
 
+    constexpr std::uint64_t get_data() const noexcept {
+        return data;
+    }
+
     constexpr BitBoardIterator begin() const noexcept {
         return BitBoardIterator{data};
     }
@@ -51,6 +57,10 @@ public:
         return BitBoardIterator{0};
     }
 
+    constexpr bool is_empty() const noexcept {
+        return data == 0;
+    }
+
     constexpr bool is_set(std::uint64_t index) const noexcept {
         return ((data >> index) & 1) != 0;
     }
@@ -77,6 +87,17 @@ public:
         return BitBoard{~data};
     }
 
+    // Mirrors the board top to bottom, so that rank 1 becomes rank 8. This
+    // is a byte swap, which compilers emit as a single instruction.
+    constexpr BitBoard flip_vertical() const noexcept {
+        std::uint64_t x = data;
+        x = ((x >> 8) & UINT64_C(0x00FF00FF00FF00FF)) |
+            ((x & UINT64_C(0x00FF00FF00FF00FF)) << 8);
+        x = ((x >> 16) & UINT64_C(0x0000FFFF0000FFFF)) |
+            ((x & UINT64_C(0x0000FFFF0000FFFF)) << 16);
+        return BitBoard{(x >> 32) | (x << 32)};
+    }
+
     constexpr BitBoard shift_up() const noexcept {
         return BitBoard{data << 8};
     }
@@ -85,6 +106,34 @@ public:
         return BitBoard{data >> 8};
     }
 
+    // Shifts one file towards h, discarding pieces that fall off the board.
+    constexpr BitBoard shift_east() const noexcept {
+        return BitBoard{(data << 1) & ~UINT64_C(0x0101010101010101)};
+    }
+
+    // Shifts one file towards a, discarding pieces that fall off the board.
+    constexpr BitBoard shift_west() const noexcept {
+        return BitBoard{(data >> 1) & ~UINT64_C(0x8080808080808080)};
+    }
+
+    // Sets every square on or above a set square in the same file.
+    constexpr BitBoard fill_up() const noexcept {
+        std::uint64_t x = data;
+        x |= x << 8;
+        x |= x << 16;
+        x |= x << 32;
+        return BitBoard{x};
+    }
+
+    // Sets every square on or below a set square in the same file.
+    constexpr BitBoard fill_down() const noexcept {
+        std::uint64_t x = data;
+        x |= x >> 8;
+        x |= x >> 16;
+        x |= x >> 32;
+        return BitBoard{x};
+    }
+
     constexpr int popcount() const noexcept {
         return std::popcount(data);
     }
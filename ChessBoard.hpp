@@ -1,10 +1,13 @@
 #ifndef DZCHESS_CHESS_BOARD_HPP_INCLUDED
 #define DZCHESS_CHESS_BOARD_HPP_INCLUDED
 
+#include <bit>     // for std::rotl
 #include <cstdint> // for std::uint64_t, UINT64_C
 
 #include "ChessPiece.hpp"
 #include "BitBoard.hpp"
+#include "PieceSquareTables.hpp"
+#include "Zobrist.hpp"
 
 namespace DZChess {
 
@@ -29,6 +32,59 @@ class ChessBoard {
     BitBoard black_pieces;
     BitBoard all_pieces;
 
+    PieceSquareScore scores;
+    std::uint64_t hash;
+    std::uint64_t pawn_hash;
+
+    template <PieceColor COLOR, PieceType TYPE>
+    constexpr void add_scores(PieceSquareScore &result) const noexcept {
+        for (const std::uint64_t square : get_piece<COLOR, TYPE>()) {
+            result.add<COLOR>(TYPE, square);
+        }
+    }
+
+    template <PieceColor COLOR>
+    constexpr void add_scores(PieceSquareScore &result) const noexcept {
+        add_scores<COLOR, PieceType::KING  >(result);
+        add_scores<COLOR, PieceType::QUEEN >(result);
+        add_scores<COLOR, PieceType::ROOK  >(result);
+        add_scores<COLOR, PieceType::BISHOP>(result);
+        add_scores<COLOR, PieceType::KNIGHT>(result);
+        add_scores<COLOR, PieceType::PAWN  >(result);
+    }
+
+    template <PieceColor COLOR, PieceType TYPE>
+    constexpr std::uint64_t compute_hash() const noexcept {
+        std::uint64_t result = 0;
+        for (const std::uint64_t square : get_piece<COLOR, TYPE>()) {
+            result ^= zobrist_key<COLOR>(TYPE, square);
+        }
+        return result;
+    }
+
+    template <PieceColor COLOR>
+    constexpr std::uint64_t compute_hash() const noexcept {
+        return compute_hash<COLOR, PieceType::KING  >() ^
+               compute_hash<COLOR, PieceType::QUEEN >() ^
+               compute_hash<COLOR, PieceType::ROOK  >() ^
+               compute_hash<COLOR, PieceType::BISHOP>() ^
+               compute_hash<COLOR, PieceType::KNIGHT>() ^
+               compute_hash<COLOR, PieceType::PAWN  >();
+    }
+
+    template <PieceColor COLOR>
+    constexpr void toggle_piece(PieceType type, std::uint64_t square,
+                                bool adding) noexcept {
+        if (adding) {
+            scores.add<COLOR>(type, square);
+        } else {
+            scores.remove<COLOR>(type, square);
+        }
+        const std::uint64_t key = zobrist_key<COLOR>(type, square);
+        hash ^= key;
+        if (type == PieceType::PAWN) { pawn_hash ^= key; }
+    }
+
 public:
 
     explicit constexpr ChessBoard(
@@ -43,7 +99,10 @@ public:
         black_bishop(bb), black_knight(bn), black_pawn(bp),
         white_pieces(wk | wq | wr | wb | wn | wp),
         black_pieces(bk | bq | br | bb | bn | bp),
-        all_pieces(white_pieces | black_pieces) {}
+        all_pieces(white_pieces | black_pieces),
+        scores(compute_scores()),
+        hash(compute_hash()),
+        pawn_hash(compute_pawn_hash()) {}
 
     explicit constexpr ChessBoard() noexcept : ChessBoard(
         UINT64_C(0x0000000000000010), UINT64_C(0x0000000000000008),
@@ -96,6 +155,83 @@ public:
         }
     }
 
+    constexpr BitBoard get_all_pieces() const noexcept {
+        return all_pieces;
+    }
+
+    // Material and piece-square score from white's point of view, kept up
+    // to date by clear_square and add_piece.
+    constexpr const PieceSquareScore &get_scores() const noexcept {
+        return scores;
+    }
+
+    // Recomputes the material and piece-square score from scratch. Used to
+    // initialize the board and to check the incremental updates.
+    constexpr PieceSquareScore compute_scores() const noexcept {
+        PieceSquareScore result{0, 0, 0};
+        add_scores<PieceColor::WHITE>(result);
+        add_scores<PieceColor::BLACK>(result);
+        return result;
+    }
+
+    // Zobrist hash of the piece placement, kept up to date like the scores.
+    // It does not include the side to move; ZOBRIST_KEYS.black_to_move is
+    // mixed in by callers that need it.
+    constexpr std::uint64_t get_hash() const noexcept { return hash; }
+
+    // Zobrist hash of the pawns alone, for the pawn structure cache.
+    constexpr std::uint64_t get_pawn_hash() const noexcept {
+        return pawn_hash;
+    }
+
+    constexpr std::uint64_t compute_hash() const noexcept {
+        return compute_hash<PieceColor::WHITE>() ^
+               compute_hash<PieceColor::BLACK>();
+    }
+
+    constexpr std::uint64_t compute_pawn_hash() const noexcept {
+        return compute_hash<PieceColor::WHITE, PieceType::PAWN>() ^
+               compute_hash<PieceColor::BLACK, PieceType::PAWN>();
+    }
+
+    // The same position with the colors swapped and the board mirrored top
+    // to bottom, as seen by the other side. The scores are negated and the
+    // hashes rotated (see make_zobrist_keys), so nothing is recomputed.
+    constexpr ChessBoard flipped() const noexcept {
+        ChessBoard result = *this;
+        result.white_king = black_king.flip_vertical();
+        result.white_queen = black_queen.flip_vertical();
+        result.white_rook = black_rook.flip_vertical();
+        result.white_bishop = black_bishop.flip_vertical();
+        result.white_knight = black_knight.flip_vertical();
+        result.white_pawn = black_pawn.flip_vertical();
+        result.black_king = white_king.flip_vertical();
+        result.black_queen = white_queen.flip_vertical();
+        result.black_rook = white_rook.flip_vertical();
+        result.black_bishop = white_bishop.flip_vertical();
+        result.black_knight = white_knight.flip_vertical();
+        result.black_pawn = white_pawn.flip_vertical();
+        result.white_pieces = black_pieces.flip_vertical();
+        result.black_pieces = white_pieces.flip_vertical();
+        result.all_pieces = all_pieces.flip_vertical();
+        result.scores = {-scores.midgame, -scores.endgame, scores.phase};
+        result.hash = std::rotl(hash, 32);
+        result.pawn_hash = std::rotl(pawn_hash, 32);
+        return result;
+    }
+
+    // Hash of the position as seen by COLOR, the side to move. A position
+    // and its color-flipped twin with the other side to move have the same
+    // normalized hash, so caches keyed by it serve both.
+    template <PieceColor COLOR>
+    constexpr std::uint64_t normalized_hash() const noexcept {
+        if constexpr (COLOR == PieceColor::WHITE) {
+            return hash;
+        } else {
+            return std::rotl(hash, 32);
+        }
+    }
+
     constexpr bool is_occupied(std::uint64_t square) const noexcept {
         return all_pieces.is_set(square);
     }
@@ -106,6 +242,15 @@ public:
     }
 
     constexpr void clear_square(std::uint64_t square) noexcept {
+        if (white_pieces.is_set(square)) {
+            toggle_piece<PieceColor::WHITE>(
+                piece_type_at<PieceColor::WHITE>(square), square, false
+            );
+        } else if (black_pieces.is_set(square)) {
+            toggle_piece<PieceColor::BLACK>(
+                piece_type_at<PieceColor::BLACK>(square), square, false
+            );
+        }
         const BitBoard mask{~(UINT64_C(1) << square)};
         white_king &= mask;
         white_queen &= mask;
@@ -127,6 +272,9 @@ public:
     template <PieceColor COLOR, PieceType TYPE>
     constexpr void add_piece(std::uint64_t square) noexcept {
         const BitBoard piece{UINT64_C(1) << square};
+        if (!has_piece<COLOR, TYPE>(square)) {
+            toggle_piece<COLOR>(TYPE, square, true);
+        }
         all_pieces |= piece;
         if constexpr (COLOR == PieceColor::WHITE) {
             white_pieces |= piece;
@@ -166,6 +314,80 @@ public:
         return get_piece<COLOR, TYPE>().popcount();
     }
 
+    template <PieceColor COLOR>
+    constexpr void add_piece(PieceType type, std::uint64_t square) noexcept {
+        using enum PieceType;
+        switch (type) {
+            case KING  : { add_piece<COLOR, KING  >(square); break; }
+            case QUEEN : { add_piece<COLOR, QUEEN >(square); break; }
+            case ROOK  : { add_piece<COLOR, ROOK  >(square); break; }
+            case BISHOP: { add_piece<COLOR, BISHOP>(square); break; }
+            case KNIGHT: { add_piece<COLOR, KNIGHT>(square); break; }
+            case PAWN  : { add_piece<COLOR, PAWN  >(square); break; }
+        }
+    }
+
+    // Returns the type of the piece of the given color on the given square.
+    // The square is assumed to be occupied by a piece of that color.
+    template <PieceColor COLOR>
+    constexpr PieceType piece_type_at(std::uint64_t square) const noexcept {
+        using enum PieceType;
+        if (has_piece<COLOR, PAWN  >(square)) { return PAWN  ; }
+        if (has_piece<COLOR, KNIGHT>(square)) { return KNIGHT; }
+        if (has_piece<COLOR, BISHOP>(square)) { return BISHOP; }
+        if (has_piece<COLOR, ROOK  >(square)) { return ROOK  ; }
+        if (has_piece<COLOR, QUEEN >(square)) { return QUEEN ; }
+        return KING;
+    }
+
+    template <PieceColor COLOR>
+    constexpr ChessBoard after_move(const ChessMove &move) const noexcept {
+        ChessBoard next = *this;
+        next.clear_square(move.src);
+        next.clear_square(move.dst);
+        next.add_piece<COLOR>(move.dst_type, move.dst);
+        return next;
+    }
+
+    template <PieceColor COLOR>
+    constexpr bool has_non_pawn_material() const noexcept {
+        return !(get_piece<COLOR, PieceType::QUEEN >() |
+                 get_piece<COLOR, PieceType::ROOK  >() |
+                 get_piece<COLOR, PieceType::BISHOP>() |
+                 get_piece<COLOR, PieceType::KNIGHT>()).is_empty();
+    }
+
+    // Returns true if any piece of the given color attacks the given square.
+    template <PieceColor COLOR>
+    constexpr bool is_attacked_by(std::uint64_t square) const noexcept {
+        constexpr PieceColor OTHER = other(COLOR);
+        const BitBoard none{0};
+        const BitBoard diagonal = get_piece<COLOR, PieceType::QUEEN >() |
+                                  get_piece<COLOR, PieceType::BISHOP>();
+        const BitBoard straight = get_piece<COLOR, PieceType::QUEEN>() |
+                                  get_piece<COLOR, PieceType::ROOK >();
+        // Pawns of COLOR attack the square exactly when a pawn of the
+        // other color standing on it would attack them.
+        const BitBoard pawn_attackers{(OTHER == PieceColor::WHITE)
+            ? WHITE_PAWN_CAPTURE_TABLE[square]
+            : BLACK_PAWN_CAPTURE_TABLE[square]};
+        return !((all_pieces.knight_moves(square, none) &
+                  get_piece<COLOR, PieceType::KNIGHT>()) |
+                 (all_pieces.king_moves(square, none) &
+                  get_piece<COLOR, PieceType::KING>()) |
+                 (all_pieces.bishop_moves(square, none) & diagonal) |
+                 (all_pieces.rook_moves(square, none) & straight) |
+                 (pawn_attackers & get_piece<COLOR, PieceType::PAWN>())
+                ).is_empty();
+    }
+
+    template <PieceColor COLOR>
+    constexpr bool in_check() const noexcept {
+        const BitBoard king = get_piece<COLOR, PieceType::KING>();
+        if (king.is_empty()) { return false; }
+        return is_attacked_by<other(COLOR)>(*king.begin());
+    }
+
     template <template <PieceColor, int> typename Visitor,
               PieceColor COLOR, int DEPTH, PieceType TYPE>
     constexpr void visit_piece_moves(
@@ -315,6 +537,206 @@ public:
         return v.get_result();
     }
 
+    // Traversal with the depth as a runtime argument. The template version
+    // above instantiates every function for each depth; here, interior
+    // nodes use Visitor<COLOR, 1> at any depth and leaves use
+    // Visitor<COLOR, 0>::visit, so there is one instantiation per color.
+    // Visitors must behave the same at every nonzero DEPTH.
+    // Leaves are evaluated at the call site, where the leaf visitor can be
+    // inlined, rather than behind a call to visit_to_depth.
+    template <template <PieceColor, int> typename Visitor, PieceColor COLOR>
+    static constexpr typename Visitor<COLOR, 1>::result_type
+    visit_child(const ChessBoard &next, int depth) noexcept {
+        if (depth <= 0) { return Visitor<COLOR, 0>::visit(next); }
+        return next.visit_to_depth<Visitor, COLOR>(depth);
+    }
+
+    template <template <PieceColor, int> typename Visitor,
+              PieceColor COLOR, PieceType TYPE>
+    constexpr void visit_piece_moves_to_depth(
+        Visitor<COLOR, 1> &visitor, int depth
+    ) const noexcept {
+        for (const std::uint64_t src : get_piece<COLOR, TYPE>()) {
+            const BitBoard destinations =
+                all_pieces.moves<COLOR, TYPE>(src, get_pieces<COLOR>());
+            for (const std::uint64_t dst : destinations) {
+                ChessBoard next = *this;
+                next.clear_square(src);
+                next.clear_square(dst);
+                next.add_piece<COLOR, TYPE>(dst);
+                visitor.template visit<TYPE>(
+                    *this, next, src, dst,
+                    visit_child<Visitor, other(COLOR)>(next, depth - 1)
+                );
+            }
+        }
+    }
+
+    template <template <PieceColor, int> typename Visitor,
+              PieceColor COLOR, PieceType TYPE>
+    constexpr void visit_promotion_to_depth(
+        Visitor<COLOR, 1> &visitor, std::uint64_t src, std::uint64_t dst,
+        int depth
+    ) const noexcept {
+        ChessBoard next = *this;
+        next.clear_square(src);
+        next.clear_square(dst);
+        next.add_piece<COLOR, TYPE>(dst);
+        visitor.template visit_promotion<TYPE>(
+            *this, next, src, dst,
+            visit_child<Visitor, other(COLOR)>(next, depth - 1)
+        );
+    }
+
+    template <template <PieceColor, int> typename Visitor, PieceColor COLOR>
+    constexpr void visit_pawn_moves_to_depth(
+        Visitor<COLOR, 1> &visitor, int depth
+    ) const noexcept {
+        using enum PieceType;
+        constexpr std::uint64_t PROMOTING_RANK =
+            (COLOR == PieceColor::WHITE) ? 6 : 1;
+        for (const std::uint64_t src : get_piece<COLOR, PAWN>()) {
+            const BitBoard destinations =
+                all_pieces.moves<COLOR, PAWN>(src, get_pieces<COLOR>());
+            for (const std::uint64_t dst : destinations) {
+                if ((src >> 3) == PROMOTING_RANK) {
+                    visit_promotion_to_depth<Visitor, COLOR, QUEEN >(
+                        visitor, src, dst, depth);
+                    visit_promotion_to_depth<Visitor, COLOR, ROOK  >(
+                        visitor, src, dst, depth);
+                    visit_promotion_to_depth<Visitor, COLOR, BISHOP>(
+                        visitor, src, dst, depth);
+                    visit_promotion_to_depth<Visitor, COLOR, KNIGHT>(
+                        visitor, src, dst, depth);
+                } else {
+                    ChessBoard next = *this;
+                    next.clear_square(src);
+                    next.clear_square(dst);
+                    next.add_piece<COLOR, PAWN>(dst);
+                    visitor.template visit<PAWN>(
+                        *this, next, src, dst,
+                        visit_child<Visitor, other(COLOR)>(next, depth - 1)
+                    );
+                }
+            }
+        }
+    }
+
+    template <template <PieceColor, int> typename Visitor, PieceColor COLOR>
+    constexpr typename Visitor<COLOR, 1>::result_type
+    visit_to_depth(int depth) const noexcept {
+        using enum PieceType;
+        if (depth <= 0) { return Visitor<COLOR, 0>::visit(*this); }
+        Visitor<COLOR, 1> v{};
+        visit_piece_moves_to_depth<Visitor, COLOR, KING  >(v, depth);
+        visit_piece_moves_to_depth<Visitor, COLOR, QUEEN >(v, depth);
+        visit_piece_moves_to_depth<Visitor, COLOR, ROOK  >(v, depth);
+        visit_piece_moves_to_depth<Visitor, COLOR, BISHOP>(v, depth);
+        visit_piece_moves_to_depth<Visitor, COLOR, KNIGHT>(v, depth);
+        visit_pawn_moves_to_depth <Visitor, COLOR        >(v, depth);
+        return v.get_result();
+    }
+
+    // Returns the score of a child from the point of view of its parent.
+    // By symmetry, a leaf scored before flipping gives the same result as
+    // one flipped, scored, and negated, so leaves are never flipped.
+    template <template <PieceColor, int> typename Visitor>
+    static constexpr typename Visitor<PieceColor::WHITE, 1>::result_type
+    visit_child_flipped(const ChessBoard &next, int depth) noexcept {
+        if (depth <= 0) { return Visitor<PieceColor::WHITE, 0>::visit(next); }
+        return -next.flipped().visit_flipped<Visitor>(depth);
+    }
+
+    template <template <PieceColor, int> typename Visitor, PieceType TYPE>
+    constexpr void visit_piece_moves_flipped(
+        Visitor<PieceColor::WHITE, 1> &visitor, int depth
+    ) const noexcept {
+        constexpr PieceColor WHITE = PieceColor::WHITE;
+        for (const std::uint64_t src : get_piece<WHITE, TYPE>()) {
+            const BitBoard destinations =
+                all_pieces.moves<WHITE, TYPE>(src, get_pieces<WHITE>());
+            for (const std::uint64_t dst : destinations) {
+                ChessBoard next = *this;
+                next.clear_square(src);
+                next.clear_square(dst);
+                next.add_piece<WHITE, TYPE>(dst);
+                visitor.template visit<TYPE>(
+                    *this, next, src, dst,
+                    visit_child_flipped<Visitor>(next, depth - 1)
+                );
+            }
+        }
+    }
+
+    template <template <PieceColor, int> typename Visitor, PieceType TYPE>
+    constexpr void visit_promotion_flipped(
+        Visitor<PieceColor::WHITE, 1> &visitor,
+        std::uint64_t src, std::uint64_t dst, int depth
+    ) const noexcept {
+        ChessBoard next = *this;
+        next.clear_square(src);
+        next.clear_square(dst);
+        next.add_piece<PieceColor::WHITE, TYPE>(dst);
+        visitor.template visit_promotion<TYPE>(
+            *this, next, src, dst,
+            visit_child_flipped<Visitor>(next, depth - 1)
+        );
+    }
+
+    template <template <PieceColor, int> typename Visitor>
+    constexpr void visit_pawn_moves_flipped(
+        Visitor<PieceColor::WHITE, 1> &visitor, int depth
+    ) const noexcept {
+        using enum PieceType;
+        constexpr PieceColor WHITE = PieceColor::WHITE;
+        for (const std::uint64_t src : get_piece<WHITE, PAWN>()) {
+            const BitBoard destinations =
+                all_pieces.moves<WHITE, PAWN>(src, get_pieces<WHITE>());
+            for (const std::uint64_t dst : destinations) {
+                if ((src >> 3) == 6) {
+                    visit_promotion_flipped<Visitor, QUEEN >(
+                        visitor, src, dst, depth);
+                    visit_promotion_flipped<Visitor, ROOK  >(
+                        visitor, src, dst, depth);
+                    visit_promotion_flipped<Visitor, BISHOP>(
+                        visitor, src, dst, depth);
+                    visit_promotion_flipped<Visitor, KNIGHT>(
+                        visitor, src, dst, depth);
+                } else {
+                    ChessBoard next = *this;
+                    next.clear_square(src);
+                    next.clear_square(dst);
+                    next.add_piece<WHITE, PAWN>(dst);
+                    visitor.template visit<PAWN>(
+                        *this, next, src, dst,
+                        visit_child_flipped<Visitor>(next, depth - 1)
+                    );
+                }
+            }
+        }
+    }
+
+    // Negamax traversal in which the side to move is always white: after
+    // each move the board is flipped, so only white moves are ever
+    // generated and one instantiation of Visitor<WHITE, 1> serves every
+    // node. Results are therefore from the point of view of the side to
+    // move, which requires a color-symmetric evaluator whose result type
+    // can be negated. Interior nodes are visited as in visit_to_depth.
+    template <template <PieceColor, int> typename Visitor>
+    constexpr typename Visitor<PieceColor::WHITE, 1>::result_type
+    visit_flipped(int depth) const noexcept {
+        using enum PieceType;
+        if (depth <= 0) { return Visitor<PieceColor::WHITE, 0>::visit(*this); }
+        Visitor<PieceColor::WHITE, 1> v{};
+        visit_piece_moves_flipped<Visitor, KING  >(v, depth);
+        visit_piece_moves_flipped<Visitor, QUEEN >(v, depth);
+        visit_piece_moves_flipped<Visitor, ROOK  >(v, depth);
+        visit_piece_moves_flipped<Visitor, BISHOP>(v, depth);
+        visit_piece_moves_flipped<Visitor, KNIGHT>(v, depth);
+        visit_pawn_moves_flipped <Visitor        >(v, depth);
+        return v.get_result();
+    }
+
 }; // class ChessBoard
 
 
@@ -36,6 +36,14 @@ template <> constexpr const char *TYPE_NAME<PieceType::KNIGHT> = "knight";
 template <> constexpr const char *TYPE_NAME<PieceType::PAWN  > = "pawn"  ;
 
 
+struct ChessMove {
+    std::uint64_t src;
+    std::uint64_t dst;
+    PieceType src_type;
+    PieceType dst_type;
+};
+
+
 constexpr std::array<char, 3> square_name(std::uint64_t square) noexcept {
     return {
         static_cast<char>('a' + (square % 8)),
@@ -1,72 +1,37 @@
-#include <climits>  // for INT_MIN, INT_MAX
+#include <chrono>   // for std::chrono::steady_clock
+#include <cstddef>  // for std::size_t
 #include <cstdint>  // for std::uint64_t
+#include <cstdio>   // for std::fwrite, std::fflush, stdout
+#include <fstream>
 #include <iostream>
+#include <map>
 #include <sstream>
+#include <streambuf>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 #include "ChessPiece.hpp"
 #include "ChessBoard.hpp"
 #include "MoveNaming.hpp"
+#include "Evaluation.hpp"
+#include "Search.hpp"
+#include "NNUE.hpp"
+#include "Fen.hpp"
+#include "UCI.hpp"
+#include "AnalysisServer.hpp"
+#include "MateSolver.hpp"
+#include "MonteCarlo.hpp"
+#include "ParseNumber.hpp"
+#include "ThreadPool.hpp"
 
 
 using DZChess::PieceColor, DZChess::PieceType, DZChess::ChessBoard;
-
-
-template <PieceColor COLOR, int DEPTH>
-struct MaterialisticEvaluationVisitor {
-
-    int accumulator;
-
-    using result_type = int;
-
-    static constexpr result_type visit(const ChessBoard &b) noexcept {
-        if (b.piece_count<PieceColor::WHITE, PieceType::KING>() == 0)
-            return -1'000'000;
-        if (b.piece_count<PieceColor::BLACK, PieceType::KING>() == 0)
-            return +1'000'000;
-        return (+ 900 * b.piece_count<PieceColor::WHITE, PieceType::QUEEN >()
-                + 500 * b.piece_count<PieceColor::WHITE, PieceType::ROOK  >()
-                + 300 * b.piece_count<PieceColor::WHITE, PieceType::BISHOP>()
-                + 300 * b.piece_count<PieceColor::WHITE, PieceType::KNIGHT>()
-                + 100 * b.piece_count<PieceColor::WHITE, PieceType::PAWN  >()
-                - 900 * b.piece_count<PieceColor::BLACK, PieceType::QUEEN >()
-                - 500 * b.piece_count<PieceColor::BLACK, PieceType::ROOK  >()
-                - 300 * b.piece_count<PieceColor::BLACK, PieceType::BISHOP>()
-                - 300 * b.piece_count<PieceColor::BLACK, PieceType::KNIGHT>()
-                - 100 * b.piece_count<PieceColor::BLACK, PieceType::PAWN  >());
-    }
-
-    explicit constexpr MaterialisticEvaluationVisitor() noexcept
-        : accumulator((COLOR == PieceColor::WHITE) ? INT_MIN : INT_MAX) {}
-
-    template <PieceType TYPE>
-    constexpr void visit(const ChessBoard &, const ChessBoard &,
-                         std::uint64_t, std::uint64_t,
-                         result_type result) noexcept {
-        if constexpr (COLOR == PieceColor::WHITE) {
-            accumulator = std::max(accumulator, result);
-        } else if constexpr (COLOR == PieceColor::BLACK) {
-            accumulator = std::min(accumulator, result);
-        }
-    }
-
-    template <PieceType TYPE>
-    constexpr void visit_promotion(const ChessBoard &, const ChessBoard &,
-                                   std::uint64_t, std::uint64_t,
-                                   result_type result) noexcept {
-        if constexpr (COLOR == PieceColor::WHITE) {
-            accumulator = std::max(accumulator, result);
-        } else if constexpr (COLOR == PieceColor::BLACK) {
-            accumulator = std::min(accumulator, result);
-        }
-    }
-
-    constexpr result_type get_result() const noexcept {
-        return accumulator;
-    }
-
-}; // struct MaterialisticEvaluationVisitor
+using DZChess::MaterialisticEvaluationVisitor;
+using DZChess::PositionalEvaluationVisitor, DZChess::NNUEEvaluationVisitor;
+using DZChess::SearchOptions, DZChess::SearchResult, DZChess::Searcher;
+using DZChess::PositionState, DZChess::parse_number;
 
 
 void print_board(const ChessBoard &board) {
@@ -115,6 +80,7 @@ void handle_add_command(ChessBoard &b,
         const std::uint64_t square =
             static_cast<std::uint64_t>(tok[3][0] - 'a') |
             (static_cast<std::uint64_t>(tok[3][1] - '1') << 3);
+        b.clear_square(square);
         if (tok[1] == "white") {
             if      (tok[2] == "king"  ) b.add_piece<WHITE, KING  >(square);
             else if (tok[2] == "queen" ) b.add_piece<WHITE, QUEEN >(square);
@@ -180,139 +146,715 @@ void handle_ls_command(ChessBoard &board,
 }
 
 
-void handle_move_command(ChessBoard &board,
+// Plays the move of COLOR with the given name and updates the state as the
+// move changes the game: the halfmove clock restarts after captures and
+// pawn moves, a double pawn push sets the en passant square, and castling
+// rights whose king or rook has left its square are dropped.
+template <PieceColor COLOR>
+void play_named_move(ChessBoard &board, PositionState &state,
+                     const std::string &name) {
+    DZChess::MoveList moves{};
+    DZChess::generate_moves<COLOR>(board, moves);
+    const DZChess::ChessMove *found = nullptr;
+    for (const DZChess::ChessMove &move : moves) {
+        if (DZChess::move_name(board, move, moves) != name) { continue; }
+        if (found != nullptr) {
+            std::cout << "ERROR: found two moves with same name" << std::endl;
+        }
+        found = &move;
+    }
+    if (found == nullptr) {
+        std::cout << "ERROR: move not found for "
+                  << ((COLOR == PieceColor::WHITE) ? "white" : "black")
+                  << std::endl;
+        return;
+    }
+    const DZChess::ChessMove &move = *found;
+    const bool pawn_move = (move.src_type == PieceType::PAWN);
+    state.halfmove_clock = (board.is_occupied(move.dst) || pawn_move)
+        ? 0 : state.halfmove_clock + 1;
+    const bool double_push = pawn_move &&
+        ((move.src + 16 == move.dst) || (move.dst + 16 == move.src));
+    state.en_passant = double_push ? static_cast<int>(move.src + move.dst) / 2
+                                   : DZChess::NO_EN_PASSANT;
+    if (COLOR == PieceColor::BLACK) { ++state.fullmove_number; }
+    state.side_to_move = DZChess::other(COLOR);
+    board = board.after_move<COLOR>(move);
+    state.castling_rights =
+        DZChess::possible_castling_rights(board, state.castling_rights);
+}
+
+
+void handle_move_command(ChessBoard &board, PositionState &state,
                          const std::vector<std::string> &tokens) {
-    if (tokens.size() == 3) {
-        if (tokens[1] == "white") {
-            bool found = false;
-            for (const auto &[name, next] :
-                 available_moves_and_names<PieceColor::WHITE>(board)) {
-                if (name == tokens[2]) {
-                    board = next;
-                    if (found) {
-                        std::cout << "ERROR: found two moves with same name"
-                                  << std::endl;
-                    }
-                    found = true;
-                }
+    if ((tokens.size() == 3) && (tokens[1] == "white")) {
+        play_named_move<PieceColor::WHITE>(board, state, tokens[2]);
+    } else if ((tokens.size() == 3) && (tokens[1] == "black")) {
+        play_named_move<PieceColor::BLACK>(board, state, tokens[2]);
+    } else {
+        std::cout << "invalid syntax for move command" << std::endl;
+    }
+}
+
+
+// Shared by commands that spread independent work over all cores.
+DZChess::ThreadPool &thread_pool() {
+    static DZChess::ThreadPool pool{};
+    return pool;
+}
+
+
+// Scores every root move with an exhaustive depth-5 search. The subtrees
+// are independent, so they are searched concurrently, and the scores are
+// stored by move index so that the output keeps the move order.
+template <PieceColor COLOR>
+void run_eval(const ChessBoard &board) {
+    const auto children = DZChess::available_moves_and_names<COLOR>(board);
+    std::vector<int> scores(children.size());
+    std::vector<double> seconds(children.size());
+    DZChess::ThreadPool &pool = thread_pool();
+    const auto start = std::chrono::steady_clock::now();
+    pool.parallel_for(children.size(), [&](std::size_t i, std::size_t) {
+        const auto move_start = std::chrono::steady_clock::now();
+        scores[i] = children[i].second.template visit<
+            MaterialisticEvaluationVisitor, other(COLOR), 5>();
+        seconds[i] = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - move_start).count();
+    });
+    const auto stop = std::chrono::steady_clock::now();
+    const double wall = std::chrono::duration<double>(stop - start).count();
+
+    std::vector<std::string> best_moves{};
+    int best_score = 0;
+    double total = 0.0;
+    for (std::size_t i = 0; i < children.size(); ++i) {
+        const std::string &name = children[i].first;
+        const int score = scores[i];
+        total += seconds[i];
+        std::cout << name << " : " << score << std::endl;
+        const bool better = (COLOR == PieceColor::WHITE)
+            ? (score > best_score) : (score < best_score);
+        if (best_moves.empty() || better) {
+            best_moves.clear();
+            best_moves.push_back(name);
+            best_score = score;
+        } else if (score == best_score) {
+            best_moves.push_back(name);
+        }
+    }
+    std::cout << std::endl;
+    std::cout << "Best moves: ";
+    for (const auto &name : best_moves) {
+        std::cout << name << ", ";
+    }
+    std::cout << std::endl;
+    std::cout << "Time: " << wall << " s on " << pool.size()
+              << " threads (" << total / wall << "x speedup)" << std::endl;
+}
+
+
+void handle_eval_command(ChessBoard &board,
+                         const std::vector<std::string> &tokens) {
+    if ((tokens.size() == 2) && (tokens[1] == "white")) {
+        run_eval<PieceColor::WHITE>(board);
+    } else if ((tokens.size() == 2) && (tokens[1] == "black")) {
+        run_eval<PieceColor::BLACK>(board);
+    } else {
+        std::cout << "invalid syntax for eval command" << std::endl;
+    }
+}
+
+
+// Shared by every search, and cleared whenever the evaluator changes.
+DZChess::EvaluationCache &evaluation_cache() {
+    static DZChess::EvaluationCache cache{18};
+    return cache;
+}
+
+
+DZChess::TranspositionTable &transposition_table() {
+    static DZChess::TranspositionTable table{64};
+    return table;
+}
+
+
+DZChess::Tablebases &tablebases() {
+    static DZChess::Tablebases tables{};
+    return tables;
+}
+
+
+template <template <PieceColor, int> typename Visitor, PieceColor COLOR>
+void run_search(const ChessBoard &board, const PositionState &state,
+                const SearchOptions &options, int depth,
+                std::size_t line_count) {
+    Searcher<Visitor> searcher{};
+    searcher.options = options;
+    searcher.evaluation_cache = &evaluation_cache();
+    searcher.transposition_table = &transposition_table();
+    searcher.tablebases = &tablebases();
+    searcher.halfmove_clock = static_cast<int>(state.halfmove_clock);
+    DZChess::PawnHashTable &pawn_table = DZChess::pawn_hash_table();
+    pawn_table.reset_statistics();
+    DZChess::AttackStatistics &attacks = DZChess::attack_statistics();
+    attacks = {};
+    const auto start = std::chrono::steady_clock::now();
+    const std::vector<SearchResult> lines =
+        searcher.template search_lines<COLOR>(
+        board, depth, line_count,
+        [&](const std::vector<SearchResult> &iteration) {
+            for (std::size_t i = 0; i < iteration.size(); ++i) {
+                std::cout << "depth " << iteration[i].depth;
+                if (line_count > 1) { std::cout << " line " << i + 1; }
+                std::cout << " score " << iteration[i].score << " pv "
+                          << DZChess::variation_name<COLOR>(
+                                 board, iteration[i].principal_variation)
+                          << std::endl;
             }
-            if (!found) {
-                std::cout << "ERROR: move not found for white" << std::endl;
+        }
+    );
+    const SearchResult &result = lines.front();
+    const auto stop = std::chrono::steady_clock::now();
+    const double seconds = std::chrono::duration<double>(stop - start).count();
+    const auto &stats = searcher.statistics;
+    const std::uint64_t total = stats.nodes + stats.quiescence_nodes;
+    DZChess::MoveList moves{};
+    DZChess::generate_legal_moves<COLOR>(board, moves);
+    if (moves.empty()) {
+        std::cout << "No legal move: "
+                  << (board.in_check<COLOR>() ? "checkmate" : "stalemate")
+                  << " (score " << result.score << ")" << std::endl;
+        return;
+    }
+    std::cout << "Best move: "
+              << DZChess::move_name<COLOR>(board, result.best_move)
+              << " (score " << result.score
+              << ", depth " << result.depth << ")" << std::endl;
+    std::cout << "Principal variation: "
+              << DZChess::variation_name<COLOR>(
+                     board, result.principal_variation)
+              << std::endl;
+    for (std::size_t i = 1; i < lines.size(); ++i) {
+        std::cout << "Line " << i + 1 << ": "
+                  << DZChess::variation_name<COLOR>(
+                         board, lines[i].principal_variation)
+                  << " (score " << lines[i].score << ")" << std::endl;
+    }
+    std::cout << "    Nodes: " << stats.nodes
+              << " (+" << stats.quiescence_nodes << " quiescence)"
+              << std::endl;
+    std::cout << "    Time: " << seconds << " s ("
+              << static_cast<double>(total) / seconds << " nodes/s)"
+              << std::endl;
+    std::cout << "    Null-move cutoffs: " << stats.null_move_cutoffs
+              << std::endl;
+    std::cout << "    Late move reductions: " << stats.late_move_reductions
+              << " (" << stats.late_move_researches << " re-searched)"
+              << std::endl;
+    std::cout << "    Futility prunes: " << stats.futility_prunes
+              << std::endl;
+    std::cout << "    Razoring cutoffs: " << stats.razoring_cutoffs
+              << std::endl;
+    std::cout << "    PVS re-searches: "
+              << stats.principal_variation_researches << std::endl;
+    std::cout << "    Aspiration re-searches: "
+              << stats.aspiration_researches << std::endl;
+    std::cout << "    SEE prunes: " << stats.static_exchange_prunes
+              << std::endl;
+    if (attacks.maps > 0) {
+        const auto maps = static_cast<double>(attacks.maps);
+        std::cout << "    Magic lookups per node: "
+                  << static_cast<double>(attacks.lookups) / maps
+                  << " (" << static_cast<double>(attacks.lookups_saved) / maps
+                  << " saved by attack maps)" << std::endl;
+    }
+    if (pawn_table.probes > 0) {
+        std::cout << "    Pawn hash hit rate: "
+                  << 100.0 * pawn_table.hit_rate() << "% of "
+                  << pawn_table.probes << " probes" << std::endl;
+    }
+    if (stats.draws > 0) {
+        std::cout << "    Draws by repetition or fifty-move rule: "
+                  << stats.draws << std::endl;
+    }
+    if (stats.tablebase_hits > 0) {
+        std::cout << "    Tablebase hits: " << stats.tablebase_hits
+                  << std::endl;
+    }
+    if (stats.bitbase_hits > 0) {
+        std::cout << "    KPK bitbase hits: " << stats.bitbase_hits
+                  << std::endl;
+    }
+    if (stats.transposition_probes > 0) {
+        std::cout << "    Transposition table hit rate: "
+                  << 100.0 * static_cast<double>(stats.transposition_hits)
+                           / static_cast<double>(stats.transposition_probes)
+                  << "% (" << stats.transposition_cutoffs << " cutoffs)"
+                  << std::endl;
+    }
+    if (stats.evaluation_cache_probes > 0) {
+        std::cout << "    Evaluation cache hit rate: "
+                  << 100.0 * static_cast<double>(stats.evaluation_cache_hits)
+                           / static_cast<double>(stats.evaluation_cache_probes)
+                  << "% of " << stats.evaluation_cache_probes << " probes"
+                  << std::endl;
+    }
+}
+
+
+void handle_search_command(const ChessBoard &board,
+                           const PositionState &state,
+                           const SearchOptions &options,
+                           const std::vector<std::string> &tokens) {
+    // search <color> <depth> [lines]
+    int depth = 0;
+    std::size_t lines = 1;
+    if (((tokens.size() == 3) || (tokens.size() == 4)) &&
+        parse_number(tokens[2], depth) && (depth >= 1) &&
+        (depth < DZChess::MAX_PLY) &&
+        ((tokens.size() == 3) || parse_number(tokens[3], lines)) &&
+        (lines >= 1)) {
+        const bool nnue = static_cast<bool>(DZChess::active_nnue_network());
+        if (tokens[1] == "white") {
+            if (nnue) {
+                run_search<NNUEEvaluationVisitor, PieceColor::WHITE>(
+                    board, state, options, depth, lines);
+            } else {
+                run_search<PositionalEvaluationVisitor, PieceColor::WHITE>(
+                    board, state, options, depth, lines);
             }
         } else if (tokens[1] == "black") {
-            bool found = false;
-            for (const auto &[name, next] :
-                 available_moves_and_names<PieceColor::BLACK>(board)) {
-                if (name == tokens[2]) {
-                    board = next;
-                    if (found) {
-                        std::cout << "ERROR: found two moves with same name"
-                                  << std::endl;
-                    }
-                    found = true;
-                }
-            }
-            if (!found) {
-                std::cout << "ERROR: move not found for black" << std::endl;
+            if (nnue) {
+                run_search<NNUEEvaluationVisitor, PieceColor::BLACK>(
+                    board, state, options, depth, lines);
+            } else {
+                run_search<PositionalEvaluationVisitor, PieceColor::BLACK>(
+                    board, state, options, depth, lines);
             }
         } else {
-            std::cout << "invalid syntax for move command" << std::endl;
+            std::cout << "invalid syntax for search command" << std::endl;
         }
     } else {
-        std::cout << "invalid syntax for move command" << std::endl;
+        std::cout << "invalid syntax for search command" << std::endl;
     }
 }
 
 
-void handle_eval_command(ChessBoard &board,
+DZChess::MateSolver &mate_solver() {
+    static DZChess::MateSolver solver{64};
+    return solver;
+}
+
+
+template <PieceColor COLOR>
+void run_mate(const ChessBoard &board, int moves) {
+    DZChess::MateSolver &solver = mate_solver();
+    solver.clear();
+    const auto start = std::chrono::steady_clock::now();
+    const DZChess::MateResult result = solver.solve<COLOR>(board, moves);
+    const auto stop = std::chrono::steady_clock::now();
+    const double seconds = std::chrono::duration<double>(stop - start).count();
+    if (result.found) {
+        std::cout << "Mate in " << result.moves << ": "
+                  << DZChess::variation_name<COLOR>(
+                         board, result.principal_variation)
+                  << std::endl;
+    } else {
+        std::cout << "No mate in " << moves << std::endl;
+    }
+    std::cout << "    Nodes: " << result.nodes << std::endl;
+    std::cout << "    Time: " << seconds << " s ("
+              << static_cast<double>(result.nodes) / seconds << " nodes/s)"
+              << std::endl;
+    std::cout << "    Table usage: " << solver.entries_used() << " of "
+              << solver.capacity() << " entries ("
+              << (solver.memory_bytes() >> 20) << " MB)" << std::endl;
+}
+
+
+void handle_mate_command(const ChessBoard &board,
+                         const PositionState &state,
                          const std::vector<std::string> &tokens) {
-    if (tokens.size() == 2) {
+    // mate [color] <moves>
+    if ((tokens.size() == 2) || (tokens.size() == 3)) {
+        const std::string color = (tokens.size() == 3) ? tokens[1]
+            : (state.side_to_move == PieceColor::WHITE) ? "white" : "black";
+        int moves = 0;
+        if (!parse_number(tokens.back(), moves) || (moves < 1)) {
+            std::cout << "invalid syntax for mate command" << std::endl;
+        } else if (color == "white") {
+            run_mate<PieceColor::WHITE>(board, moves);
+        } else if (color == "black") {
+            run_mate<PieceColor::BLACK>(board, moves);
+        } else {
+            std::cout << "invalid syntax for mate command" << std::endl;
+        }
+    } else {
+        std::cout << "invalid syntax for mate command" << std::endl;
+    }
+}
+
+
+template <template <PieceColor, int> typename Visitor>
+DZChess::MonteCarloSearcher<Visitor> &monte_carlo_searcher() {
+    static DZChess::MonteCarloSearcher<Visitor> searcher{256};
+    return searcher;
+}
+
+
+template <template <PieceColor, int> typename Visitor, PieceColor COLOR>
+void run_monte_carlo(const ChessBoard &board, std::uint64_t iterations,
+                     int rollout_plies) {
+    auto &searcher = monte_carlo_searcher<Visitor>();
+    searcher.options.rollout_plies = rollout_plies;
+    searcher.limits.iterations = iterations;
+    DZChess::ThreadPool &pool = thread_pool();
+    const auto start = std::chrono::steady_clock::now();
+    const SearchResult result = searcher.template search<COLOR>(board, pool);
+    const auto stop = std::chrono::steady_clock::now();
+    const double seconds = std::chrono::duration<double>(stop - start).count();
+    const auto &stats = searcher.statistics;
+    if (result.principal_variation.empty()) {
+        std::cout << "No legal moves" << std::endl;
+        return;
+    }
+    std::cout << "Best move: "
+              << DZChess::move_name<COLOR>(board, result.best_move)
+              << " (score " << result.score << ")" << std::endl;
+    std::cout << "Principal variation: "
+              << DZChess::variation_name<COLOR>(
+                     board, result.principal_variation)
+              << std::endl;
+    std::cout << "    Iterations: " << stats.iterations << " on "
+              << pool.size() << " threads" << std::endl;
+    std::cout << "    Time: " << seconds << " s ("
+              << static_cast<double>(stats.iterations) / seconds
+              << " iterations/s)" << std::endl;
+    std::cout << "    Tree: " << stats.tree_nodes << " nodes, "
+              << static_cast<double>(stats.tree_bytes) / (1 << 20)
+              << " MB of " << (searcher.memory_bytes() >> 20) << " MB"
+              << (stats.tree_full ? " (full)" : "") << std::endl;
+}
 
-        std::vector<std::string> best_moves{};
-        int best_score = 0;
 
+void handle_mcts_command(const ChessBoard &board,
+                         const std::vector<std::string> &tokens) {
+    // mcts <color> <iterations> [rollout plies]. The REPL has no way to stop
+    // a search, so it must have an iteration limit.
+    std::uint64_t iterations = 0;
+    int plies = 0;
+    if (((tokens.size() == 3) || (tokens.size() == 4)) &&
+        parse_number(tokens[2], iterations) && (iterations >= 1) &&
+        ((tokens.size() == 3) || parse_number(tokens[3], plies)) &&
+        (plies >= 0)) {
+        const bool nnue = static_cast<bool>(DZChess::active_nnue_network());
         if (tokens[1] == "white") {
-            for (const auto &[name, next] :
-                 available_moves_and_names<PieceColor::WHITE>(board)) {
-                const int score = next.visit<MaterialisticEvaluationVisitor,
-                                             PieceColor::BLACK, 5>();
-                std::cout << name << " : " << score << std::endl;
-                if (best_moves.empty()) {
-                    best_moves.push_back(name);
-                    best_score = score;
-                } else if (score == best_score) {
-                    best_moves.push_back(name);
-                } else if (score > best_score) {
-                    best_moves.clear();
-                    best_moves.push_back(name);
-                    best_score = score;
-                }
-            }
-            std::cout << std::endl;
-            std::cout << "Best moves: ";
-            for (const auto &name : best_moves) {
-                std::cout << name << ", ";
+            if (nnue) {
+                run_monte_carlo<NNUEEvaluationVisitor, PieceColor::WHITE>(
+                    board, iterations, plies);
+            } else {
+                run_monte_carlo<PositionalEvaluationVisitor,
+                                PieceColor::WHITE>(board, iterations, plies);
             }
-            std::cout << std::endl;
         } else if (tokens[1] == "black") {
-            for (const auto &[name, next] :
-                 available_moves_and_names<PieceColor::BLACK>(board)) {
-                const int score = next.visit<MaterialisticEvaluationVisitor,
-                                             PieceColor::WHITE, 5>();
-                std::cout << name << " : " << score << std::endl;
-                if (best_moves.empty()) {
-                    best_moves.push_back(name);
-                    best_score = score;
-                } else if (score == best_score) {
-                    best_moves.push_back(name);
-                } else if (score < best_score) {
-                    best_moves.clear();
-                    best_moves.push_back(name);
-                    best_score = score;
-                }
-            }
-            std::cout << std::endl;
-            std::cout << "Best moves: ";
-            for (const auto &name : best_moves) {
-                std::cout << name << ", ";
+            if (nnue) {
+                run_monte_carlo<NNUEEvaluationVisitor, PieceColor::BLACK>(
+                    board, iterations, plies);
+            } else {
+                run_monte_carlo<PositionalEvaluationVisitor,
+                                PieceColor::BLACK>(board, iterations, plies);
             }
-            std::cout << std::endl;
         } else {
-            std::cout << "invalid syntax for eval command" << std::endl;
+            std::cout << "invalid syntax for mcts command" << std::endl;
         }
     } else {
-        std::cout << "invalid syntax for eval command" << std::endl;
+        std::cout << "invalid syntax for mcts command" << std::endl;
+    }
+}
+
+
+void handle_option_command(SearchOptions &options,
+                           const std::vector<std::string> &tokens) {
+    if (tokens.size() == 1) {
+        std::cout << "nullmove " << options.null_move_pruning << std::endl;
+        std::cout << "lmr " << options.late_move_reductions << std::endl;
+        std::cout << "futility " << options.futility_pruning << std::endl;
+        std::cout << "razoring " << options.razoring << std::endl;
+        std::cout << "pvs " << options.principal_variation_search
+                  << std::endl;
+        std::cout << "aspiration " << options.aspiration_windows
+                  << std::endl;
+        std::cout << "see " << options.static_exchange_pruning << std::endl;
+        std::cout << "evalcache " << options.evaluation_cache << std::endl;
+        std::cout << "tt " << options.transposition_table << std::endl;
+    } else if (tokens.size() == 3 &&
+               (tokens[2] == "on" || tokens[2] == "off")) {
+        const bool value = (tokens[2] == "on");
+        if (tokens[1] == "nullmove") {
+            options.null_move_pruning = value;
+        } else if (tokens[1] == "lmr") {
+            options.late_move_reductions = value;
+        } else if (tokens[1] == "futility") {
+            options.futility_pruning = value;
+        } else if (tokens[1] == "razoring") {
+            options.razoring = value;
+        } else if (tokens[1] == "pvs") {
+            options.principal_variation_search = value;
+        } else if (tokens[1] == "aspiration") {
+            options.aspiration_windows = value;
+        } else if (tokens[1] == "see") {
+            options.static_exchange_pruning = value;
+        } else if (tokens[1] == "evalcache") {
+            options.evaluation_cache = value;
+        } else if (tokens[1] == "tt") {
+            options.transposition_table = value;
+        } else {
+            std::cout << "unknown option" << std::endl;
+        }
+    } else {
+        std::cout << "invalid syntax for option command" << std::endl;
+    }
+}
+
+
+void handle_nnue_command(const std::vector<std::string> &tokens) {
+    if (tokens.size() == 2) {
+        if (tokens[1] == "off") {
+            DZChess::active_nnue_network().reset();
+            evaluation_cache().clear();
+            transposition_table().clear();
+            std::cout << "searching with positional evaluation" << std::endl;
+        } else if (auto network = DZChess::load_nnue_network(tokens[1])) {
+            DZChess::active_nnue_network() = std::move(network);
+            evaluation_cache().clear();
+            transposition_table().clear();
+            std::cout << "searching with network " << tokens[1] << " ("
+                      << DZChess::nnue_kernels()->name << " kernels)"
+                      << std::endl;
+        } else {
+            std::cout << "ERROR: could not load network from " << tokens[1]
+                      << std::endl;
+        }
+    } else {
+        std::cout << "invalid syntax for nnue command" << std::endl;
+    }
+}
+
+
+void handle_tb_command(const std::vector<std::string> &tokens) {
+    // tb [directory]
+    if (tokens.size() == 1) {
+        for (const std::string &name : tablebases().names()) {
+            std::cout << name << std::endl;
+        }
+        std::cout << tablebases().size() << " tablebases loaded"
+                  << std::endl;
+    } else if (tokens.size() == 2) {
+        const std::size_t count = tablebases().load_directory(tokens[1]);
+        transposition_table().clear();
+        std::cout << "loaded " << count << " tablebases from " << tokens[1]
+                  << std::endl;
+    } else {
+        std::cout << "invalid syntax for tb command" << std::endl;
+    }
+}
+
+
+void handle_fen_command(ChessBoard &board, PositionState &state,
+                        const std::string &command) {
+    if (command == "fen") {
+        std::cout << DZChess::to_fen(board, state) << std::endl;
+    } else if (!DZChess::parse_fen(std::string_view{command}.substr(4),
+                                   board, state)) {
+        std::cout << "ERROR: invalid FEN" << std::endl;
+    }
+}
+
+
+void handle_command(ChessBoard &board, PositionState &state,
+                    SearchOptions &options, const std::string &command) {
+    const auto tokens = split(command, ' ');
+    if (tokens.empty()) { return; }
+    if (tokens[0] == "add") {
+        handle_add_command(board, tokens);
+    } else if (tokens[0] == "rm") {
+        handle_rm_command(board, tokens);
+    } else if (tokens[0] == "ls") {
+        handle_ls_command(board, tokens);
+    } else if (tokens[0] == "move") {
+        handle_move_command(board, state, tokens);
+    } else if (tokens[0] == "eval") {
+        handle_eval_command(board, tokens);
+    } else if (tokens[0] == "search") {
+        handle_search_command(board, state, options, tokens);
+    } else if (tokens[0] == "mate") {
+        handle_mate_command(board, state, tokens);
+    } else if (tokens[0] == "mcts") {
+        handle_mcts_command(board, tokens);
+    } else if (tokens[0] == "option") {
+        handle_option_command(options, tokens);
+    } else if (tokens[0] == "nnue") {
+        handle_nnue_command(tokens);
+    } else if (tokens[0] == "tb") {
+        handle_tb_command(tokens);
+    } else if (tokens[0] == "fen") {
+        handle_fen_command(board, state, command);
+    } else if (tokens[0] == "board") {
+        print_board(board);
+    } else {
+        std::cout << "unknown command" << std::endl;
+    }
+}
+
+
+// Output buffer for batch mode. The command handlers end lines with
+// std::endl, which flushes; here flushing is deferred until the buffer is
+// full or the batch ends, so scripted runs are not dominated by writes.
+class BatchOutputBuffer : public std::streambuf {
+
+    std::vector<char> buffer;
+
+    void write_out() {
+        const std::size_t size = static_cast<std::size_t>(pptr() - pbase());
+        std::fwrite(pbase(), 1, size, stdout);
+        setp(buffer.data(), buffer.data() + buffer.size());
+    }
+
+protected:
+
+    int_type overflow(int_type c) override {
+        write_out();
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            *pptr() = traits_type::to_char_type(c);
+            pbump(1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+    int sync() override { return 0; }
+
+public:
+
+    explicit BatchOutputBuffer(std::size_t size = 1 << 20) : buffer(size) {
+        setp(buffer.data(), buffer.data() + buffer.size());
     }
+
+    ~BatchOutputBuffer() override {
+        write_out();
+        std::fflush(stdout);
+    }
+
+}; // class BatchOutputBuffer
+
+
+// Runs commands from a file, or from standard input if path is empty,
+// until end of input or quit. The board is printed only by the board
+// command. Each command is followed by its running time on a line
+// starting with '#', and a summary by command name is printed at the end.
+int run_batch(const std::string &path) {
+    std::ifstream file{};
+    if (!path.empty()) {
+        file.open(path);
+        if (!file) {
+            std::cerr << "ERROR: could not read " << path << std::endl;
+            return 1;
+        }
+    }
+    std::istream &input = path.empty() ? std::cin : file;
+    std::ios::sync_with_stdio(false);
+    std::cin.tie(nullptr);
+
+    BatchOutputBuffer buffer{};
+    std::streambuf *const previous = std::cout.rdbuf(&buffer);
+
+    ChessBoard board{};
+    PositionState state{};
+    SearchOptions options{};
+    std::map<std::string, std::pair<std::size_t, double>> timings{};
+    const auto batch_start = std::chrono::steady_clock::now();
+    std::string command;
+    while (std::getline(input, command)) {
+        if (!command.empty() && (command.back() == '\r')) {
+            command.pop_back();
+        }
+        if (command.empty() || (command[0] == '#')) { continue; }
+        if (command == "quit") { break; }
+        const auto start = std::chrono::steady_clock::now();
+        handle_command(board, state, options, command);
+        const auto stop = std::chrono::steady_clock::now();
+        const double ms =
+            std::chrono::duration<double, std::milli>(stop - start).count();
+        std::cout << "# " << ms << " ms: " << command << '\n';
+        auto &[count, total] = timings[command.substr(0, command.find(' '))];
+        ++count;
+        total += ms;
+    }
+    const double total_ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - batch_start).count();
+
+    std::cout << "# Command timing:\n";
+    for (const auto &[name, timing] : timings) {
+        const auto &[count, total] = timing;
+        std::cout << "#     " << name << ": " << count << " calls, "
+                  << total << " ms total, "
+                  << total / static_cast<double>(count) << " ms mean\n";
+    }
+    std::cout << "# Batch time: " << total_ms << " ms\n";
+    std::cout.rdbuf(previous);
+    return 0;
 }
 
 
-int main() {
+int main(int argc, char **argv) {
+
+    // GUIs start the engine and send "uci" first; "dzchess uci" skips the
+    // board printed by the interactive prompt.
+    if ((argc > 1) && (std::string_view{argv[1]} == "uci")) {
+        DZChess::UCIEngine{}.run();
+        return 0;
+    }
+    if ((argc > 1) && (std::string_view{argv[1]} == "batch")) {
+        return run_batch((argc > 2) ? argv[2] : "");
+    }
+    if ((argc > 1) && (std::string_view{argv[1]} == "serve")) {
+        std::size_t workers = DZChess::ThreadPool::default_thread_count();
+        if ((argc < 3) || (argc > 5) ||
+            ((argc > 3) && (!parse_number(argv[3], workers) ||
+                            (workers == 0)))) {
+            std::cout << "usage: " << argv[0]
+                      << " serve <socket> [workers] [tablebase directory]"
+                      << std::endl;
+            return 1;
+        }
+        DZChess::AnalysisServer server{argv[2], workers};
+        if (argc > 4) {
+            std::cout << "Loaded " << server.load_tablebases(argv[4])
+                      << " tablebases from " << argv[4] << "." << std::endl;
+        }
+        std::cout << "Serving analysis on " << argv[2] << " with " << workers
+                  << " workers." << std::endl;
+        if (!server.run()) {
+            std::cout << "ERROR: could not listen on " << argv[2] << std::endl;
+            return 1;
+        }
+    }
 
     ChessBoard board{};
+    PositionState state{};
+    SearchOptions options{};
 
     while (true) {
 
         print_board(board);
         std::cout << "> ";
         std::string command;
-        std::getline(std::cin, command, '\n');
-
-        const auto tokens = split(command, ' ');
-        if (!tokens.empty()) {
-            if (tokens[0] == "add") {
-                handle_add_command(board, tokens);
-            } else if (tokens[0] == "rm") {
-                handle_rm_command(board, tokens);
-            } else if (tokens[0] == "ls") {
-                handle_ls_command(board, tokens);
-            } else if (tokens[0] == "move") {
-                handle_move_command(board, tokens);
-            } else if (tokens[0] == "eval") {
-                handle_eval_command(board, tokens);
-            } else {
-                std::cout << "unknown command" << std::endl;
-            }
+        if (!std::getline(std::cin, command, '\n')) { break; }
+        if (command == "quit") { break; }
+        if (command == "uci") {
+            DZChess::UCIEngine{}.run();
+            break;
         }
+        handle_command(board, state, options, command);
 
     }
 
@@ -0,0 +1,297 @@
+#include <algorithm> // for std::find, std::min
+#include <chrono>    // for std::chrono::steady_clock
+#include <cstddef>   // for std::size_t
+#include <cstdint>   // for std::uint64_t
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "ChessPiece.hpp"
+#include "ChessBoard.hpp"
+#include "MoveList.hpp"
+#include "MoveNaming.hpp"
+#include "Evaluation.hpp"
+#include "Search.hpp"
+#include "Fen.hpp"
+#include "ParseNumber.hpp"
+#include "ThreadPool.hpp"
+
+
+using namespace DZChess;
+
+
+// Runs the positions of an EPD test suite through the search in parallel
+// and checks the move found against the bm (best move) and am (avoid
+// move) operations of each position.
+
+
+struct EpdPosition {
+    std::string id;
+    ChessBoard board{};
+    PositionState state{};
+    std::vector<std::string> best_moves;
+    std::vector<std::string> avoid_moves;
+};
+
+
+struct EpdOutcome {
+    std::string move;
+    int score;
+    int depth;
+    std::uint64_t nodes;
+    double seconds;
+    bool solved;
+};
+
+
+std::string_view trim(std::string_view s) noexcept {
+    while (!s.empty() && ((s.front() == ' ') || (s.front() == '\t'))) {
+        s.remove_prefix(1);
+    }
+    while (!s.empty() && ((s.back() == ' ') || (s.back() == '\t') ||
+                          (s.back() == '\r'))) {
+        s.remove_suffix(1);
+    }
+    return s;
+}
+
+
+// Reduces a move in standard algebraic notation to the form produced by
+// move_name, which marks neither checks nor annotations, and drops the
+// '=' of promotions, which some suites omit.
+std::string normalize_move(std::string_view san) {
+    std::string result{};
+    for (const char c : san) {
+        if ((c != '+') && (c != '#') && (c != '!') && (c != '?') &&
+            (c != '=')) {
+            result.push_back(c);
+        }
+    }
+    return result;
+}
+
+
+std::vector<std::string> split_operands(std::string_view operands) {
+    std::vector<std::string> result{};
+    while (!(operands = trim(operands)).empty()) {
+        const std::size_t end = operands.find(' ');
+        result.emplace_back(operands.substr(0, end));
+        if (end == std::string_view::npos) { break; }
+        operands.remove_prefix(end);
+    }
+    return result;
+}
+
+
+// Parses "<4 FEN fields> <opcode> <operands>; <opcode> <operands>; ...".
+bool parse_epd_line(std::string_view line, EpdPosition &position) {
+    const std::size_t length =
+        parse_fen_prefix(line, position.board, position.state);
+    if (length == 0) { return false; }
+    std::string_view rest = line.substr(length);
+    while (!(rest = trim(rest)).empty()) {
+        // Semicolons inside quoted operands do not end the operation.
+        std::size_t end = 0;
+        bool quoted = false;
+        while ((end < rest.size()) && (quoted || (rest[end] != ';'))) {
+            if (rest[end] == '"') { quoted = !quoted; }
+            ++end;
+        }
+        const std::string_view operation = trim(rest.substr(0, end));
+        rest.remove_prefix(std::min(end + 1, rest.size()));
+        const std::size_t space = operation.find(' ');
+        if (space == std::string_view::npos) { continue; }
+        const std::string_view opcode = operation.substr(0, space);
+        const std::string_view operands = trim(operation.substr(space));
+        if (opcode == "bm") {
+            for (const std::string &move : split_operands(operands)) {
+                position.best_moves.push_back(normalize_move(move));
+            }
+        } else if (opcode == "am") {
+            for (const std::string &move : split_operands(operands)) {
+                position.avoid_moves.push_back(normalize_move(move));
+            }
+        } else if (opcode == "id") {
+            position.id = std::string{operands};
+            if ((position.id.size() >= 2) && (position.id.front() == '"') &&
+                (position.id.back() == '"')) {
+                position.id = position.id.substr(1, position.id.size() - 2);
+            }
+        }
+    }
+    return !position.best_moves.empty() || !position.avoid_moves.empty();
+}
+
+
+using EpdSearcher = Searcher<PositionalEvaluationVisitor>;
+
+
+template <PieceColor COLOR>
+EpdOutcome run_position(EpdSearcher &searcher, const EpdPosition &position,
+                        int depth, std::uint64_t nodes, int milliseconds) {
+    searcher.statistics = {};
+    searcher.limits.nodes = nodes;
+    searcher.halfmove_clock = static_cast<int>(position.state.halfmove_clock);
+    const auto start = std::chrono::steady_clock::now();
+    searcher.limits.deadline = (milliseconds > 0)
+        ? start + std::chrono::milliseconds{milliseconds}
+        : std::chrono::steady_clock::time_point::max();
+    const SearchResult result =
+        searcher.template search_root<COLOR>(position.board, depth);
+    const auto stop = std::chrono::steady_clock::now();
+
+    MoveList moves{};
+    generate_legal_moves<COLOR>(position.board, moves);
+    EpdOutcome outcome{};
+    outcome.move = moves.empty()
+        ? std::string{"(none)"}
+        : move_name(position.board, result.best_move, moves);
+    outcome.score = result.score;
+    outcome.depth = result.depth;
+    outcome.nodes = searcher.statistics.nodes +
+                    searcher.statistics.quiescence_nodes;
+    outcome.seconds = std::chrono::duration<double>(stop - start).count();
+    const std::string found = normalize_move(outcome.move);
+    const auto contains = [&found](const std::vector<std::string> &list) {
+        return std::find(list.begin(), list.end(), found) != list.end();
+    };
+    outcome.solved = !moves.empty() &&
+        (position.best_moves.empty() || contains(position.best_moves)) &&
+        !contains(position.avoid_moves);
+    return outcome;
+}
+
+
+void print_usage(const char *program) {
+    std::cout << "usage: " << program << " <suite.epd> [--time ms]"
+              << " [--nodes n] [--depth d] [--threads n]" << std::endl;
+    std::cout << "Searches each position until one of the limits is hit;"
+                 " the default is --time 1000." << std::endl;
+}
+
+
+int main(int argc, char **argv) {
+
+    if (argc < 2) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    const std::string path = argv[1];
+    int milliseconds = 0;
+    std::uint64_t nodes = 0;
+    int depth = MAX_PLY - 1;
+    std::size_t threads = ThreadPool::default_thread_count();
+    for (int i = 2; i + 1 < argc; i += 2) {
+        // Every limit must be a positive number.
+        const std::string flag = argv[i];
+        const std::string_view value = argv[i + 1];
+        bool valid = false;
+        if (flag == "--time") {
+            valid = parse_number(value, milliseconds) && (milliseconds > 0);
+        } else if (flag == "--nodes") {
+            valid = parse_number(value, nodes) && (nodes > 0);
+        } else if (flag == "--depth") {
+            valid = parse_number(value, depth) && (depth > 0) &&
+                    (depth < MAX_PLY);
+        } else if (flag == "--threads") {
+            valid = parse_number(value, threads) && (threads > 0);
+        }
+        if (!valid) {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if ((argc % 2) != 0) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    if ((milliseconds == 0) && (nodes == 0) && (depth == MAX_PLY - 1)) {
+        milliseconds = 1000;
+    }
+
+    std::ifstream file{path};
+    if (!file) {
+        std::cout << "ERROR: could not read " << path << std::endl;
+        return 1;
+    }
+    std::vector<EpdPosition> positions{};
+    std::size_t skipped = 0;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (trim(line).empty()) { continue; }
+        EpdPosition position{};
+        if (parse_epd_line(line, position)) {
+            if (position.id.empty()) {
+                position.id = "#" + std::to_string(positions.size() + 1);
+            }
+            positions.push_back(std::move(position));
+        } else {
+            ++skipped;
+        }
+    }
+    if (skipped > 0) {
+        std::cout << "Skipped " << skipped << " lines without a position"
+                  << " and a bm or am operation." << std::endl;
+    }
+
+    // One searcher per worker, reused across positions; the evaluation
+    // cache is lock-free and shared by all of them.
+    ThreadPool pool{threads};
+    std::vector<std::unique_ptr<EpdSearcher>> searchers{};
+    EvaluationCache cache{20};
+    for (std::size_t i = 0; i < pool.size(); ++i) {
+        searchers.push_back(std::make_unique<EpdSearcher>());
+        searchers.back()->evaluation_cache = &cache;
+    }
+
+    std::vector<EpdOutcome> outcomes(positions.size());
+    const auto start = std::chrono::steady_clock::now();
+    pool.parallel_for(positions.size(), [&](std::size_t i, std::size_t t) {
+        const EpdPosition &position = positions[i];
+        EpdSearcher &searcher = *searchers[t];
+        outcomes[i] = (position.state.side_to_move == PieceColor::WHITE)
+            ? run_position<PieceColor::WHITE>(searcher, position,
+                                              depth, nodes, milliseconds)
+            : run_position<PieceColor::BLACK>(searcher, position,
+                                              depth, nodes, milliseconds);
+    });
+    const auto stop = std::chrono::steady_clock::now();
+    const double seconds = std::chrono::duration<double>(stop - start).count();
+
+    std::size_t solved = 0;
+    std::uint64_t total_nodes = 0;
+    for (std::size_t i = 0; i < positions.size(); ++i) {
+        const EpdPosition &position = positions[i];
+        const EpdOutcome &outcome = outcomes[i];
+        solved += outcome.solved;
+        total_nodes += outcome.nodes;
+        std::cout << (outcome.solved ? "    solved " : "    FAILED ")
+                  << position.id << ": " << outcome.move;
+        for (const std::string &move : position.best_moves) {
+            std::cout << " bm " << move;
+        }
+        for (const std::string &move : position.avoid_moves) {
+            std::cout << " am " << move;
+        }
+        std::cout << " (score " << outcome.score << ", depth "
+                  << outcome.depth << ", " << outcome.nodes << " nodes, "
+                  << outcome.seconds << " s)" << std::endl;
+    }
+    std::cout << "Solved " << solved << " of " << positions.size();
+    if (!positions.empty()) {
+        std::cout << " (" << 100.0 * static_cast<double>(solved)
+                             / static_cast<double>(positions.size()) << "%)";
+    }
+    std::cout << std::endl;
+    std::cout << "Total time: " << seconds << " s on " << pool.size()
+              << " threads" << std::endl;
+    std::cout << "Nodes: " << total_nodes << " ("
+              << static_cast<double>(total_nodes) / seconds << " nodes/s)"
+              << std::endl;
+    return (solved == positions.size()) ? 0 : 2;
+
+}
@@ -0,0 +1,139 @@
+#ifndef DZCHESS_EVALUATION_HPP_INCLUDED
+#define DZCHESS_EVALUATION_HPP_INCLUDED
+
+#include <algorithm> // for std::max, std::min
+#include <cassert>   // for assert
+#include <climits>   // for INT_MIN, INT_MAX
+#include <cstdint>   // for std::uint64_t
+
+#include "ChessPiece.hpp"
+#include "ChessBoard.hpp"
+#include "PawnStructure.hpp"
+#include "AttackInfo.hpp"
+#include "Mobility.hpp"
+
+namespace DZChess {
+
+
+template <PieceColor COLOR, int DEPTH>
+struct MaterialisticEvaluationVisitor {
+
+    int accumulator;
+
+    using result_type = int;
+
+    static constexpr result_type visit(const ChessBoard &b) noexcept {
+        if (b.piece_count<PieceColor::WHITE, PieceType::KING>() == 0)
+            return -1'000'000;
+        if (b.piece_count<PieceColor::BLACK, PieceType::KING>() == 0)
+            return +1'000'000;
+        return (+ 900 * b.piece_count<PieceColor::WHITE, PieceType::QUEEN >()
+                + 500 * b.piece_count<PieceColor::WHITE, PieceType::ROOK  >()
+                + 300 * b.piece_count<PieceColor::WHITE, PieceType::BISHOP>()
+                + 300 * b.piece_count<PieceColor::WHITE, PieceType::KNIGHT>()
+                + 100 * b.piece_count<PieceColor::WHITE, PieceType::PAWN  >()
+                - 900 * b.piece_count<PieceColor::BLACK, PieceType::QUEEN >()
+                - 500 * b.piece_count<PieceColor::BLACK, PieceType::ROOK  >()
+                - 300 * b.piece_count<PieceColor::BLACK, PieceType::BISHOP>()
+                - 300 * b.piece_count<PieceColor::BLACK, PieceType::KNIGHT>()
+                - 100 * b.piece_count<PieceColor::BLACK, PieceType::PAWN  >());
+    }
+
+    explicit constexpr MaterialisticEvaluationVisitor() noexcept
+        : accumulator((COLOR == PieceColor::WHITE) ? INT_MIN : INT_MAX) {}
+
+    template <PieceType TYPE>
+    constexpr void visit(const ChessBoard &, const ChessBoard &,
+                         std::uint64_t, std::uint64_t,
+                         result_type result) noexcept {
+        if constexpr (COLOR == PieceColor::WHITE) {
+            accumulator = std::max(accumulator, result);
+        } else if constexpr (COLOR == PieceColor::BLACK) {
+            accumulator = std::min(accumulator, result);
+        }
+    }
+
+    template <PieceType TYPE>
+    constexpr void visit_promotion(const ChessBoard &, const ChessBoard &,
+                                   std::uint64_t, std::uint64_t,
+                                   result_type result) noexcept {
+        if constexpr (COLOR == PieceColor::WHITE) {
+            accumulator = std::max(accumulator, result);
+        } else if constexpr (COLOR == PieceColor::BLACK) {
+            accumulator = std::min(accumulator, result);
+        }
+    }
+
+    constexpr result_type get_result() const noexcept {
+        return accumulator;
+    }
+
+}; // struct MaterialisticEvaluationVisitor
+
+
+// Tapered material and piece-square evaluation. The score is carried
+// incrementally by the board, so a leaf costs a few arithmetic operations;
+// debug builds check it against a from-scratch recomputation.
+template <PieceColor COLOR, int DEPTH>
+struct PieceSquareEvaluationVisitor
+    : public MaterialisticEvaluationVisitor<COLOR, DEPTH> {
+
+    using result_type = int;
+    using MaterialisticEvaluationVisitor<COLOR, DEPTH>::visit;
+
+    static constexpr result_type visit(const ChessBoard &b) noexcept {
+        assert(b.get_scores() == b.compute_scores());
+        assert(b.get_hash() == b.compute_hash());
+        if (b.piece_count<PieceColor::WHITE, PieceType::KING>() == 0)
+            return -1'000'000;
+        if (b.piece_count<PieceColor::BLACK, PieceType::KING>() == 0)
+            return +1'000'000;
+        return b.get_scores().tapered();
+    }
+
+    explicit constexpr PieceSquareEvaluationVisitor() noexcept
+        : MaterialisticEvaluationVisitor<COLOR, DEPTH>() {}
+
+}; // struct PieceSquareEvaluationVisitor
+
+
+// Piece-square evaluation plus pawn structure, which is looked up in the
+// calling thread's pawn hash table, and mobility and king-zone attacks,
+// which are counted from attack sets. Callers that already hold the attack
+// map of the position can pass it in to avoid recomputing it.
+template <PieceColor COLOR, int DEPTH>
+struct PositionalEvaluationVisitor
+    : public MaterialisticEvaluationVisitor<COLOR, DEPTH> {
+
+    using result_type = int;
+    using MaterialisticEvaluationVisitor<COLOR, DEPTH>::visit;
+
+    static result_type visit(const ChessBoard &b,
+                             const AttackInfo &info) noexcept {
+        assert(b.get_scores() == b.compute_scores());
+        assert(b.get_pawn_hash() == b.compute_pawn_hash());
+        if (b.piece_count<PieceColor::WHITE, PieceType::KING>() == 0)
+            return -1'000'000;
+        if (b.piece_count<PieceColor::BLACK, PieceType::KING>() == 0)
+            return +1'000'000;
+        const PieceSquareScore &scores = b.get_scores();
+        const PawnEvaluation pawns = pawn_hash_table().probe(b);
+        const MobilityEvaluation mobility = evaluate_mobility(b, info);
+        return taper(scores.midgame + pawns.midgame + mobility.midgame,
+                     scores.endgame + pawns.endgame + mobility.endgame,
+                     scores.phase);
+    }
+
+    static result_type visit(const ChessBoard &b) noexcept {
+        return visit(b, AttackInfo{b});
+    }
+
+    explicit constexpr PositionalEvaluationVisitor() noexcept
+        : MaterialisticEvaluationVisitor<COLOR, DEPTH>() {}
+
+}; // struct PositionalEvaluationVisitor
+
+
+} // namespace DZChess
+
+#endif // DZCHESS_EVALUATION_HPP_INCLUDED
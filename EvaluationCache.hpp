@@ -0,0 +1,68 @@
+#ifndef DZCHESS_EVALUATION_CACHE_HPP_INCLUDED
+#define DZCHESS_EVALUATION_CACHE_HPP_INCLUDED
+
+#include <atomic>  // for std::atomic, std::memory_order_relaxed
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::uint64_t, std::int64_t
+#include <memory>  // for std::unique_ptr
+
+namespace DZChess {
+
+
+// Direct-mapped cache of static evaluations keyed by position hash, which
+// several search threads may share without locking. Each entry stores the
+// score next to the key XORed with the score, so a write torn by another
+// thread fails the key check instead of returning another position's score.
+// Keys include the side to move (see position_key), since evaluators such
+// as NNUEEvaluationVisitor score a position differently for each side.
+class EvaluationCache {
+
+    struct Entry {
+        std::atomic<std::uint64_t> check;
+        std::atomic<std::uint64_t> data;
+    };
+
+    std::unique_ptr<Entry[]> entries;
+    std::size_t size;
+
+public:
+
+    explicit EvaluationCache(std::size_t log2_size = 16) :
+        entries(new Entry[std::size_t{1} << log2_size]()),
+        size(std::size_t{1} << log2_size) {}
+
+    std::size_t capacity() const noexcept { return size; }
+
+    bool probe(std::uint64_t key, int &score) const noexcept {
+        const Entry &entry = entries[key & (size - 1)];
+        const std::uint64_t data =
+            entry.data.load(std::memory_order_relaxed);
+        const std::uint64_t check =
+            entry.check.load(std::memory_order_relaxed);
+        if ((check ^ data) != key) { return false; }
+        score = static_cast<int>(static_cast<std::int64_t>(data));
+        return true;
+    }
+
+    void store(std::uint64_t key, int score) noexcept {
+        Entry &entry = entries[key & (size - 1)];
+        const auto data =
+            static_cast<std::uint64_t>(static_cast<std::int64_t>(score));
+        entry.check.store(key ^ data, std::memory_order_relaxed);
+        entry.data.store(data, std::memory_order_relaxed);
+    }
+
+    // Must be called whenever the evaluation function changes.
+    void clear() noexcept {
+        for (std::size_t i = 0; i < size; ++i) {
+            entries[i].check.store(0, std::memory_order_relaxed);
+            entries[i].data.store(0, std::memory_order_relaxed);
+        }
+    }
+
+}; // class EvaluationCache
+
+
+} // namespace DZChess
+
+#endif // DZCHESS_EVALUATION_CACHE_HPP_INCLUDED
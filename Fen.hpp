@@ -0,0 +1,446 @@
+#ifndef DZCHESS_FEN_HPP_INCLUDED
+#define DZCHESS_FEN_HPP_INCLUDED
+
+#include <algorithm>   // for std::max
+#include <array>       // for std::array
+#include <bit>         // for std::popcount
+#include <cstddef>     // for std::size_t
+#include <cstdint>     // for std::uint8_t, std::uint32_t, std::uint64_t
+#include <string>      // for std::string
+#include <string_view> // for std::string_view
+
+#include "ChessPiece.hpp"
+#include "ChessBoard.hpp"
+
+namespace DZChess {
+
+
+constexpr std::uint8_t WHITE_KINGSIDE  = 0x1;
+constexpr std::uint8_t WHITE_QUEENSIDE = 0x2;
+constexpr std::uint8_t BLACK_KINGSIDE  = 0x4;
+constexpr std::uint8_t BLACK_QUEENSIDE = 0x8;
+
+constexpr int NO_EN_PASSANT = -1;
+
+
+// Game state that a FEN string records alongside the piece placement.
+// ChessBoard does not model castling or en passant, so these fields are
+// carried through unchanged for positions read from and written to FEN.
+struct PositionState {
+
+    PieceColor side_to_move;
+    std::uint8_t castling_rights; // bitwise OR of WHITE_KINGSIDE etc.
+    int en_passant;               // target square, or NO_EN_PASSANT
+    std::uint32_t halfmove_clock;
+    std::uint32_t fullmove_number;
+
+    explicit constexpr PositionState() noexcept :
+        side_to_move(PieceColor::WHITE), castling_rights(0xF),
+        en_passant(NO_EN_PASSANT), halfmove_clock(0), fullmove_number(1) {}
+
+    constexpr bool operator==(const PositionState &) const noexcept = default;
+
+}; // struct PositionState
+
+
+constexpr std::string_view STARTING_FEN =
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+// Longest string written by write_fen: 64 pieces and 7 slashes, followed
+// by " w KQkq e3 " and two ten-digit counters separated by a space.
+constexpr std::size_t MAX_FEN_LENGTH =
+    71 + 1 + 1 + 1 + 4 + 1 + 2 + 1 + 10 + 1 + 10;
+
+
+// Index into the array of twelve bitboards passed to the ChessBoard
+// constructor, or -1 if the character does not name a piece.
+constexpr int fen_piece_index(char c) noexcept {
+    switch (c) {
+        case 'K': return 0;  case 'Q': return 1;  case 'R': return 2;
+        case 'B': return 3;  case 'N': return 4;  case 'P': return 5;
+        case 'k': return 6;  case 'q': return 7;  case 'r': return 8;
+        case 'b': return 9;  case 'n': return 10; case 'p': return 11;
+        default: return -1;
+    }
+}
+
+
+// The castling rights among rights whose king and rook are still on their
+// original squares.
+constexpr std::uint8_t possible_castling_rights(
+    const ChessBoard &board, std::uint8_t rights
+) noexcept {
+    using enum PieceColor;
+    using enum PieceType;
+    const bool white_king = board.has_piece<WHITE, KING>(4);
+    const bool black_king = board.has_piece<BLACK, KING>(60);
+    std::uint8_t result = 0;
+    if (white_king && board.has_piece<WHITE, ROOK>(7)) {
+        result |= WHITE_KINGSIDE;
+    }
+    if (white_king && board.has_piece<WHITE, ROOK>(0)) {
+        result |= WHITE_QUEENSIDE;
+    }
+    if (black_king && board.has_piece<BLACK, ROOK>(63)) {
+        result |= BLACK_KINGSIDE;
+    }
+    if (black_king && board.has_piece<BLACK, ROOK>(56)) {
+        result |= BLACK_QUEENSIDE;
+    }
+    return static_cast<std::uint8_t>(result & rights);
+}
+
+
+namespace detail {
+
+constexpr bool fen_digit(char c) noexcept { return ('0' <= c) && (c <= '9'); }
+
+// Reads a decimal counter starting at fen[i], advancing i past it.
+constexpr bool parse_fen_counter(std::string_view fen, std::size_t &i,
+                                 std::uint32_t &result) noexcept {
+    const std::size_t start = i;
+    std::uint64_t value = 0;
+    while ((i < fen.size()) && fen_digit(fen[i])) {
+        value = 10 * value + static_cast<std::uint64_t>(fen[i] - '0');
+        if (value > UINT32_MAX) { return false; }
+        ++i;
+    }
+    result = static_cast<std::uint32_t>(value);
+    return (i > start) && ((i == fen.size()) || (fen[i] == ' '));
+}
+
+// Effect of one character of the placement field. Squares are counted in
+// FEN order, from a8 to h1, and pieces not on the board go into a spare
+// thirteenth bitboard, so that the placement field is read with the same
+// few operations per character whichever character it is.
+struct FenSymbol {
+    std::uint8_t piece;   // bitboard index, or 12 for no piece
+    std::uint8_t advance; // squares passed
+    std::uint8_t slash;
+    std::uint8_t invalid;
+};
+
+constexpr std::array<FenSymbol, 256> compute_fen_symbols() noexcept {
+    std::array<FenSymbol, 256> result{};
+    for (unsigned c = 0; c < 256; ++c) {
+        const int index = fen_piece_index(static_cast<char>(c));
+        FenSymbol &symbol = result[c];
+        symbol.piece = 12;
+        if (index >= 0) {
+            symbol.piece = static_cast<std::uint8_t>(index);
+            symbol.advance = 1;
+        } else if (('1' <= c) && (c <= '8')) {
+            symbol.advance = static_cast<std::uint8_t>(c - '0');
+        } else if (c == '/') {
+            symbol.slash = 1;
+        } else {
+            symbol.invalid = 1;
+        }
+    }
+    return result;
+}
+
+constexpr std::array<FenSymbol, 256> FEN_SYMBOLS = compute_fen_symbols();
+
+constexpr ChessBoard fen_board(
+    const std::array<std::uint64_t, 13> &pieces
+) noexcept {
+    return ChessBoard{pieces[0], pieces[1], pieces[2], pieces[3],
+                      pieces[4], pieces[5], pieces[6], pieces[7],
+                      pieces[8], pieces[9], pieces[10], pieces[11]};
+}
+
+// Whether the pieces could stand on the board in a game: one king per
+// side, no pawns on the first or last rank, at most eight pawns per side,
+// and no more extra queens, rooks, bishops and knights than missing pawns.
+// This also bounds the number of moves in a position (see MoveList).
+constexpr bool valid_fen_material(
+    const std::array<std::uint64_t, 13> &pieces
+) noexcept {
+    constexpr std::uint64_t BACK_RANKS = 0xFF000000000000FF;
+    if (((pieces[5] | pieces[11]) & BACK_RANKS) != 0) { return false; }
+    for (std::size_t king = 0; king < 12; king += 6) {
+        const auto count = [&](std::size_t offset) {
+            return std::popcount(pieces[king + offset]);
+        };
+        const int promoted = std::max(count(1) - 1, 0) +
+                             std::max(count(2) - 2, 0) +
+                             std::max(count(3) - 2, 0) +
+                             std::max(count(4) - 2, 0);
+        if ((count(0) != 1) || (count(5) + promoted > 8)) { return false; }
+    }
+    return true;
+}
+
+// Reads the fields of a FEN record at the start of fen into the twelve
+// piece bitboards and the position state, and returns the number of
+// characters consumed, or zero if the record is malformed or the position
+// impossible.
+constexpr std::size_t scan_fen(std::string_view fen,
+                               std::array<std::uint64_t, 13> &pieces,
+                               PositionState &result) noexcept {
+    std::size_t i = 0;
+    std::uint64_t position = 0;
+    std::uint64_t slashes = 0;
+    bool error = false;
+    for (; (i < fen.size()) && (fen[i] != ' '); ++i) {
+        const FenSymbol symbol =
+            FEN_SYMBOLS[static_cast<unsigned char>(fen[i])];
+        // Each slash must end a rank of exactly eight squares.
+        error |= (symbol.invalid != 0) ||
+                 ((symbol.slash != 0) && (position != 8 * (slashes + 1)));
+        pieces[symbol.piece] |= std::uint64_t{1} << ((position ^ 56) & 63);
+        position += symbol.advance;
+        slashes += symbol.slash;
+    }
+    if (error || (position != 64) || (slashes != 7) ||
+        (i + 2 > fen.size())) {
+        return 0;
+    }
+
+    const char side = fen[i + 1];
+    if ((side != 'w') && (side != 'b')) { return 0; }
+    result.side_to_move = (side == 'w') ? PieceColor::WHITE
+                                        : PieceColor::BLACK;
+    i += 2;
+
+    if ((i + 1 >= fen.size()) || (fen[i] != ' ')) { return 0; }
+    ++i;
+    result.castling_rights = 0;
+    if (fen[i] == '-') {
+        ++i;
+    } else {
+        for (; (i < fen.size()) && (fen[i] != ' '); ++i) {
+            std::uint8_t right = 0;
+            switch (fen[i]) {
+                case 'K': right = WHITE_KINGSIDE;  break;
+                case 'Q': right = WHITE_QUEENSIDE; break;
+                case 'k': right = BLACK_KINGSIDE;  break;
+                case 'q': right = BLACK_QUEENSIDE; break;
+                default: return 0;
+            }
+            if (result.castling_rights & right) { return 0; }
+            result.castling_rights |= right;
+        }
+    }
+
+    if ((i + 1 >= fen.size()) || (fen[i] != ' ')) { return 0; }
+    ++i;
+    if (fen[i] == '-') {
+        ++i;
+    } else {
+        if (i + 2 > fen.size()) { return 0; }
+        const char f = fen[i];
+        const char r = fen[i + 1];
+        if ((f < 'a') || (f > 'h') || ((r != '3') && (r != '6'))) {
+            return 0;
+        }
+        result.en_passant = 8 * (r - '1') + (f - 'a');
+        i += 2;
+    }
+    if ((i < fen.size()) && (fen[i] != ' ')) { return 0; }
+    if (!valid_fen_material(pieces)) { return 0; }
+    const ChessBoard board = fen_board(pieces);
+    if (possible_castling_rights(board, result.castling_rights) !=
+        result.castling_rights) {
+        return 0;
+    }
+    // The side that has just moved cannot have left its king in check.
+    if ((result.side_to_move == PieceColor::WHITE)
+            ? board.in_check<PieceColor::BLACK>()
+            : board.in_check<PieceColor::WHITE>()) {
+        return 0;
+    }
+
+    if ((i + 1 < fen.size()) && fen_digit(fen[i + 1])) {
+        ++i;
+        if (!parse_fen_counter(fen, i, result.halfmove_clock)) {
+            return 0;
+        }
+        if ((i + 1 >= fen.size()) || !fen_digit(fen[i + 1])) {
+            return 0;
+        }
+        ++i;
+        if (!parse_fen_counter(fen, i, result.fullmove_number)) {
+            return 0;
+        }
+    }
+
+    return i;
+}
+
+} // namespace detail
+
+
+// Parses a FEN record at the start of fen and returns the number of
+// characters consumed, or zero if it is malformed or describes a position
+// that cannot occur in a game (see valid_fen_material), in which case the
+// outputs are untouched. The placement, side to move, castling and en
+// passant fields are required; the two move counters are optional, as in
+// EPD, and are read only if present. Trailing text is left unconsumed so
+// that EPD operations can follow the position.
+constexpr std::size_t parse_fen_prefix(std::string_view fen,
+                                       ChessBoard &board,
+                                       PositionState &state) noexcept {
+    std::array<std::uint64_t, 13> pieces{};
+    PositionState result{};
+    const std::size_t length = detail::scan_fen(fen, pieces, result);
+    if (length == 0) { return 0; }
+    board = detail::fen_board(pieces);
+    state = result;
+    return length;
+}
+
+
+// Parses a complete FEN string, allowing only trailing spaces after it.
+constexpr bool parse_fen(std::string_view fen, ChessBoard &board,
+                         PositionState &state) noexcept {
+    std::array<std::uint64_t, 13> pieces{};
+    PositionState result{};
+    std::size_t i = detail::scan_fen(fen, pieces, result);
+    if (i == 0) { return false; }
+    while ((i < fen.size()) && (fen[i] == ' ')) { ++i; }
+    if (i != fen.size()) { return false; }
+    board = detail::fen_board(pieces);
+    state = result;
+    return true;
+}
+
+
+namespace detail {
+
+template <PieceColor COLOR, PieceType TYPE>
+constexpr void fill_fen_squares(const ChessBoard &board,
+                                std::array<char, 64> &squares) noexcept {
+    constexpr char NAMES[6] = {'K', 'Q', 'R', 'B', 'N', 'P'};
+    constexpr char name = (COLOR == PieceColor::WHITE)
+        ? NAMES[static_cast<int>(TYPE)]
+        : static_cast<char>(NAMES[static_cast<int>(TYPE)] - 'A' + 'a');
+    for (const std::uint64_t square : board.get_piece<COLOR, TYPE>()) {
+        squares[square] = name;
+    }
+}
+
+template <PieceColor COLOR>
+constexpr void fill_fen_squares(const ChessBoard &board,
+                                std::array<char, 64> &squares) noexcept {
+    fill_fen_squares<COLOR, PieceType::KING  >(board, squares);
+    fill_fen_squares<COLOR, PieceType::QUEEN >(board, squares);
+    fill_fen_squares<COLOR, PieceType::ROOK  >(board, squares);
+    fill_fen_squares<COLOR, PieceType::BISHOP>(board, squares);
+    fill_fen_squares<COLOR, PieceType::KNIGHT>(board, squares);
+    fill_fen_squares<COLOR, PieceType::PAWN  >(board, squares);
+}
+
+// Layout of one rank of the placement field, given which of its squares
+// are occupied: the gap digits, with the k-th piece of the rank to be
+// stored at text[slot[k]]. Unused slots point past the end of the rank,
+// where the next field overwrites them, so that writing a rank takes a
+// fixed number of stores and no branches on unpredictable occupancy.
+struct FenRankLayout {
+    char text[8];
+    std::uint8_t slot[8];
+    std::uint8_t file[8];
+    std::uint8_t length;
+};
+
+constexpr std::array<FenRankLayout, 256> compute_fen_rank_layouts() noexcept {
+    std::array<FenRankLayout, 256> result{};
+    for (unsigned occupied = 0; occupied < 256; ++occupied) {
+        FenRankLayout &layout = result[occupied];
+        std::uint8_t length = 0;
+        std::uint8_t pieces = 0;
+        char empty = '0';
+        for (std::uint8_t file = 0; file < 8; ++file) {
+            if (occupied & (1u << file)) {
+                if (empty != '0') { layout.text[length++] = empty; }
+                empty = '0';
+                layout.slot[pieces] = length;
+                layout.file[pieces] = file;
+                layout.text[length++] = '?';
+                ++pieces;
+            } else {
+                ++empty;
+            }
+        }
+        if (empty != '0') { layout.text[length++] = empty; }
+        for (; pieces < 8; ++pieces) { layout.slot[pieces] = length; }
+        layout.length = length;
+    }
+    return result;
+}
+
+constexpr std::array<FenRankLayout, 256> FEN_RANK_LAYOUTS =
+    compute_fen_rank_layouts();
+
+constexpr std::size_t write_fen_counter(std::uint32_t value,
+                                        char *out) noexcept {
+    char digits[10] = {};
+    std::size_t n = 0;
+    do {
+        digits[n++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    for (std::size_t j = 0; j < n; ++j) { out[j] = digits[n - 1 - j]; }
+    return n;
+}
+
+} // namespace detail
+
+
+// Writes the FEN string of a position to out, which must have room for
+// MAX_FEN_LENGTH characters, and returns its length. No terminating null
+// character is written.
+constexpr std::size_t write_fen(const ChessBoard &board,
+                                const PositionState &state,
+                                char *out) noexcept {
+    std::array<char, 64> squares{};
+    detail::fill_fen_squares<PieceColor::WHITE>(board, squares);
+    detail::fill_fen_squares<PieceColor::BLACK>(board, squares);
+    const std::uint64_t occupied = board.get_all_pieces().get_data();
+    std::size_t n = 0;
+    for (int rank = 7; rank >= 0; --rank) {
+        const std::size_t base = static_cast<std::size_t>(8 * rank);
+        const detail::FenRankLayout &layout =
+            detail::FEN_RANK_LAYOUTS[(occupied >> base) & 0xFF];
+        for (std::size_t k = 0; k < 8; ++k) { out[n + k] = layout.text[k]; }
+        for (std::size_t k = 0; k < 8; ++k) {
+            out[n + layout.slot[k]] = squares[base + layout.file[k]];
+        }
+        n += layout.length;
+        out[n] = '/';
+        n += static_cast<std::size_t>(rank != 0);
+    }
+    out[n++] = ' ';
+    out[n++] = (state.side_to_move == PieceColor::WHITE) ? 'w' : 'b';
+    out[n++] = ' ';
+    if (state.castling_rights == 0) { out[n++] = '-'; }
+    if (state.castling_rights & WHITE_KINGSIDE ) { out[n++] = 'K'; }
+    if (state.castling_rights & WHITE_QUEENSIDE) { out[n++] = 'Q'; }
+    if (state.castling_rights & BLACK_KINGSIDE ) { out[n++] = 'k'; }
+    if (state.castling_rights & BLACK_QUEENSIDE) { out[n++] = 'q'; }
+    out[n++] = ' ';
+    if (state.en_passant == NO_EN_PASSANT) {
+        out[n++] = '-';
+    } else {
+        out[n++] = static_cast<char>('a' + (state.en_passant & 7));
+        out[n++] = static_cast<char>('1' + (state.en_passant >> 3));
+    }
+    out[n++] = ' ';
+    n += detail::write_fen_counter(state.halfmove_clock, out + n);
+    out[n++] = ' ';
+    n += detail::write_fen_counter(state.fullmove_number, out + n);
+    return n;
+}
+
+
+inline std::string to_fen(const ChessBoard &board,
+                          const PositionState &state) {
+    char buffer[MAX_FEN_LENGTH];
+    return std::string(buffer, write_fen(board, state, buffer));
+}
+
+
+} // namespace DZChess
+
+#endif // DZCHESS_FEN_HPP_INCLUDED
@@ -0,0 +1,99 @@
+#include <chrono>   // for std::chrono::steady_clock
+#include <cstddef>  // for std::size_t
+#include <cstdint>  // for std::uint8_t, std::uint32_t
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ChessPiece.hpp"
+#include "ChessBoard.hpp"
+#include "Fen.hpp"
+#include "RandomGames.hpp"
+
+
+using namespace DZChess;
+
+
+template <typename Function>
+void benchmark(const std::string &name, std::size_t count, Function f) {
+    const auto start = std::chrono::steady_clock::now();
+    const long long checksum = f();
+    const auto stop = std::chrono::steady_clock::now();
+    const double seconds = std::chrono::duration<double>(stop - start).count();
+    std::cout << "    " << name << ": "
+              << 1.0e9 * seconds / static_cast<double>(count) << " ns/position"
+              << " (checksum " << checksum << ")" << std::endl;
+}
+
+
+int main() {
+
+    const std::size_t count = 1'000'000;
+    std::vector<ChessBoard> boards{};
+    std::vector<PositionState> states{};
+    boards.reserve(count);
+    states.reserve(count);
+    std::uint32_t ply = 0;
+    for (const auto &[board, color] : random_game_positions(count, 3)) {
+        // Each random game ends with a position in which the king of the
+        // side that just moved can be captured, which FEN cannot express.
+        if ((color == PieceColor::WHITE)
+                ? board.in_check<PieceColor::BLACK>()
+                : board.in_check<PieceColor::WHITE>()) {
+            continue;
+        }
+        PositionState state{};
+        state.side_to_move = color;
+        state.castling_rights = possible_castling_rights(
+            board, static_cast<std::uint8_t>(ply & 0xF));
+        state.halfmove_clock = ply % 100;
+        state.fullmove_number = 1 + ply / 2;
+        boards.push_back(board);
+        states.push_back(state);
+        ++ply;
+    }
+    const std::size_t size = boards.size();
+
+    // All strings share one buffer, as they would when read from a feed.
+    std::string text{};
+    std::vector<std::size_t> offsets{0};
+    text.reserve(size * 64);
+    offsets.reserve(size + 1);
+
+    std::cout << "FEN:" << std::endl;
+    benchmark("serialize", size, [&]() {
+        char buffer[MAX_FEN_LENGTH];
+        for (std::size_t i = 0; i < size; ++i) {
+            text.append(buffer, write_fen(boards[i], states[i], buffer));
+            offsets.push_back(text.size());
+        }
+        return static_cast<long long>(text.size());
+    });
+
+    std::size_t mismatches = 0;
+    benchmark("parse", size, [&]() {
+        const std::string_view view{text};
+        long long checksum = 0;
+        ChessBoard board{};
+        PositionState state{};
+        for (std::size_t i = 0; i < size; ++i) {
+            const bool ok = parse_fen(
+                view.substr(offsets[i], offsets[i + 1] - offsets[i]),
+                board, state);
+            mismatches += !ok || (board.get_hash() != boards[i].get_hash()) ||
+                          (state != states[i]);
+            checksum += static_cast<long long>(board.get_hash() & 0xFFFF);
+        }
+        return checksum;
+    });
+
+    if (mismatches == 0) {
+        std::cout << "All positions round-trip through FEN." << std::endl;
+    } else {
+        std::cout << "ERROR: " << mismatches
+                  << " positions did not round-trip." << std::endl;
+        return 1;
+    }
+
+}
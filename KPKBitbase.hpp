@@ -0,0 +1,250 @@
+#ifndef DZCHESS_KPK_BITBASE_HPP_INCLUDED
+#define DZCHESS_KPK_BITBASE_HPP_INCLUDED
+
+#include <array>   // for std::array
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::uint64_t, UINT64_C
+
+#include "ChessPiece.hpp"
+#include "ChessBoard.hpp"
+#include "KPKBitbaseData.hpp"
+
+namespace DZChess {
+
+
+// Win/draw bitbase for king and pawn versus king, embedded in the binary
+// (24 KiB) so that probing is a single bit lookup. Positions are seen from
+// the side with the pawn, which is moved to files a through d by
+// mirroring; they are indexed by the squares of the strong king, the weak
+// king and the pawn, and by the side to move.
+//
+// The generator below is constexpr, but evaluating it at compile time
+// takes several hundred million steps, well beyond the default constexpr
+// limits of GCC and Clang. KPKBitbaseGenerator.cpp runs it instead and
+// writes the result to KPKBitbaseData.hpp.
+namespace detail {
+
+constexpr std::size_t KPK_POSITIONS = 2 * 24 * 64 * 64;
+
+// Pawns on files a-d and ranks 2-7, 7th rank first.
+constexpr std::size_t kpk_index(bool strong_to_move, std::uint64_t strong_king,
+                                std::uint64_t weak_king,
+                                std::uint64_t pawn) noexcept {
+    return strong_king | (weak_king << 6) |
+           (static_cast<std::size_t>(!strong_to_move) << 12) |
+           ((pawn & 7) << 13) | ((6 - (pawn >> 3)) << 15);
+}
+
+constexpr std::uint64_t square_distance(std::uint64_t a,
+                                        std::uint64_t b) noexcept {
+    const std::uint64_t files = ((a & 7) > (b & 7)) ? (a & 7) - (b & 7)
+                                                    : (b & 7) - (a & 7);
+    const std::uint64_t ranks = ((a >> 3) > (b >> 3)) ? (a >> 3) - (b >> 3)
+                                                      : (b >> 3) - (a >> 3);
+    return (files > ranks) ? files : ranks;
+}
+
+constexpr bool pawn_attacks(std::uint64_t pawn, std::uint64_t square) noexcept {
+    return ((square >> 3) == (pawn >> 3) + 1) &&
+           (square_distance(pawn, square) == 1) &&
+           ((square & 7) != (pawn & 7));
+}
+
+// Squares one king step away from each square, with 64 marking the unused
+// entries.
+constexpr std::array<std::array<std::uint64_t, 8>, 64>
+make_king_steps() noexcept {
+    std::array<std::array<std::uint64_t, 8>, 64> result{};
+    for (std::uint64_t square = 0; square < 64; ++square) {
+        std::size_t count = 0;
+        result[square].fill(64);
+        for (std::uint64_t target = 0; target < 64; ++target) {
+            if (square_distance(square, target) == 1) {
+                result[square][count++] = target;
+            }
+        }
+    }
+    return result;
+}
+
+constexpr std::array<std::array<std::uint64_t, 8>, 64> KING_STEPS =
+    make_king_steps();
+
+// Two bits per position during generation.
+enum class KPKState : std::uint64_t { INVALID, UNKNOWN, DRAW, WIN };
+
+using KPKStates = std::array<std::uint64_t, KPK_POSITIONS / 32>;
+
+constexpr KPKState get(const KPKStates &states, std::size_t index) noexcept {
+    const std::size_t shift = 2 * (index % 32);
+    return static_cast<KPKState>((states[index / 32] >> shift) & 3);
+}
+
+constexpr void set(KPKStates &states, std::size_t index,
+                   KPKState state) noexcept {
+    const std::size_t shift = 2 * (index % 32);
+    states[index / 32] &= ~(UINT64_C(3) << shift);
+    states[index / 32] |= static_cast<std::uint64_t>(state) << shift;
+}
+
+// Positions that are illegal or decided without looking at successors:
+// a pawn that promotes safely wins, and a stalemate or the capture of an
+// undefended pawn draws.
+constexpr KPKState kpk_initial_state(std::size_t index) noexcept {
+    const std::uint64_t strong_king = index & 63;
+    const std::uint64_t weak_king = (index >> 6) & 63;
+    const bool strong_to_move = ((index >> 12) & 1) == 0;
+    const std::uint64_t pawn = 8 * (6 - (index >> 15)) + ((index >> 13) & 3);
+    if ((square_distance(strong_king, weak_king) <= 1) ||
+        (strong_king == pawn) || (weak_king == pawn) ||
+        (strong_to_move && pawn_attacks(pawn, weak_king))) {
+        return KPKState::INVALID;
+    }
+    if (strong_to_move) {
+        const std::uint64_t queen = pawn + 8;
+        if (((pawn >> 3) == 6) && (strong_king != queen) &&
+            (weak_king != queen) &&
+            ((square_distance(weak_king, queen) > 1) ||
+             (square_distance(strong_king, queen) == 1))) {
+            return KPKState::WIN;
+        }
+        return KPKState::UNKNOWN;
+    }
+    bool can_move = false;
+    for (const std::uint64_t target : KING_STEPS[weak_king]) {
+        if ((target < 64) && (square_distance(target, strong_king) > 1) &&
+            !pawn_attacks(pawn, target)) {
+            can_move = true;
+        }
+    }
+    if (!can_move) {
+        return pawn_attacks(pawn, weak_king) ? KPKState::WIN
+                                             : KPKState::DRAW;
+    }
+    if ((square_distance(weak_king, pawn) == 1) &&
+        (square_distance(strong_king, pawn) > 1)) {
+        return KPKState::DRAW;
+    }
+    return KPKState::UNKNOWN;
+}
+
+// An unknown position is won if the strong side can move to a win, or
+// every move of the weak side leads to one, and drawn if no successor can
+// still become good for the side to move. Illegal successors count as
+// neither.
+constexpr KPKState kpk_next_state(const KPKStates &states,
+                                  std::size_t index) noexcept {
+    const std::uint64_t strong_king = index & 63;
+    const std::uint64_t weak_king = (index >> 6) & 63;
+    const bool strong_to_move = ((index >> 12) & 1) == 0;
+    const std::uint64_t pawn = 8 * (6 - (index >> 15)) + ((index >> 13) & 3);
+    unsigned seen = 0;
+    if (strong_to_move) {
+        for (const std::uint64_t target : KING_STEPS[strong_king]) {
+            if (target < 64) {
+                seen |= 1u << static_cast<unsigned>(get(states,
+                    kpk_index(false, target, weak_king, pawn)));
+            }
+        }
+        const std::uint64_t push = pawn + 8;
+        if (((pawn >> 3) < 6) && (push != strong_king) &&
+            (push != weak_king)) {
+            seen |= 1u << static_cast<unsigned>(get(states,
+                kpk_index(false, strong_king, weak_king, push)));
+            if (((pawn >> 3) == 1) && (push + 8 != strong_king) &&
+                (push + 8 != weak_king)) {
+                seen |= 1u << static_cast<unsigned>(get(states,
+                    kpk_index(false, strong_king, weak_king, push + 8)));
+            }
+        }
+    } else {
+        for (const std::uint64_t target : KING_STEPS[weak_king]) {
+            if (target < 64) {
+                seen |= 1u << static_cast<unsigned>(get(states,
+                    kpk_index(true, strong_king, target, pawn)));
+            }
+        }
+    }
+    const KPKState good = strong_to_move ? KPKState::WIN : KPKState::DRAW;
+    const KPKState bad = strong_to_move ? KPKState::DRAW : KPKState::WIN;
+    if (seen & (1u << static_cast<unsigned>(good))) { return good; }
+    if (seen & (1u << static_cast<unsigned>(KPKState::UNKNOWN))) {
+        return KPKState::UNKNOWN;
+    }
+    return bad;
+}
+
+// Sweeps the positions, updating them in place, until none changes, and
+// keeps one bit per position: whether the strong side wins.
+constexpr std::array<std::uint64_t, KPK_POSITIONS / 64>
+make_kpk_bitbase() noexcept {
+    KPKStates states{};
+    for (std::size_t index = 0; index < KPK_POSITIONS; ++index) {
+        set(states, index, kpk_initial_state(index));
+    }
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (std::size_t index = 0; index < KPK_POSITIONS; ++index) {
+            if (get(states, index) != KPKState::UNKNOWN) { continue; }
+            const KPKState next = kpk_next_state(states, index);
+            if (next != KPKState::UNKNOWN) {
+                set(states, index, next);
+                changed = true;
+            }
+        }
+    }
+    std::array<std::uint64_t, KPK_POSITIONS / 64> result{};
+    for (std::size_t index = 0; index < KPK_POSITIONS; ++index) {
+        if (get(states, index) == KPKState::WIN) {
+            result[index / 64] |= UINT64_C(1) << (index % 64);
+        }
+    }
+    return result;
+}
+
+} // namespace detail
+
+
+// Whether the side with the pawn wins, for a pawn that moves up the board
+// on files a-d.
+constexpr bool kpk_probe(bool strong_to_move, std::uint64_t strong_king,
+                         std::uint64_t weak_king,
+                         std::uint64_t pawn) noexcept {
+    const std::size_t index =
+        detail::kpk_index(strong_to_move, strong_king, weak_king, pawn);
+    return ((KPK_BITBASE[index / 64] >> (index % 64)) & 1) != 0;
+}
+
+
+// Whether the side with the pawn wins a legal position of king and pawn
+// versus king with COLOR to move.
+template <PieceColor COLOR>
+constexpr bool kpk_is_win(const ChessBoard &board) noexcept {
+    using enum PieceColor;
+    using enum PieceType;
+    const bool white_pawn = !board.get_piece<WHITE, PAWN>().is_empty();
+    const PieceColor strong = white_pawn ? WHITE : BLACK;
+    // Black pawns are mirrored top to bottom, pawns on files e-h left to
+    // right.
+    std::uint64_t strong_king = *(white_pawn ? board.get_piece<WHITE, KING>()
+                                             : board.get_piece<BLACK, KING>()
+                                  ).begin();
+    std::uint64_t weak_king = *(white_pawn ? board.get_piece<BLACK, KING>()
+                                           : board.get_piece<WHITE, KING>()
+                                ).begin();
+    std::uint64_t pawn = *(white_pawn ? board.get_piece<WHITE, PAWN>()
+                                      : board.get_piece<BLACK, PAWN>()
+                           ).begin();
+    const std::uint64_t flip = (white_pawn ? 0 : 56) ^
+                               (((pawn & 7) >= 4) ? 7 : 0);
+    strong_king ^= flip;
+    weak_king ^= flip;
+    pawn ^= flip;
+    return kpk_probe(COLOR == strong, strong_king, weak_king, pawn);
+}
+
+
+} // namespace DZChess
+
+#endif // DZCHESS_KPK_BITBASE_HPP_INCLUDED
@@ -0,0 +1,1554 @@
+#ifndef DZCHESS_KPK_BITBASE_DATA_HPP_INCLUDED
+#define DZCHESS_KPK_BITBASE_DATA_HPP_INCLUDED
+
+#include <array>   // for std::array
+#include <cstdint> // for std::uint64_t, UINT64_C
+
+namespace DZChess {
+
+
+// Generated by KPKBitbaseGenerator.cpp; do not edit. One bit per position
+// (see detail::kpk_index), set for the 111282 won positions.
+constexpr std::array<std::uint64_t, 3072> KPK_BITBASE = {
+    UINT64_C(0xfffefffffffffcfc), UINT64_C(0xfffefffffffff8f8),
+    UINT64_C(0xfffefffffffff1f1), UINT64_C(0xfffeffffffffe3e3),
+    UINT64_C(0xfffeffffffffc7c7), UINT64_C(0xfffeffffffff8f8f),
+    UINT64_C(0xfffeffffffff1f1f), UINT64_C(0xfffeffffffff3f3f),
+    UINT64_C(0xfffefffffffcfcfc), UINT64_C(0xfffefffffff8f8f8),
+    UINT64_C(0xfffefffffff1f1f1), UINT64_C(0xfffeffffffe3e3e3),
+    UINT64_C(0xfffeffffffc7c7c7), UINT64_C(0xfffeffffff8f8f8f),
+    UINT64_C(0xfffeffffff1f1f1f), UINT64_C(0xfffeffffff3f3f3f),
+    UINT64_C(0xfffefffffcfcfcff), UINT64_C(0xfffefffff8f8f8ff),
+    UINT64_C(0xfffefffff1f1f1ff), UINT64_C(0xfffeffffe3e3e3ff),
+    UINT64_C(0xfffeffffc7c7c7ff), UINT64_C(0xfffeffff8f8f8fff),
+    UINT64_C(0xfffeffff1f1f1fff), UINT64_C(0xfffeffff3f3f3fff),
+    UINT64_C(0xfffefffcfcfcffff), UINT64_C(0xfffefff8f8f8ffff),
+    UINT64_C(0xfffefff1f1f1ffff), UINT64_C(0xfffeffe3e3e3ffff),
+    UINT64_C(0xfffeffc7c7c7ffff), UINT64_C(0xfffeff8f8f8fffff),
+    UINT64_C(0xfffeff1f1f1fffff), UINT64_C(0xfffeff3f3f3fffff),
+    UINT64_C(0xfffefcfcfcffffff), UINT64_C(0xfffef8f8f8ffffff),
+    UINT64_C(0xfffef1f1f1ffffff), UINT64_C(0xfffee3e3e3ffffff),
+    UINT64_C(0xfffec7c7c7ffffff), UINT64_C(0xfffe8f8f8fffffff),
+    UINT64_C(0xfffe1f1f1fffffff), UINT64_C(0xfffe3f3f3fffffff),
+    UINT64_C(0xfffcfcfcffffffff), UINT64_C(0xfff8f8f8ffffffff),
+    UINT64_C(0xfff0f1f1ffffffff), UINT64_C(0xffe2e3e3ffffffff),
+    UINT64_C(0xffc6c7c7ffffffff), UINT64_C(0xff8e8f8fffffffff),
+    UINT64_C(0xff1e1f1fffffffff), UINT64_C(0xff3e3f3fffffffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0xf0f0f1ffffffffff), UINT64_C(0xe3e2e3ffffffffff),
+    UINT64_C(0xc7c6c7ffffffffff), UINT64_C(0x8f8e8fffffffffff),
+    UINT64_C(0x1f1e1fffffffffff), UINT64_C(0x3f3e3fffffffffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0xf0f0ffffffffffff), UINT64_C(0xe3e2ffffffffffff),
+    UINT64_C(0xc7c6ffffffffffff), UINT64_C(0x8f8effffffffffff),
+    UINT64_C(0x1f1effffffffffff), UINT64_C(0x3f3effffffffffff),
+    UINT64_C(0xfffefffffffffcfc), UINT64_C(0xfffefffffffff8f8),
+    UINT64_C(0xfffefffffffff1f1), UINT64_C(0xfffeffffffffe3e3),
+    UINT64_C(0xfffeffffffffc7c7), UINT64_C(0xfffeffffffff8f8f),
+    UINT64_C(0xfffeffffffff1f1f), UINT64_C(0xfffeffffffff3f3f),
+    UINT64_C(0xfffefffffffcfcfc), UINT64_C(0xfffefffffff8f8f8),
+    UINT64_C(0xfffefffffff1f1f1), UINT64_C(0xfffeffffffe3e3e3),
+    UINT64_C(0xfffeffffffc7c7c7), UINT64_C(0xfffeffffff8f8f8f),
+    UINT64_C(0xfffeffffff1f1f1f), UINT64_C(0xfffeffffff3f3f3f),
+    UINT64_C(0xfffefffffcfcfcff), UINT64_C(0xfffefffff8f8f8ff),
+    UINT64_C(0xfffefffff1f1f1ff), UINT64_C(0xfffeffffe3e3e3ff),
+    UINT64_C(0xfffeffffc7c7c7ff), UINT64_C(0xfffeffff8f8f8fff),
+    UINT64_C(0xfffeffff1f1f1fff), UINT64_C(0xfffeffff3f3f3fff),
+    UINT64_C(0xfffefffcfcfcffff), UINT64_C(0xfffefff8f8f8ffff),
+    UINT64_C(0xfffefff1f1f1ffff), UINT64_C(0xfffeffe3e3e3ffff),
+    UINT64_C(0xfffeffc7c7c7ffff), UINT64_C(0xfffeff8f8f8fffff),
+    UINT64_C(0xfffeff1f1f1fffff), UINT64_C(0xfffeff3f3f3fffff),
+    UINT64_C(0xfffefcfcfcffffff), UINT64_C(0xfffef8f8f8ffffff),
+    UINT64_C(0xfffef1f1f1ffffff), UINT64_C(0xfffee3e3e3ffffff),
+    UINT64_C(0xfffec7c7c7ffffff), UINT64_C(0xfffe8f8f8fffffff),
+    UINT64_C(0xfffe1f1f1fffffff), UINT64_C(0xfffe3f3f3fffffff),
+    UINT64_C(0x0300000000000000), UINT64_C(0x0200000000000000),
+    UINT64_C(0x0600010000000000), UINT64_C(0xfee2e3e3ffffffff),
+    UINT64_C(0xffc6c7c7ffffffff), UINT64_C(0xff8e8f8fffffffff),
+    UINT64_C(0xff1e1f1fffffffff), UINT64_C(0xff3e3f3fffffffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000010000000000), UINT64_C(0xe2e2e3ffffffffff),
+    UINT64_C(0xc7c6c7ffffffffff), UINT64_C(0x8f8e8fffffffffff),
+    UINT64_C(0x1f1e1fffffffffff), UINT64_C(0x3f3e3fffffffffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000070000000000), UINT64_C(0xe2e2ffffffffffff),
+    UINT64_C(0xc7c6ffffffffffff), UINT64_C(0x8f8effffffffffff),
+    UINT64_C(0x1f1effffffffffff), UINT64_C(0x3f3effffffffffff),
+    UINT64_C(0xfffdfffffffffcfc), UINT64_C(0xfffdfffffffff8f8),
+    UINT64_C(0xfffdfffffffff1f1), UINT64_C(0xfffdffffffffe3e3),
+    UINT64_C(0xfffdffffffffc7c7), UINT64_C(0xfffdffffffff8f8f),
+    UINT64_C(0xfffdffffffff1f1f), UINT64_C(0xfffdffffffff3f3f),
+    UINT64_C(0xfffdfffffffcfcfc), UINT64_C(0xfffdfffffff8f8f8),
+    UINT64_C(0xfffdfffffff1f1f1), UINT64_C(0xfffdffffffe3e3e3),
+    UINT64_C(0xfffdffffffc7c7c7), UINT64_C(0xfffdffffff8f8f8f),
+    UINT64_C(0xfffdffffff1f1f1f), UINT64_C(0xfffdffffff3f3f3f),
+    UINT64_C(0xfffdfffffcfcfcff), UINT64_C(0xfffdfffff8f8f8ff),
+    UINT64_C(0xfffdfffff1f1f1ff), UINT64_C(0xfffdffffe3e3e3ff),
+    UINT64_C(0xfffdffffc7c7c7ff), UINT64_C(0xfffdffff8f8f8fff),
+    UINT64_C(0xfffdffff1f1f1fff), UINT64_C(0xfffdffff3f3f3fff),
+    UINT64_C(0xfffdfffcfcfcffff), UINT64_C(0xfffdfff8f8f8ffff),
+    UINT64_C(0xfffdfff1f1f1ffff), UINT64_C(0xfffdffe3e3e3ffff),
+    UINT64_C(0xfffdffc7c7c7ffff), UINT64_C(0xfffdff8f8f8fffff),
+    UINT64_C(0xfffdff1f1f1fffff), UINT64_C(0xfffdff3f3f3fffff),
+    UINT64_C(0xfffdfcfcfcffffff), UINT64_C(0xfffdf8f8f8ffffff),
+    UINT64_C(0xfffdf1f1f1ffffff), UINT64_C(0xfffde3e3e3ffffff),
+    UINT64_C(0xfffdc7c7c7ffffff), UINT64_C(0xfffd8f8f8fffffff),
+    UINT64_C(0xfffd1f1f1fffffff), UINT64_C(0xfffd3f3f3fffffff),
+    UINT64_C(0xfffcfcfcffffffff), UINT64_C(0xfff8f8f8ffffffff),
+    UINT64_C(0xfff1f1f1ffffffff), UINT64_C(0xffe1e3e3ffffffff),
+    UINT64_C(0xffc5c7c7ffffffff), UINT64_C(0xff8d8f8fffffffff),
+    UINT64_C(0xff1d1f1fffffffff), UINT64_C(0xff3d3f3fffffffff),
+    UINT64_C(0x0c0c0c0000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0101010000000000), UINT64_C(0xe3e1e3ffffffffff),
+    UINT64_C(0xc7c5c7ffffffffff), UINT64_C(0x8f8d8fffffffffff),
+    UINT64_C(0x1f1d1fffffffffff), UINT64_C(0x3f3d3fffffffffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x00080a0f00000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0xe3e1ffffffffffff),
+    UINT64_C(0xc7c5ffffffffffff), UINT64_C(0x8f8dffffffffffff),
+    UINT64_C(0x1f1dffffffffffff), UINT64_C(0x3f3dffffffffffff),
+    UINT64_C(0xfffdfffffffffcfc), UINT64_C(0xfffdfffffffff8f8),
+    UINT64_C(0xfffdfffffffff1f1), UINT64_C(0xfffdffffffffe3e3),
+    UINT64_C(0xfffdffffffffc7c7), UINT64_C(0xfffdffffffff8f8f),
+    UINT64_C(0xfffdffffffff1f1f), UINT64_C(0xfffdffffffff3f3f),
+    UINT64_C(0xfffdfffffffcfcfc), UINT64_C(0xfffdfffffff8f8f8),
+    UINT64_C(0xfffdfffffff1f1f1), UINT64_C(0xfffdffffffe3e3e3),
+    UINT64_C(0xfffdffffffc7c7c7), UINT64_C(0xfffdffffff8f8f8f),
+    UINT64_C(0xfffdffffff1f1f1f), UINT64_C(0xfffdffffff3f3f3f),
+    UINT64_C(0xfffdfffffcfcfcff), UINT64_C(0xfffdfffff8f8f8ff),
+    UINT64_C(0xfffdfffff1f1f1ff), UINT64_C(0xfffdffffe3e3e3ff),
+    UINT64_C(0xfffdffffc7c7c7ff), UINT64_C(0xfffdffff8f8f8fff),
+    UINT64_C(0xfffdffff1f1f1fff), UINT64_C(0xfffdffff3f3f3fff),
+    UINT64_C(0xfffdfffcfcfcffff), UINT64_C(0xfffdfff8f8f8ffff),
+    UINT64_C(0xfffdfff1f1f1ffff), UINT64_C(0xfffdffe3e3e3ffff),
+    UINT64_C(0xfffdffc7c7c7ffff), UINT64_C(0xfffdff8f8f8fffff),
+    UINT64_C(0xfffdff1f1f1fffff), UINT64_C(0xfffdff3f3f3fffff),
+    UINT64_C(0xfffdfcfcfcffffff), UINT64_C(0xfffdf8f8f8ffffff),
+    UINT64_C(0xfffdf1f1f1ffffff), UINT64_C(0xfffde3e3e3ffffff),
+    UINT64_C(0xfffdc7c7c7ffffff), UINT64_C(0xfffd8f8f8fffffff),
+    UINT64_C(0xfffd1f1f1fffffff), UINT64_C(0xfffd3f3f3fffffff),
+    UINT64_C(0x0704040000000000), UINT64_C(0x0700000000000000),
+    UINT64_C(0x0701010000000000), UINT64_C(0x0f01030000000000),
+    UINT64_C(0xffc5c7c7ffffffff), UINT64_C(0xff8d8f8fffffffff),
+    UINT64_C(0xff1d1f1fffffffff), UINT64_C(0xff3d3f3fffffffff),
+    UINT64_C(0x0404000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0101000000000000), UINT64_C(0x0301030000000000),
+    UINT64_C(0xc7c5c7ffffffffff), UINT64_C(0x8f8d8fffffffffff),
+    UINT64_C(0x1f1d1fffffffffff), UINT64_C(0x3f3d3fffffffffff),
+    UINT64_C(0x0404020000000000), UINT64_C(0x0000050000000000),
+    UINT64_C(0x0101020000000000), UINT64_C(0x03010f0000000000),
+    UINT64_C(0xc7c5ffffffffffff), UINT64_C(0x8f8dffffffffffff),
+    UINT64_C(0x1f1dffffffffffff), UINT64_C(0x3f3dffffffffffff),
+    UINT64_C(0xfffbfffffffffcfc), UINT64_C(0xfffbfffffffff8f8),
+    UINT64_C(0xfffbfffffffff1f1), UINT64_C(0xfffbffffffffe3e3),
+    UINT64_C(0xfffbffffffffc7c7), UINT64_C(0xfffbffffffff8f8f),
+    UINT64_C(0xfffbffffffff1f1f), UINT64_C(0xfffbffffffff3f3f),
+    UINT64_C(0xfffbfffffffcfcfc), UINT64_C(0xfffbfffffff8f8f8),
+    UINT64_C(0xfffbfffffff1f1f1), UINT64_C(0xfffbffffffe3e3e3),
+    UINT64_C(0xfffbffffffc7c7c7), UINT64_C(0xfffbffffff8f8f8f),
+    UINT64_C(0xfffbffffff1f1f1f), UINT64_C(0xfffbffffff3f3f3f),
+    UINT64_C(0xfffbfffffcfcfcff), UINT64_C(0xfffbfffff8f8f8ff),
+    UINT64_C(0xfffbfffff1f1f1ff), UINT64_C(0xfffbffffe3e3e3ff),
+    UINT64_C(0xfffbffffc7c7c7ff), UINT64_C(0xfffbffff8f8f8fff),
+    UINT64_C(0xfffbffff1f1f1fff), UINT64_C(0xfffbffff3f3f3fff),
+    UINT64_C(0xfffbfffcfcfcffff), UINT64_C(0xfffbfff8f8f8ffff),
+    UINT64_C(0xfffbfff1f1f1ffff), UINT64_C(0xfffbffe3e3e3ffff),
+    UINT64_C(0xfffbffc7c7c7ffff), UINT64_C(0xfffbff8f8f8fffff),
+    UINT64_C(0xfffbff1f1f1fffff), UINT64_C(0xfffbff3f3f3fffff),
+    UINT64_C(0xfffbfcfcfcffffff), UINT64_C(0xfffbf8f8f8ffffff),
+    UINT64_C(0xfffbf1f1f1ffffff), UINT64_C(0xfffbe3e3e3ffffff),
+    UINT64_C(0xfffbc7c7c7ffffff), UINT64_C(0xfffb8f8f8fffffff),
+    UINT64_C(0xfffb1f1f1fffffff), UINT64_C(0xfffb3f3f3fffffff),
+    UINT64_C(0xfff8fcfcffffffff), UINT64_C(0xfff8f8f8ffffffff),
+    UINT64_C(0xfff1f1f1ffffffff), UINT64_C(0xffe3e3e3ffffffff),
+    UINT64_C(0xffc3c7c7ffffffff), UINT64_C(0xff8b8f8fffffffff),
+    UINT64_C(0xff1b1f1fffffffff), UINT64_C(0xff3b3f3fffffffff),
+    UINT64_C(0xfcf8fcffffffffff), UINT64_C(0x1818180000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0303030000000000),
+    UINT64_C(0xc7c3c7ffffffffff), UINT64_C(0x8f8b8fffffffffff),
+    UINT64_C(0x1f1b1fffffffffff), UINT64_C(0x3f3b3fffffffffff),
+    UINT64_C(0xfcf8ffffffffffff), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0011151f00000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0xc7c3ffffffffffff), UINT64_C(0x8f8bffffffffffff),
+    UINT64_C(0x1f1bffffffffffff), UINT64_C(0x3f3bffffffffffff),
+    UINT64_C(0xfffbfffffffffcfc), UINT64_C(0xfffbfffffffff8f8),
+    UINT64_C(0xfffbfffffffff1f1), UINT64_C(0xfffbffffffffe3e3),
+    UINT64_C(0xfffbffffffffc7c7), UINT64_C(0xfffbffffffff8f8f),
+    UINT64_C(0xfffbffffffff1f1f), UINT64_C(0xfffbffffffff3f3f),
+    UINT64_C(0xfffbfffffffcfcfc), UINT64_C(0xfffbfffffff8f8f8),
+    UINT64_C(0xfffbfffffff1f1f1), UINT64_C(0xfffbffffffe3e3e3),
+    UINT64_C(0xfffbffffffc7c7c7), UINT64_C(0xfffbffffff8f8f8f),
+    UINT64_C(0xfffbffffff1f1f1f), UINT64_C(0xfffbffffff3f3f3f),
+    UINT64_C(0xfffbfffffcfcfcff), UINT64_C(0xfffbfffff8f8f8ff),
+    UINT64_C(0xfffbfffff1f1f1ff), UINT64_C(0xfffbffffe3e3e3ff),
+    UINT64_C(0xfffbffffc7c7c7ff), UINT64_C(0xfffbffff8f8f8fff),
+    UINT64_C(0xfffbffff1f1f1fff), UINT64_C(0xfffbffff3f3f3fff),
+    UINT64_C(0xfffbfffcfcfcffff), UINT64_C(0xfffbfff8f8f8ffff),
+    UINT64_C(0xfffbfff1f1f1ffff), UINT64_C(0xfffbffe3e3e3ffff),
+    UINT64_C(0xfffbffc7c7c7ffff), UINT64_C(0xfffbff8f8f8fffff),
+    UINT64_C(0xfffbff1f1f1fffff), UINT64_C(0xfffbff3f3f3fffff),
+    UINT64_C(0xfffbfcfcfcffffff), UINT64_C(0xfffbf8f8f8ffffff),
+    UINT64_C(0xfffbf1f1f1ffffff), UINT64_C(0xfffbe3e3e3ffffff),
+    UINT64_C(0xfffbc7c7c7ffffff), UINT64_C(0xfffb8f8f8fffffff),
+    UINT64_C(0xfffb1f1f1fffffff), UINT64_C(0xfffb3f3f3fffffff),
+    UINT64_C(0x1f181c0000000000), UINT64_C(0x0e08080000000000),
+    UINT64_C(0x0e00000000000000), UINT64_C(0x0e02020000000000),
+    UINT64_C(0x1f03070000000000), UINT64_C(0xff8b8f8fffffffff),
+    UINT64_C(0xff1b1f1fffffffff), UINT64_C(0xff3b3f3fffffffff),
+    UINT64_C(0x1c181c0000000000), UINT64_C(0x0808000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0202000000000000),
+    UINT64_C(0x0703070000000000), UINT64_C(0x8f8b8fffffffffff),
+    UINT64_C(0x1f1b1fffffffffff), UINT64_C(0x3f3b3fffffffffff),
+    UINT64_C(0x1c181c0000000000), UINT64_C(0x0808040000000000),
+    UINT64_C(0x00000a0000000000), UINT64_C(0x0202040000000000),
+    UINT64_C(0x07031f0000000000), UINT64_C(0x8f8bffffffffffff),
+    UINT64_C(0x1f1bffffffffffff), UINT64_C(0x3f3bffffffffffff),
+    UINT64_C(0xfff7fffffffffcfc), UINT64_C(0xfff7fffffffff8f8),
+    UINT64_C(0xfff7fffffffff1f1), UINT64_C(0xfff7ffffffffe3e3),
+    UINT64_C(0xfff7ffffffffc7c7), UINT64_C(0xfff7ffffffff8f8f),
+    UINT64_C(0xfff7ffffffff1f1f), UINT64_C(0xfff7ffffffff3f3f),
+    UINT64_C(0xfff7fffffffcfcfc), UINT64_C(0xfff7fffffff8f8f8),
+    UINT64_C(0xfff7fffffff1f1f1), UINT64_C(0xfff7ffffffe3e3e3),
+    UINT64_C(0xfff7ffffffc7c7c7), UINT64_C(0xfff7ffffff8f8f8f),
+    UINT64_C(0xfff7ffffff1f1f1f), UINT64_C(0xfff7ffffff3f3f3f),
+    UINT64_C(0xfff7fffffcfcfcff), UINT64_C(0xfff7fffff8f8f8ff),
+    UINT64_C(0xfff7fffff1f1f1ff), UINT64_C(0xfff7ffffe3e3e3ff),
+    UINT64_C(0xfff7ffffc7c7c7ff), UINT64_C(0xfff7ffff8f8f8fff),
+    UINT64_C(0xfff7ffff1f1f1fff), UINT64_C(0xfff7ffff3f3f3fff),
+    UINT64_C(0xfff7fffcfcfcffff), UINT64_C(0xfff7fff8f8f8ffff),
+    UINT64_C(0xfff7fff1f1f1ffff), UINT64_C(0xfff7ffe3e3e3ffff),
+    UINT64_C(0xfff7ffc7c7c7ffff), UINT64_C(0xfff7ff8f8f8fffff),
+    UINT64_C(0xfff7ff1f1f1fffff), UINT64_C(0xfff7ff3f3f3fffff),
+    UINT64_C(0xfff7fcfcfcffffff), UINT64_C(0xfff7f8f8f8ffffff),
+    UINT64_C(0xfff7f1f1f1ffffff), UINT64_C(0xfff7e3e3e3ffffff),
+    UINT64_C(0xfff7c7c7c7ffffff), UINT64_C(0xfff78f8f8fffffff),
+    UINT64_C(0xfff71f1f1fffffff), UINT64_C(0xfff73f3f3fffffff),
+    UINT64_C(0xfff4fcfcffffffff), UINT64_C(0xfff0f8f8ffffffff),
+    UINT64_C(0xfff1f1f1ffffffff), UINT64_C(0xffe3e3e3ffffffff),
+    UINT64_C(0xffc7c7c7ffffffff), UINT64_C(0xff878f8fffffffff),
+    UINT64_C(0xff171f1fffffffff), UINT64_C(0xff373f3fffffffff),
+    UINT64_C(0xfcf4fcffffffffff), UINT64_C(0xf8f0f8ffffffffff),
+    UINT64_C(0x3030300000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0606060000000000), UINT64_C(0x8f878fffffffffff),
+    UINT64_C(0x1f171fffffffffff), UINT64_C(0x3f373fffffffffff),
+    UINT64_C(0xfcf4ffffffffffff), UINT64_C(0xf8f0ffffffffffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x00222a3e00000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x8f87ffffffffffff),
+    UINT64_C(0x1f17ffffffffffff), UINT64_C(0x3f37ffffffffffff),
+    UINT64_C(0xfff7fffffffffcfc), UINT64_C(0xfff7fffffffff8f8),
+    UINT64_C(0xfff7fffffffff1f1), UINT64_C(0xfff7ffffffffe3e3),
+    UINT64_C(0xfff7ffffffffc7c7), UINT64_C(0xfff7ffffffff8f8f),
+    UINT64_C(0xfff7ffffffff1f1f), UINT64_C(0xfff7ffffffff3f3f),
+    UINT64_C(0xfff7fffffffcfcfc), UINT64_C(0xfff7fffffff8f8f8),
+    UINT64_C(0xfff7fffffff1f1f1), UINT64_C(0xfff7ffffffe3e3e3),
+    UINT64_C(0xfff7ffffffc7c7c7), UINT64_C(0xfff7ffffff8f8f8f),
+    UINT64_C(0xfff7ffffff1f1f1f), UINT64_C(0xfff7ffffff3f3f3f),
+    UINT64_C(0xfff7fffffcfcfcff), UINT64_C(0xfff7fffff8f8f8ff),
+    UINT64_C(0xfff7fffff1f1f1ff), UINT64_C(0xfff7ffffe3e3e3ff),
+    UINT64_C(0xfff7ffffc7c7c7ff), UINT64_C(0xfff7ffff8f8f8fff),
+    UINT64_C(0xfff7ffff1f1f1fff), UINT64_C(0xfff7ffff3f3f3fff),
+    UINT64_C(0xfff7fffcfcfcffff), UINT64_C(0xfff7fff8f8f8ffff),
+    UINT64_C(0xfff7fff1f1f1ffff), UINT64_C(0xfff7ffe3e3e3ffff),
+    UINT64_C(0xfff7ffc7c7c7ffff), UINT64_C(0xfff7ff8f8f8fffff),
+    UINT64_C(0xfff7ff1f1f1fffff), UINT64_C(0xfff7ff3f3f3fffff),
+    UINT64_C(0xfff7fcfcfcffffff), UINT64_C(0xfff7f8f8f8ffffff),
+    UINT64_C(0xfff7f1f1f1ffffff), UINT64_C(0xfff7e3e3e3ffffff),
+    UINT64_C(0xfff7c7c7c7ffffff), UINT64_C(0xfff78f8f8fffffff),
+    UINT64_C(0xfff71f1f1fffffff), UINT64_C(0xfff73f3f3fffffff),
+    UINT64_C(0xfff4fcfcffffffff), UINT64_C(0x3e30380000000000),
+    UINT64_C(0x1c10100000000000), UINT64_C(0x1c00000000000000),
+    UINT64_C(0x1c04040000000000), UINT64_C(0x3e060e0000000000),
+    UINT64_C(0xff171f1fffffffff), UINT64_C(0xff373f3fffffffff),
+    UINT64_C(0xfcf4fcffffffffff), UINT64_C(0x3830380000000000),
+    UINT64_C(0x1010000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0404000000000000), UINT64_C(0x0e060e0000000000),
+    UINT64_C(0x1f171fffffffffff), UINT64_C(0x3f373fffffffffff),
+    UINT64_C(0xfcf4ffffffffffff), UINT64_C(0x38303e0000000000),
+    UINT64_C(0x1010080000000000), UINT64_C(0x0000140000000000),
+    UINT64_C(0x0404080000000000), UINT64_C(0x0e063e0000000000),
+    UINT64_C(0x1f17ffffffffffff), UINT64_C(0x3f37ffffffffffff),
+    UINT64_C(0xfffffefffffffcfc), UINT64_C(0xfffffefffffff8f8),
+    UINT64_C(0xfffffefffffff1f1), UINT64_C(0xfffffeffffffe3e3),
+    UINT64_C(0xfffffeffffffc7c7), UINT64_C(0xfffffeffffff8f8f),
+    UINT64_C(0xfffffeffffff1f1f), UINT64_C(0xfffffeffffff3f3f),
+    UINT64_C(0xfffffefffffcfcfc), UINT64_C(0xfffffefffff8f8f8),
+    UINT64_C(0xfffffefffff1f1f1), UINT64_C(0xfffffeffffe3e3e3),
+    UINT64_C(0xfffffeffffc7c7c7), UINT64_C(0xfffffeffff8f8f8f),
+    UINT64_C(0xfffffeffff1f1f1f), UINT64_C(0xfffffeffff3f3f3f),
+    UINT64_C(0xfffffefffcfcfcff), UINT64_C(0xfffffefff8f8f8ff),
+    UINT64_C(0xfffffefff1f1f1ff), UINT64_C(0xfffffeffe3e3e3ff),
+    UINT64_C(0xfffffeffc7c7c7ff), UINT64_C(0xfffffeff8f8f8fff),
+    UINT64_C(0xfffffeff1f1f1fff), UINT64_C(0xfffffeff3f3f3fff),
+    UINT64_C(0xfffffefcfcfcffff), UINT64_C(0xfffffef8f8f8ffff),
+    UINT64_C(0xfffffef1f1f1ffff), UINT64_C(0xfffffee3e3e3ffff),
+    UINT64_C(0xfffffec7c7c7ffff), UINT64_C(0xfffffe8f8f8fffff),
+    UINT64_C(0xfffffe1f1f1fffff), UINT64_C(0xfffffe3f3f3fffff),
+    UINT64_C(0xfffffcfcfcffffff), UINT64_C(0xfffff8f8f8ffffff),
+    UINT64_C(0xfffff0f1f1ffffff), UINT64_C(0xffffe2e3e3ffffff),
+    UINT64_C(0xffffc6c7c7ffffff), UINT64_C(0xffff8e8f8fffffff),
+    UINT64_C(0xffff1e1f1fffffff), UINT64_C(0xffff3e3f3fffffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0200000000000000),
+    UINT64_C(0x0701000000000000), UINT64_C(0xffe3e2e3ffffffff),
+    UINT64_C(0xffc7c6c7ffffffff), UINT64_C(0xff8f8e8fffffffff),
+    UINT64_C(0xff1f1e1fffffffff), UINT64_C(0xff3f3e3fffffffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0xe3e3e2ffffffffff),
+    UINT64_C(0xc7c7c6ffffffffff), UINT64_C(0x8f8f8effffffffff),
+    UINT64_C(0x1f1f1effffffffff), UINT64_C(0x3f3f3effffffffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000060000000000), UINT64_C(0xe3e3feffffffffff),
+    UINT64_C(0xc7c7feffffffffff), UINT64_C(0x8f8ffeffffffffff),
+    UINT64_C(0x1f1ffeffffffffff), UINT64_C(0x3f3ffeffffffffff),
+    UINT64_C(0xfffffefffffffcfc), UINT64_C(0xfffffefffffff8f8),
+    UINT64_C(0xfffffefffffff1f1), UINT64_C(0xfffffeffffffe3e3),
+    UINT64_C(0xfffffeffffffc7c7), UINT64_C(0xfffffeffffff8f8f),
+    UINT64_C(0xfffffeffffff1f1f), UINT64_C(0xfffffeffffff3f3f),
+    UINT64_C(0xfffffefffffcfcfc), UINT64_C(0xfffffefffff8f8f8),
+    UINT64_C(0xfffffefffff1f1f1), UINT64_C(0xfffffeffffe3e3e3),
+    UINT64_C(0xfffffeffffc7c7c7), UINT64_C(0xfffffeffff8f8f8f),
+    UINT64_C(0xfffffeffff1f1f1f), UINT64_C(0xfffffeffff3f3f3f),
+    UINT64_C(0xfffffefffcfcfcff), UINT64_C(0xfffffefff8f8f8ff),
+    UINT64_C(0xfffffefff1f1f1ff), UINT64_C(0xfffffeffe3e3e3ff),
+    UINT64_C(0xfffffeffc7c7c7ff), UINT64_C(0xfffffeff8f8f8fff),
+    UINT64_C(0xfffffeff1f1f1fff), UINT64_C(0xfffffeff3f3f3fff),
+    UINT64_C(0xfffffefcfcfcffff), UINT64_C(0xfffffef8f8f8ffff),
+    UINT64_C(0xfffffef1f1f1ffff), UINT64_C(0xfffffee3e3e3ffff),
+    UINT64_C(0xfffffec7c7c7ffff), UINT64_C(0xfffffe8f8f8fffff),
+    UINT64_C(0xfffffe1f1f1fffff), UINT64_C(0xfffffe3f3f3fffff),
+    UINT64_C(0x0003000000000000), UINT64_C(0x0003000000000000),
+    UINT64_C(0x0207000000000000), UINT64_C(0x070f020200000000),
+    UINT64_C(0xffffc6c7c7ffffff), UINT64_C(0xffff8e8f8fffffff),
+    UINT64_C(0xffff1e1f1fffffff), UINT64_C(0xffff3e3f3fffffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0200000000000000), UINT64_C(0x0602020000000000),
+    UINT64_C(0xffc7c6c7ffffffff), UINT64_C(0xff8f8e8fffffffff),
+    UINT64_C(0xff1f1e1fffffffff), UINT64_C(0xff3f3e3fffffffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0202020000000000),
+    UINT64_C(0xc7c7c6ffffffffff), UINT64_C(0x8f8f8effffffffff),
+    UINT64_C(0x1f1f1effffffffff), UINT64_C(0x3f3f3effffffffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0202060000000000),
+    UINT64_C(0xc7c7feffffffffff), UINT64_C(0x8f8ffeffffffffff),
+    UINT64_C(0x1f1ffeffffffffff), UINT64_C(0x3f3ffeffffffffff),
+    UINT64_C(0xfffffdfffffffcfc), UINT64_C(0xfffffdfffffff8f8),
+    UINT64_C(0xfffffdfffffff1f1), UINT64_C(0xfffffdffffffe3e3),
+    UINT64_C(0xfffffdffffffc7c7), UINT64_C(0xfffffdffffff8f8f),
+    UINT64_C(0xfffffdffffff1f1f), UINT64_C(0xfffffdffffff3f3f),
+    UINT64_C(0xfffffdfffffcfcfc), UINT64_C(0xfffffdfffff8f8f8),
+    UINT64_C(0xfffffdfffff1f1f1), UINT64_C(0xfffffdffffe3e3e3),
+    UINT64_C(0xfffffdffffc7c7c7), UINT64_C(0xfffffdffff8f8f8f),
+    UINT64_C(0xfffffdffff1f1f1f), UINT64_C(0xfffffdffff3f3f3f),
+    UINT64_C(0xfffffdfffcfcfcff), UINT64_C(0xfffffdfff8f8f8ff),
+    UINT64_C(0xfffffdfff1f1f1ff), UINT64_C(0xfffffdffe3e3e3ff),
+    UINT64_C(0xfffffdffc7c7c7ff), UINT64_C(0xfffffdff8f8f8fff),
+    UINT64_C(0xfffffdff1f1f1fff), UINT64_C(0xfffffdff3f3f3fff),
+    UINT64_C(0xfffffdfcfcfcffff), UINT64_C(0xfffffdf8f8f8ffff),
+    UINT64_C(0xfffffdf1f1f1ffff), UINT64_C(0xfffffde3e3e3ffff),
+    UINT64_C(0xfffffdc7c7c7ffff), UINT64_C(0xfffffd8f8f8fffff),
+    UINT64_C(0xfffffd1f1f1fffff), UINT64_C(0xfffffd3f3f3fffff),
+    UINT64_C(0xfffffcfcfcffffff), UINT64_C(0xfffff8f8f8ffffff),
+    UINT64_C(0xfffff1f1f1ffffff), UINT64_C(0xffffe1e3e3ffffff),
+    UINT64_C(0xffffc5c7c7ffffff), UINT64_C(0xffff8d8f8fffffff),
+    UINT64_C(0xffff1d1f1fffffff), UINT64_C(0xffff3d3f3fffffff),
+    UINT64_C(0x0f0c0c0c00000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0701010100000000), UINT64_C(0x0f03010307000000),
+    UINT64_C(0xffc7c5c7ffffffff), UINT64_C(0xff8f8d8fffffffff),
+    UINT64_C(0xff1f1d1fffffffff), UINT64_C(0xff3f3d3fffffffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0303011f1f000000),
+    UINT64_C(0xc7c7c5ffffffffff), UINT64_C(0x8f8f8dffffffffff),
+    UINT64_C(0x1f1f1dffffffffff), UINT64_C(0x3f3f3dffffffffff),
+    UINT64_C(0x040c080f00000000), UINT64_C(0x0000050000000000),
+    UINT64_C(0x0101090f00000000), UINT64_C(0x03031d1f1f000000),
+    UINT64_C(0xc7c7fdffffffffff), UINT64_C(0x8f8ffdffffffffff),
+    UINT64_C(0x1f1ffdffffffffff), UINT64_C(0x3f3ffdffffffffff),
+    UINT64_C(0xfffffdfffffffcfc), UINT64_C(0xfffffdfffffff8f8),
+    UINT64_C(0xfffffdfffffff1f1), UINT64_C(0xfffffdffffffe3e3),
+    UINT64_C(0xfffffdffffffc7c7), UINT64_C(0xfffffdffffff8f8f),
+    UINT64_C(0xfffffdffffff1f1f), UINT64_C(0xfffffdffffff3f3f),
+    UINT64_C(0xfffffdfffffcfcfc), UINT64_C(0xfffffdfffff8f8f8),
+    UINT64_C(0xfffffdfffff1f1f1), UINT64_C(0xfffffdffffe3e3e3),
+    UINT64_C(0xfffffdffffc7c7c7), UINT64_C(0xfffffdffff8f8f8f),
+    UINT64_C(0xfffffdffff1f1f1f), UINT64_C(0xfffffdffff3f3f3f),
+    UINT64_C(0xfffffdfffcfcfcff), UINT64_C(0xfffffdfff8f8f8ff),
+    UINT64_C(0xfffffdfff1f1f1ff), UINT64_C(0xfffffdffe3e3e3ff),
+    UINT64_C(0xfffffdffc7c7c7ff), UINT64_C(0xfffffdff8f8f8fff),
+    UINT64_C(0xfffffdff1f1f1fff), UINT64_C(0xfffffdff3f3f3fff),
+    UINT64_C(0xfffffdfcfcfcffff), UINT64_C(0xfffffdf8f8f8ffff),
+    UINT64_C(0xfffffdf1f1f1ffff), UINT64_C(0xfffffde3e3e3ffff),
+    UINT64_C(0xfffffdc7c7c7ffff), UINT64_C(0xfffffd8f8f8fffff),
+    UINT64_C(0xfffffd1f1f1fffff), UINT64_C(0xfffffd3f3f3fffff),
+    UINT64_C(0x0007040400000000), UINT64_C(0x0007000000000000),
+    UINT64_C(0x0007010100000000), UINT64_C(0x070f010300000000),
+    UINT64_C(0x0f1f050707000000), UINT64_C(0xffff8d8f8fffffff),
+    UINT64_C(0xffff1d1f1fffffff), UINT64_C(0xffff3d3f3fffffff),
+    UINT64_C(0x0004040000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0001010000000000), UINT64_C(0x0703010300000000),
+    UINT64_C(0x0f07050707000000), UINT64_C(0xff8f8d8fffffffff),
+    UINT64_C(0xff1f1d1fffffffff), UINT64_C(0xff3f3d3fffffffff),
+    UINT64_C(0x0004000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0001010000000000), UINT64_C(0x0303010f00000000),
+    UINT64_C(0x0707051f07000000), UINT64_C(0x8f8f8dffffffffff),
+    UINT64_C(0x1f1f1dffffffffff), UINT64_C(0x3f3f3dffffffffff),
+    UINT64_C(0x0000050000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0101050000000000), UINT64_C(0x0303090f00000000),
+    UINT64_C(0x07071d1f1f000000), UINT64_C(0x8f8ffdffffffffff),
+    UINT64_C(0x1f1ffdffffffffff), UINT64_C(0x3f3ffdffffffffff),
+    UINT64_C(0xfffffbfffffffcfc), UINT64_C(0xfffffbfffffff8f8),
+    UINT64_C(0xfffffbfffffff1f1), UINT64_C(0xfffffbffffffe3e3),
+    UINT64_C(0xfffffbffffffc7c7), UINT64_C(0xfffffbffffff8f8f),
+    UINT64_C(0xfffffbffffff1f1f), UINT64_C(0xfffffbffffff3f3f),
+    UINT64_C(0xfffffbfffffcfcfc), UINT64_C(0xfffffbfffff8f8f8),
+    UINT64_C(0xfffffbfffff1f1f1), UINT64_C(0xfffffbffffe3e3e3),
+    UINT64_C(0xfffffbffffc7c7c7), UINT64_C(0xfffffbffff8f8f8f),
+    UINT64_C(0xfffffbffff1f1f1f), UINT64_C(0xfffffbffff3f3f3f),
+    UINT64_C(0xfffffbfffcfcfcff), UINT64_C(0xfffffbfff8f8f8ff),
+    UINT64_C(0xfffffbfff1f1f1ff), UINT64_C(0xfffffbffe3e3e3ff),
+    UINT64_C(0xfffffbffc7c7c7ff), UINT64_C(0xfffffbff8f8f8fff),
+    UINT64_C(0xfffffbff1f1f1fff), UINT64_C(0xfffffbff3f3f3fff),
+    UINT64_C(0xfffffbfcfcfcffff), UINT64_C(0xfffffbf8f8f8ffff),
+    UINT64_C(0xfffffbf1f1f1ffff), UINT64_C(0xfffffbe3e3e3ffff),
+    UINT64_C(0xfffffbc7c7c7ffff), UINT64_C(0xfffffb8f8f8fffff),
+    UINT64_C(0xfffffb1f1f1fffff), UINT64_C(0xfffffb3f3f3fffff),
+    UINT64_C(0xfffff8fcfcffffff), UINT64_C(0xfffff8f8f8ffffff),
+    UINT64_C(0xfffff1f1f1ffffff), UINT64_C(0xffffe3e3e3ffffff),
+    UINT64_C(0xffffc3c7c7ffffff), UINT64_C(0xffff8b8f8fffffff),
+    UINT64_C(0xffff1b1f1fffffff), UINT64_C(0xffff3b3f3fffffff),
+    UINT64_C(0x3f3c383c3e000000), UINT64_C(0x1e18181800000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0f03030300000000),
+    UINT64_C(0x1f0703070f000000), UINT64_C(0xff8f8b8fffffffff),
+    UINT64_C(0xff1f1b1fffffffff), UINT64_C(0xff3f3b3fffffffff),
+    UINT64_C(0x3c3c383f3f000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0707033f3f000000), UINT64_C(0x8f8f8bffffffffff),
+    UINT64_C(0x1f1f1bffffffffff), UINT64_C(0x3f3f3bffffffffff),
+    UINT64_C(0x3c3c3b3f3f000000), UINT64_C(0x1818191f00000000),
+    UINT64_C(0x00000a0000000000), UINT64_C(0x0303131f00000000),
+    UINT64_C(0x07073b3f3f000000), UINT64_C(0x8f8ffbffffffffff),
+    UINT64_C(0x1f1ffbffffffffff), UINT64_C(0x3f3ffbffffffffff),
+    UINT64_C(0xfffffbfffffffcfc), UINT64_C(0xfffffbfffffff8f8),
+    UINT64_C(0xfffffbfffffff1f1), UINT64_C(0xfffffbffffffe3e3),
+    UINT64_C(0xfffffbffffffc7c7), UINT64_C(0xfffffbffffff8f8f),
+    UINT64_C(0xfffffbffffff1f1f), UINT64_C(0xfffffbffffff3f3f),
+    UINT64_C(0xfffffbfffffcfcfc), UINT64_C(0xfffffbfffff8f8f8),
+    UINT64_C(0xfffffbfffff1f1f1), UINT64_C(0xfffffbffffe3e3e3),
+    UINT64_C(0xfffffbffffc7c7c7), UINT64_C(0xfffffbffff8f8f8f),
+    UINT64_C(0xfffffbffff1f1f1f), UINT64_C(0xfffffbffff3f3f3f),
+    UINT64_C(0xfffffbfffcfcfcff), UINT64_C(0xfffffbfff8f8f8ff),
+    UINT64_C(0xfffffbfff1f1f1ff), UINT64_C(0xfffffbffe3e3e3ff),
+    UINT64_C(0xfffffbffc7c7c7ff), UINT64_C(0xfffffbff8f8f8fff),
+    UINT64_C(0xfffffbff1f1f1fff), UINT64_C(0xfffffbff3f3f3fff),
+    UINT64_C(0xfffffbfcfcfcffff), UINT64_C(0xfffffbf8f8f8ffff),
+    UINT64_C(0xfffffbf1f1f1ffff), UINT64_C(0xfffffbe3e3e3ffff),
+    UINT64_C(0xfffffbc7c7c7ffff), UINT64_C(0xfffffb8f8f8fffff),
+    UINT64_C(0xfffffb1f1f1fffff), UINT64_C(0xfffffb3f3f3fffff),
+    UINT64_C(0x1e1f181c00000000), UINT64_C(0x000e080800000000),
+    UINT64_C(0x000e000000000000), UINT64_C(0x000e020200000000),
+    UINT64_C(0x0f1f030700000000), UINT64_C(0x1f3f0b0f0f000000),
+    UINT64_C(0xffff1b1f1fffffff), UINT64_C(0xffff3b3f3fffffff),
+    UINT64_C(0x1e1c181c00000000), UINT64_C(0x0008080000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0002020000000000),
+    UINT64_C(0x0f07030700000000), UINT64_C(0x1f0f0b0f0f000000),
+    UINT64_C(0xff1f1b1fffffffff), UINT64_C(0xff3f3b3fffffffff),
+    UINT64_C(0x1c1c181f00000000), UINT64_C(0x0008080000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0002020000000000),
+    UINT64_C(0x0707031f00000000), UINT64_C(0x0f0f0b3f0f000000),
+    UINT64_C(0x1f1f1bffffffffff), UINT64_C(0x3f3f3bffffffffff),
+    UINT64_C(0x1c1c191f00000000), UINT64_C(0x08080a0000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x02020a0000000000),
+    UINT64_C(0x0707131f00000000), UINT64_C(0x0f0f3b3f3f000000),
+    UINT64_C(0x1f1ffbffffffffff), UINT64_C(0x3f3ffbffffffffff),
+    UINT64_C(0xfffff7fffffffcfc), UINT64_C(0xfffff7fffffff8f8),
+    UINT64_C(0xfffff7fffffff1f1), UINT64_C(0xfffff7ffffffe3e3),
+    UINT64_C(0xfffff7ffffffc7c7), UINT64_C(0xfffff7ffffff8f8f),
+    UINT64_C(0xfffff7ffffff1f1f), UINT64_C(0xfffff7ffffff3f3f),
+    UINT64_C(0xfffff7fffffcfcfc), UINT64_C(0xfffff7fffff8f8f8),
+    UINT64_C(0xfffff7fffff1f1f1), UINT64_C(0xfffff7ffffe3e3e3),
+    UINT64_C(0xfffff7ffffc7c7c7), UINT64_C(0xfffff7ffff8f8f8f),
+    UINT64_C(0xfffff7ffff1f1f1f), UINT64_C(0xfffff7ffff3f3f3f),
+    UINT64_C(0xfffff7fffcfcfcff), UINT64_C(0xfffff7fff8f8f8ff),
+    UINT64_C(0xfffff7fff1f1f1ff), UINT64_C(0xfffff7ffe3e3e3ff),
+    UINT64_C(0xfffff7ffc7c7c7ff), UINT64_C(0xfffff7ff8f8f8fff),
+    UINT64_C(0xfffff7ff1f1f1fff), UINT64_C(0xfffff7ff3f3f3fff),
+    UINT64_C(0xfffff7fcfcfcffff), UINT64_C(0xfffff7f8f8f8ffff),
+    UINT64_C(0xfffff7f1f1f1ffff), UINT64_C(0xfffff7e3e3e3ffff),
+    UINT64_C(0xfffff7c7c7c7ffff), UINT64_C(0xfffff78f8f8fffff),
+    UINT64_C(0xfffff71f1f1fffff), UINT64_C(0xfffff73f3f3fffff),
+    UINT64_C(0xfffff4fcfcffffff), UINT64_C(0xfffff0f8f8ffffff),
+    UINT64_C(0xfffff1f1f1ffffff), UINT64_C(0xffffe3e3e3ffffff),
+    UINT64_C(0xffffc7c7c7ffffff), UINT64_C(0xffff878f8fffffff),
+    UINT64_C(0xffff171f1fffffff), UINT64_C(0xffff373f3fffffff),
+    UINT64_C(0xfffcf4fcffffffff), UINT64_C(0x7e7870787c000000),
+    UINT64_C(0x3c30303000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x1e06060600000000), UINT64_C(0x3f0f070f1f000000),
+    UINT64_C(0xff1f171fffffffff), UINT64_C(0xff3f373fffffffff),
+    UINT64_C(0xfcfcf4ffffffffff), UINT64_C(0x7878707f7f000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0f0f077f7f000000),
+    UINT64_C(0x1f1f17ffffffffff), UINT64_C(0x3f3f37ffffffffff),
+    UINT64_C(0xfcfcf7ffffffffff), UINT64_C(0x7878777f7f000000),
+    UINT64_C(0x3030323e00000000), UINT64_C(0x0000140000000000),
+    UINT64_C(0x0606263e00000000), UINT64_C(0x0f0f777f7f000000),
+    UINT64_C(0x1f1ff7ffffffffff), UINT64_C(0x3f3ff7ffffffffff),
+    UINT64_C(0xfffff7fffffffcfc), UINT64_C(0xfffff7fffffff8f8),
+    UINT64_C(0xfffff7fffffff1f1), UINT64_C(0xfffff7ffffffe3e3),
+    UINT64_C(0xfffff7ffffffc7c7), UINT64_C(0xfffff7ffffff8f8f),
+    UINT64_C(0xfffff7ffffff1f1f), UINT64_C(0xfffff7ffffff3f3f),
+    UINT64_C(0xfffff7fffffcfcfc), UINT64_C(0xfffff7fffff8f8f8),
+    UINT64_C(0xfffff7fffff1f1f1), UINT64_C(0xfffff7ffffe3e3e3),
+    UINT64_C(0xfffff7ffffc7c7c7), UINT64_C(0xfffff7ffff8f8f8f),
+    UINT64_C(0xfffff7ffff1f1f1f), UINT64_C(0xfffff7ffff3f3f3f),
+    UINT64_C(0xfffff7fffcfcfcff), UINT64_C(0xfffff7fff8f8f8ff),
+    UINT64_C(0xfffff7fff1f1f1ff), UINT64_C(0xfffff7ffe3e3e3ff),
+    UINT64_C(0xfffff7ffc7c7c7ff), UINT64_C(0xfffff7ff8f8f8fff),
+    UINT64_C(0xfffff7ff1f1f1fff), UINT64_C(0xfffff7ff3f3f3fff),
+    UINT64_C(0xfffff7fcfcfcffff), UINT64_C(0xfffff7f8f8f8ffff),
+    UINT64_C(0xfffff7f1f1f1ffff), UINT64_C(0xfffff7e3e3e3ffff),
+    UINT64_C(0xfffff7c7c7c7ffff), UINT64_C(0xfffff78f8f8fffff),
+    UINT64_C(0xfffff71f1f1fffff), UINT64_C(0xfffff73f3f3fffff),
+    UINT64_C(0x7e7f747c7c000000), UINT64_C(0x3c3e303800000000),
+    UINT64_C(0x001c101000000000), UINT64_C(0x001c000000000000),
+    UINT64_C(0x001c040400000000), UINT64_C(0x1e3e060e00000000),
+    UINT64_C(0x3f7f171f1f000000), UINT64_C(0xffff373f3fffffff),
+    UINT64_C(0x7e7c747c7c000000), UINT64_C(0x3c38303800000000),
+    UINT64_C(0x0010100000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0004040000000000), UINT64_C(0x1e0e060e00000000),
+    UINT64_C(0x3f1f171f1f000000), UINT64_C(0xff3f373fffffffff),
+    UINT64_C(0x7c7c747f7c000000), UINT64_C(0x3838303e00000000),
+    UINT64_C(0x0010100000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0004040000000000), UINT64_C(0x0e0e063e00000000),
+    UINT64_C(0x1f1f177f1f000000), UINT64_C(0x3f3f37ffffffffff),
+    UINT64_C(0x7c7c777f7f000000), UINT64_C(0x3838323e00000000),
+    UINT64_C(0x1010140000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0404140000000000), UINT64_C(0x0e0e263e00000000),
+    UINT64_C(0x1f1f777f7f000000), UINT64_C(0x3f3ff7ffffffffff),
+    UINT64_C(0xfffffffefffffcfc), UINT64_C(0xfffffffefffff8f8),
+    UINT64_C(0xfffffffefffff1f1), UINT64_C(0xfffffffeffffe3e3),
+    UINT64_C(0xfffffffeffffc7c7), UINT64_C(0xfffffffeffff8f8f),
+    UINT64_C(0xfffffffeffff1f1f), UINT64_C(0xfffffffeffff3f3f),
+    UINT64_C(0xfffffffefffcfcfc), UINT64_C(0xfffffffefff8f8f8),
+    UINT64_C(0xfffffffefff1f1f1), UINT64_C(0xfffffffeffe3e3e3),
+    UINT64_C(0xfffffffeffc7c7c7), UINT64_C(0xfffffffeff8f8f8f),
+    UINT64_C(0xfffffffeff1f1f1f), UINT64_C(0xfffffffeff3f3f3f),
+    UINT64_C(0xfffffffefcfcfcff), UINT64_C(0xfffffffef8f8f8ff),
+    UINT64_C(0xfffffffef1f1f1ff), UINT64_C(0xfffffffee3e3e3ff),
+    UINT64_C(0xfffffffec7c7c7ff), UINT64_C(0xfffffffe8f8f8fff),
+    UINT64_C(0xfffffffe1f1f1fff), UINT64_C(0xfffffffe3f3f3fff),
+    UINT64_C(0xfffffffcfcfcffff), UINT64_C(0xfffffff8f8f8ffff),
+    UINT64_C(0xfffffff0f1f1ffff), UINT64_C(0xffffffe2e3e3ffff),
+    UINT64_C(0xffffffc6c7c7ffff), UINT64_C(0xffffff8e8f8fffff),
+    UINT64_C(0xffffff1e1f1fffff), UINT64_C(0xffffff3e3f3fffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0003000000000000),
+    UINT64_C(0x0707010000000000), UINT64_C(0x0f0f030203000000),
+    UINT64_C(0xffffc7c6c7ffffff), UINT64_C(0xffff8f8e8fffffff),
+    UINT64_C(0xffff1f1e1fffffff), UINT64_C(0xffff3f3e3fffffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0200000000000000), UINT64_C(0x0703030200000000),
+    UINT64_C(0xffc7c7c6ffffffff), UINT64_C(0xff8f8f8effffffff),
+    UINT64_C(0xff1f1f1effffffff), UINT64_C(0xff3f3f3effffffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0303030000000000),
+    UINT64_C(0xc7c7c7feffffffff), UINT64_C(0x8f8f8ffeffffffff),
+    UINT64_C(0x1f1f1ffeffffffff), UINT64_C(0x3f3f3ffeffffffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0303070000000000),
+    UINT64_C(0xc7c7fffeffffffff), UINT64_C(0x8f8ffffeffffffff),
+    UINT64_C(0x1f1ffffeffffffff), UINT64_C(0x3f3ffffeffffffff),
+    UINT64_C(0xfffffffefffffcfc), UINT64_C(0xfffffffefffff8f8),
+    UINT64_C(0xfffffffefffff1f1), UINT64_C(0xfffffffeffffe3e3),
+    UINT64_C(0xfffffffeffffc7c7), UINT64_C(0xfffffffeffff8f8f),
+    UINT64_C(0xfffffffeffff1f1f), UINT64_C(0xfffffffeffff3f3f),
+    UINT64_C(0xfffffffefffcfcfc), UINT64_C(0xfffffffefff8f8f8),
+    UINT64_C(0xfffffffefff1f1f1), UINT64_C(0xfffffffeffe3e3e3),
+    UINT64_C(0xfffffffeffc7c7c7), UINT64_C(0xfffffffeff8f8f8f),
+    UINT64_C(0xfffffffeff1f1f1f), UINT64_C(0xfffffffeff3f3f3f),
+    UINT64_C(0xfffffffefcfcfcff), UINT64_C(0xfffffffef8f8f8ff),
+    UINT64_C(0xfffffffef1f1f1ff), UINT64_C(0xfffffffee3e3e3ff),
+    UINT64_C(0xfffffffec7c7c7ff), UINT64_C(0xfffffffe8f8f8fff),
+    UINT64_C(0xfffffffe1f1f1fff), UINT64_C(0xfffffffe3f3f3fff),
+    UINT64_C(0x0000030000000000), UINT64_C(0x0000030000000000),
+    UINT64_C(0x0003070000000000), UINT64_C(0x07070f0202000000),
+    UINT64_C(0x0f0f1f0607000000), UINT64_C(0xffffff8e8f8fffff),
+    UINT64_C(0xffffff1e1f1fffff), UINT64_C(0xffffff3e3f3fffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0002000000000000), UINT64_C(0x0206020200000000),
+    UINT64_C(0x070f070600000000), UINT64_C(0xffff8f8e8fffffff),
+    UINT64_C(0xffff1f1e1fffffff), UINT64_C(0xffff3f3e3fffffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0202020000000000),
+    UINT64_C(0x0707070000000000), UINT64_C(0xff8f8f8effffffff),
+    UINT64_C(0xff1f1f1effffffff), UINT64_C(0xff3f3f3effffffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0202000000000000),
+    UINT64_C(0x0707070000000000), UINT64_C(0x8f8f8ffeffffffff),
+    UINT64_C(0x1f1f1ffeffffffff), UINT64_C(0x3f3f3ffeffffffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0202000000000000),
+    UINT64_C(0x0707070000000000), UINT64_C(0x8f8ffffeffffffff),
+    UINT64_C(0x1f1ffffeffffffff), UINT64_C(0x3f3ffffeffffffff),
+    UINT64_C(0xfffffffdfffffcfc), UINT64_C(0xfffffffdfffff8f8),
+    UINT64_C(0xfffffffdfffff1f1), UINT64_C(0xfffffffdffffe3e3),
+    UINT64_C(0xfffffffdffffc7c7), UINT64_C(0xfffffffdffff8f8f),
+    UINT64_C(0xfffffffdffff1f1f), UINT64_C(0xfffffffdffff3f3f),
+    UINT64_C(0xfffffffdfffcfcfc), UINT64_C(0xfffffffdfff8f8f8),
+    UINT64_C(0xfffffffdfff1f1f1), UINT64_C(0xfffffffdffe3e3e3),
+    UINT64_C(0xfffffffdffc7c7c7), UINT64_C(0xfffffffdff8f8f8f),
+    UINT64_C(0xfffffffdff1f1f1f), UINT64_C(0xfffffffdff3f3f3f),
+    UINT64_C(0xfffffffdfcfcfcff), UINT64_C(0xfffffffdf8f8f8ff),
+    UINT64_C(0xfffffffdf1f1f1ff), UINT64_C(0xfffffffde3e3e3ff),
+    UINT64_C(0xfffffffdc7c7c7ff), UINT64_C(0xfffffffd8f8f8fff),
+    UINT64_C(0xfffffffd1f1f1fff), UINT64_C(0xfffffffd3f3f3fff),
+    UINT64_C(0xfffffffcfcfcffff), UINT64_C(0xfffffff8f8f8ffff),
+    UINT64_C(0xfffffff1f1f1ffff), UINT64_C(0xffffffe1e3e3ffff),
+    UINT64_C(0xffffffc5c7c7ffff), UINT64_C(0xffffff8d8f8fffff),
+    UINT64_C(0xffffff1d1f1fffff), UINT64_C(0xffffff3d3f3fffff),
+    UINT64_C(0x000f0c0c0c000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0007010101000000), UINT64_C(0x0f0f030103070000),
+    UINT64_C(0x1f1f070507070000), UINT64_C(0xffff8f8d8fffffff),
+    UINT64_C(0xffff1f1d1fffffff), UINT64_C(0xffff3f3d3fffffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0703030103000000),
+    UINT64_C(0x0f0707050f070000), UINT64_C(0xff8f8f8dffffffff),
+    UINT64_C(0xff1f1f1dffffffff), UINT64_C(0xff3f3f3dffffffff),
+    UINT64_C(0x0c0c0c0c00000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0101010100000000), UINT64_C(0x0303030d03000000),
+    UINT64_C(0x0707071d1f070000), UINT64_C(0x8f8f8ffdffffffff),
+    UINT64_C(0x1f1f1ffdffffffff), UINT64_C(0x3f3f3ffdffffffff),
+    UINT64_C(0x0c0c0f0d00000000), UINT64_C(0x00080f0d00000000),
+    UINT64_C(0x01010f0d00000000), UINT64_C(0x03031f1d03000000),
+    UINT64_C(0x07073f3d1f070000), UINT64_C(0x8f8ffffdffffffff),
+    UINT64_C(0x1f1ffffdffffffff), UINT64_C(0x3f3ffffdffffffff),
+    UINT64_C(0xfffffffdfffffcfc), UINT64_C(0xfffffffdfffff8f8),
+    UINT64_C(0xfffffffdfffff1f1), UINT64_C(0xfffffffdffffe3e3),
+    UINT64_C(0xfffffffdffffc7c7), UINT64_C(0xfffffffdffff8f8f),
+    UINT64_C(0xfffffffdffff1f1f), UINT64_C(0xfffffffdffff3f3f),
+    UINT64_C(0xfffffffdfffcfcfc), UINT64_C(0xfffffffdfff8f8f8),
+    UINT64_C(0xfffffffdfff1f1f1), UINT64_C(0xfffffffdffe3e3e3),
+    UINT64_C(0xfffffffdffc7c7c7), UINT64_C(0xfffffffdff8f8f8f),
+    UINT64_C(0xfffffffdff1f1f1f), UINT64_C(0xfffffffdff3f3f3f),
+    UINT64_C(0xfffffffdfcfcfcff), UINT64_C(0xfffffffdf8f8f8ff),
+    UINT64_C(0xfffffffdf1f1f1ff), UINT64_C(0xfffffffde3e3e3ff),
+    UINT64_C(0xfffffffdc7c7c7ff), UINT64_C(0xfffffffd8f8f8fff),
+    UINT64_C(0xfffffffd1f1f1fff), UINT64_C(0xfffffffd3f3f3fff),
+    UINT64_C(0x0000070404000000), UINT64_C(0x0000070000000000),
+    UINT64_C(0x0000070101000000), UINT64_C(0x00070f0103000000),
+    UINT64_C(0x0f0f1f0507070000), UINT64_C(0x1f1f3f0d0f070000),
+    UINT64_C(0xffffff1d1f1fffff), UINT64_C(0xffffff3d3f3fffff),
+    UINT64_C(0x0000040400000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000010100000000), UINT64_C(0x0007030103000000),
+    UINT64_C(0x070f070503000000), UINT64_C(0x0f1f0f0d0f070000),
+    UINT64_C(0xffff1f1d1fffffff), UINT64_C(0xffff3f3d3fffffff),
+    UINT64_C(0x0000040000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000010000000000), UINT64_C(0x0003030100000000),
+    UINT64_C(0x0707070503000000), UINT64_C(0x0f0f0f0d0f070000),
+    UINT64_C(0xff1f1f1dffffffff), UINT64_C(0xff3f3f3dffffffff),
+    UINT64_C(0x0004040000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0001010000000000), UINT64_C(0x0303030100000000),
+    UINT64_C(0x0707070d03000000), UINT64_C(0x0f0f0f1d0f070000),
+    UINT64_C(0x1f1f1ffdffffffff), UINT64_C(0x3f3f3ffdffffffff),
+    UINT64_C(0x0404070000000000), UINT64_C(0x0000070000000000),
+    UINT64_C(0x0101070000000000), UINT64_C(0x03030f0100000000),
+    UINT64_C(0x07071f0d03000000), UINT64_C(0x0f0f3f1d1f070000),
+    UINT64_C(0x1f1ffffdffffffff), UINT64_C(0x3f3ffffdffffffff),
+    UINT64_C(0xfffffffbfffffcfc), UINT64_C(0xfffffffbfffff8f8),
+    UINT64_C(0xfffffffbfffff1f1), UINT64_C(0xfffffffbffffe3e3),
+    UINT64_C(0xfffffffbffffc7c7), UINT64_C(0xfffffffbffff8f8f),
+    UINT64_C(0xfffffffbffff1f1f), UINT64_C(0xfffffffbffff3f3f),
+    UINT64_C(0xfffffffbfffcfcfc), UINT64_C(0xfffffffbfff8f8f8),
+    UINT64_C(0xfffffffbfff1f1f1), UINT64_C(0xfffffffbffe3e3e3),
+    UINT64_C(0xfffffffbffc7c7c7), UINT64_C(0xfffffffbff8f8f8f),
+    UINT64_C(0xfffffffbff1f1f1f), UINT64_C(0xfffffffbff3f3f3f),
+    UINT64_C(0xfffffffbfcfcfcff), UINT64_C(0xfffffffbf8f8f8ff),
+    UINT64_C(0xfffffffbf1f1f1ff), UINT64_C(0xfffffffbe3e3e3ff),
+    UINT64_C(0xfffffffbc7c7c7ff), UINT64_C(0xfffffffb8f8f8fff),
+    UINT64_C(0xfffffffb1f1f1fff), UINT64_C(0xfffffffb3f3f3fff),
+    UINT64_C(0xfffffff8fcfcffff), UINT64_C(0xfffffff8f8f8ffff),
+    UINT64_C(0xfffffff1f1f1ffff), UINT64_C(0xffffffe3e3e3ffff),
+    UINT64_C(0xffffffc3c7c7ffff), UINT64_C(0xffffff8b8f8fffff),
+    UINT64_C(0xffffff1b1f1fffff), UINT64_C(0xffffff3b3f3fffff),
+    UINT64_C(0x3f3f3c383c3e0000), UINT64_C(0x001e181818000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x000f030303000000),
+    UINT64_C(0x1f1f0703070f0000), UINT64_C(0x3f3f0f0b0f0f0000),
+    UINT64_C(0xffff1f1b1fffffff), UINT64_C(0xffff3f3b3fffffff),
+    UINT64_C(0x3e3c3c383c000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0f07070307000000), UINT64_C(0x1f0f0f0b1f0f0000),
+    UINT64_C(0xff1f1f1bffffffff), UINT64_C(0xff3f3f3bffffffff),
+    UINT64_C(0x3c3c3c3b3c000000), UINT64_C(0x1818181800000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0303030300000000),
+    UINT64_C(0x0707071b07000000), UINT64_C(0x0f0f0f3b3f0f0000),
+    UINT64_C(0x1f1f1ffbffffffff), UINT64_C(0x3f3f3ffbffffffff),
+    UINT64_C(0x3c3c3f3b3c000000), UINT64_C(0x18181f1b00000000),
+    UINT64_C(0x00111f1b00000000), UINT64_C(0x03031f1b00000000),
+    UINT64_C(0x07073f3b07000000), UINT64_C(0x0f0f7f7b3f0f0000),
+    UINT64_C(0x1f1ffffbffffffff), UINT64_C(0x3f3ffffbffffffff),
+    UINT64_C(0xfffffffbfffffcfc), UINT64_C(0xfffffffbfffff8f8),
+    UINT64_C(0xfffffffbfffff1f1), UINT64_C(0xfffffffbffffe3e3),
+    UINT64_C(0xfffffffbffffc7c7), UINT64_C(0xfffffffbffff8f8f),
+    UINT64_C(0xfffffffbffff1f1f), UINT64_C(0xfffffffbffff3f3f),
+    UINT64_C(0xfffffffbfffcfcfc), UINT64_C(0xfffffffbfff8f8f8),
+    UINT64_C(0xfffffffbfff1f1f1), UINT64_C(0xfffffffbffe3e3e3),
+    UINT64_C(0xfffffffbffc7c7c7), UINT64_C(0xfffffffbff8f8f8f),
+    UINT64_C(0xfffffffbff1f1f1f), UINT64_C(0xfffffffbff3f3f3f),
+    UINT64_C(0xfffffffbfcfcfcff), UINT64_C(0xfffffffbf8f8f8ff),
+    UINT64_C(0xfffffffbf1f1f1ff), UINT64_C(0xfffffffbe3e3e3ff),
+    UINT64_C(0xfffffffbc7c7c7ff), UINT64_C(0xfffffffb8f8f8fff),
+    UINT64_C(0xfffffffb1f1f1fff), UINT64_C(0xfffffffb3f3f3fff),
+    UINT64_C(0x001e1f181c000000), UINT64_C(0x00000e0808000000),
+    UINT64_C(0x00000e0000000000), UINT64_C(0x00000e0202000000),
+    UINT64_C(0x000f1f0307000000), UINT64_C(0x1f1f3f0b0f0f0000),
+    UINT64_C(0x3f3f7f1b1f0f0000), UINT64_C(0xffffff3b3f3fffff),
+    UINT64_C(0x001e1c181c000000), UINT64_C(0x0000080800000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000020200000000),
+    UINT64_C(0x000f070307000000), UINT64_C(0x0f1f0f0b07000000),
+    UINT64_C(0x1f3f1f1b1f0f0000), UINT64_C(0xffff3f3b3fffffff),
+    UINT64_C(0x001c1c1800000000), UINT64_C(0x0000080000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000020000000000),
+    UINT64_C(0x0007070300000000), UINT64_C(0x0f0f0f0b07000000),
+    UINT64_C(0x1f1f1f1b1f0f0000), UINT64_C(0xff3f3f3bffffffff),
+    UINT64_C(0x1c1c1c1800000000), UINT64_C(0x0008080000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0002020000000000),
+    UINT64_C(0x0707070300000000), UINT64_C(0x0f0f0f1b07000000),
+    UINT64_C(0x1f1f1f3b1f0f0000), UINT64_C(0x3f3f3ffbffffffff),
+    UINT64_C(0x1c1c1f1800000000), UINT64_C(0x08080e0000000000),
+    UINT64_C(0x00000e0000000000), UINT64_C(0x02020e0000000000),
+    UINT64_C(0x07071f0300000000), UINT64_C(0x0f0f3f1b07000000),
+    UINT64_C(0x1f1f7f3b3f0f0000), UINT64_C(0x3f3ffffbffffffff),
+    UINT64_C(0xfffffff7fffffcfc), UINT64_C(0xfffffff7fffff8f8),
+    UINT64_C(0xfffffff7fffff1f1), UINT64_C(0xfffffff7ffffe3e3),
+    UINT64_C(0xfffffff7ffffc7c7), UINT64_C(0xfffffff7ffff8f8f),
+    UINT64_C(0xfffffff7ffff1f1f), UINT64_C(0xfffffff7ffff3f3f),
+    UINT64_C(0xfffffff7fffcfcfc), UINT64_C(0xfffffff7fff8f8f8),
+    UINT64_C(0xfffffff7fff1f1f1), UINT64_C(0xfffffff7ffe3e3e3),
+    UINT64_C(0xfffffff7ffc7c7c7), UINT64_C(0xfffffff7ff8f8f8f),
+    UINT64_C(0xfffffff7ff1f1f1f), UINT64_C(0xfffffff7ff3f3f3f),
+    UINT64_C(0xfffffff7fcfcfcff), UINT64_C(0xfffffff7f8f8f8ff),
+    UINT64_C(0xfffffff7f1f1f1ff), UINT64_C(0xfffffff7e3e3e3ff),
+    UINT64_C(0xfffffff7c7c7c7ff), UINT64_C(0xfffffff78f8f8fff),
+    UINT64_C(0xfffffff71f1f1fff), UINT64_C(0xfffffff73f3f3fff),
+    UINT64_C(0xfffffff4fcfcffff), UINT64_C(0xfffffff0f8f8ffff),
+    UINT64_C(0xfffffff1f1f1ffff), UINT64_C(0xffffffe3e3e3ffff),
+    UINT64_C(0xffffffc7c7c7ffff), UINT64_C(0xffffff878f8fffff),
+    UINT64_C(0xffffff171f1fffff), UINT64_C(0xffffff373f3fffff),
+    UINT64_C(0xfffffcf4fcfc0000), UINT64_C(0x7e7e7870787c0000),
+    UINT64_C(0x003c303030000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x001e060606000000), UINT64_C(0x3f3f0f070f1f0000),
+    UINT64_C(0x7f7f1f171f1f0000), UINT64_C(0xffff3f373fffffff),
+    UINT64_C(0xfefcfcf4fefc0000), UINT64_C(0x7c78787078000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x1f0f0f070f000000),
+    UINT64_C(0x3f1f1f173f1f0000), UINT64_C(0xff3f3f37ffffffff),
+    UINT64_C(0xfcfcfcf7fffc0000), UINT64_C(0x7878787678000000),
+    UINT64_C(0x3030303000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0606060600000000), UINT64_C(0x0f0f0f370f000000),
+    UINT64_C(0x1f1f1f777f1f0000), UINT64_C(0x3f3f3ff7ffffffff),
+    UINT64_C(0xfcfcfff7fffc0000), UINT64_C(0x78787f7778000000),
+    UINT64_C(0x30303e3600000000), UINT64_C(0x00223e3600000000),
+    UINT64_C(0x06063e3600000000), UINT64_C(0x0f0f7f770f000000),
+    UINT64_C(0x1f1ffff77f1f0000), UINT64_C(0x3f3ffff7ffffffff),
+    UINT64_C(0xfffffff7fffffcfc), UINT64_C(0xfffffff7fffff8f8),
+    UINT64_C(0xfffffff7fffff1f1), UINT64_C(0xfffffff7ffffe3e3),
+    UINT64_C(0xfffffff7ffffc7c7), UINT64_C(0xfffffff7ffff8f8f),
+    UINT64_C(0xfffffff7ffff1f1f), UINT64_C(0xfffffff7ffff3f3f),
+    UINT64_C(0xfffffff7fffcfcfc), UINT64_C(0xfffffff7fff8f8f8),
+    UINT64_C(0xfffffff7fff1f1f1), UINT64_C(0xfffffff7ffe3e3e3),
+    UINT64_C(0xfffffff7ffc7c7c7), UINT64_C(0xfffffff7ff8f8f8f),
+    UINT64_C(0xfffffff7ff1f1f1f), UINT64_C(0xfffffff7ff3f3f3f),
+    UINT64_C(0xfffffff7fcfcfcff), UINT64_C(0xfffffff7f8f8f8ff),
+    UINT64_C(0xfffffff7f1f1f1ff), UINT64_C(0xfffffff7e3e3e3ff),
+    UINT64_C(0xfffffff7c7c7c7ff), UINT64_C(0xfffffff78f8f8fff),
+    UINT64_C(0xfffffff71f1f1fff), UINT64_C(0xfffffff73f3f3fff),
+    UINT64_C(0x7e7e7f747c7c0000), UINT64_C(0x003c3e3038000000),
+    UINT64_C(0x00001c1010000000), UINT64_C(0x00001c0000000000),
+    UINT64_C(0x00001c0404000000), UINT64_C(0x001e3e060e000000),
+    UINT64_C(0x3f3f7f171f1f0000), UINT64_C(0x7f7fff373f1f0000),
+    UINT64_C(0x7c7e7c7478000000), UINT64_C(0x003c383038000000),
+    UINT64_C(0x0000101000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000040400000000), UINT64_C(0x001e0e060e000000),
+    UINT64_C(0x1f3f1f170f000000), UINT64_C(0x3f7f3f373f1f0000),
+    UINT64_C(0x7c7c7c7478000000), UINT64_C(0x0038383000000000),
+    UINT64_C(0x0000100000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000040000000000), UINT64_C(0x000e0e0600000000),
+    UINT64_C(0x1f1f1f170f000000), UINT64_C(0x3f3f3f373f1f0000),
+    UINT64_C(0x7c7c7c7678000000), UINT64_C(0x3838383000000000),
+    UINT64_C(0x0010100000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0004040000000000), UINT64_C(0x0e0e0e0600000000),
+    UINT64_C(0x1f1f1f370f000000), UINT64_C(0x3f3f3f773f1f0000),
+    UINT64_C(0x7c7c7f7678000000), UINT64_C(0x38383e3000000000),
+    UINT64_C(0x10101c0000000000), UINT64_C(0x00001c0000000000),
+    UINT64_C(0x04041c0000000000), UINT64_C(0x0e0e3e0600000000),
+    UINT64_C(0x1f1f7f370f000000), UINT64_C(0x3f3fff777f1f0000),
+    UINT64_C(0xfffffffffefffcfc), UINT64_C(0xfffffffffefff8f8),
+    UINT64_C(0xfffffffffefff1f1), UINT64_C(0xfffffffffeffe3e3),
+    UINT64_C(0xfffffffffeffc7c7), UINT64_C(0xfffffffffeff8f8f),
+    UINT64_C(0xfffffffffeff1f1f), UINT64_C(0xfffffffffeff3f3f),
+    UINT64_C(0xfffffffffefcfcfc), UINT64_C(0xfffffffffef8f8f8),
+    UINT64_C(0xfffffffffef1f1f1), UINT64_C(0xfffffffffee3e3e3),
+    UINT64_C(0xfffffffffec7c7c7), UINT64_C(0xfffffffffe8f8f8f),
+    UINT64_C(0xfffffffffe1f1f1f), UINT64_C(0xfffffffffe3f3f3f),
+    UINT64_C(0xfffffffffcfcfcff), UINT64_C(0xfffffffff8f8f8ff),
+    UINT64_C(0xfffffffff0f1f1ff), UINT64_C(0xffffffffe2e3e3ff),
+    UINT64_C(0xffffffffc6c7c7ff), UINT64_C(0xffffffff8e8f8fff),
+    UINT64_C(0xffffffff1e1f1fff), UINT64_C(0xffffffff3e3f3fff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000030000000000),
+    UINT64_C(0x0007070100000000), UINT64_C(0x070f0f0302030000),
+    UINT64_C(0x0f1f1f0706070000), UINT64_C(0xffffff8f8e8fffff),
+    UINT64_C(0xffffff1f1e1fffff), UINT64_C(0xffffff3f3e3fffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0002000000000000), UINT64_C(0x0707030302000000),
+    UINT64_C(0x0f0f070706000000), UINT64_C(0xffff8f8f8effffff),
+    UINT64_C(0xffff1f1f1effffff), UINT64_C(0xffff3f3f3effffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0703030300000000),
+    UINT64_C(0x0f07070700000000), UINT64_C(0xff8f8f8ffeffffff),
+    UINT64_C(0xff1f1f1ffeffffff), UINT64_C(0xff3f3f3ffeffffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0303030000000000),
+    UINT64_C(0x0707070f00000000), UINT64_C(0x8f8f8ffffeffffff),
+    UINT64_C(0x1f1f1ffffeffffff), UINT64_C(0x3f3f3ffffeffffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0303070000000000),
+    UINT64_C(0x07070f0f00000000), UINT64_C(0x8f8ffffffeffffff),
+    UINT64_C(0x1f1ffffffeffffff), UINT64_C(0x3f3ffffffeffffff),
+    UINT64_C(0xfffffffffefffcfc), UINT64_C(0xfffffffffefff8f8),
+    UINT64_C(0xfffffffffefff1f1), UINT64_C(0xfffffffffeffe3e3),
+    UINT64_C(0xfffffffffeffc7c7), UINT64_C(0xfffffffffeff8f8f),
+    UINT64_C(0xfffffffffeff1f1f), UINT64_C(0xfffffffffeff3f3f),
+    UINT64_C(0xfffffffffefcfcfc), UINT64_C(0xfffffffffef8f8f8),
+    UINT64_C(0xfffffffffef1f1f1), UINT64_C(0xfffffffffee3e3e3),
+    UINT64_C(0xfffffffffec7c7c7), UINT64_C(0xfffffffffe8f8f8f),
+    UINT64_C(0xfffffffffe1f1f1f), UINT64_C(0xfffffffffe3f3f3f),
+    UINT64_C(0x0000000300000000), UINT64_C(0x0000000300000000),
+    UINT64_C(0x0000030700000000), UINT64_C(0x0007070f02020000),
+    UINT64_C(0x070f0f1f06070000), UINT64_C(0x0f1f1f3f0e0f0000),
+    UINT64_C(0xffffffff1e1f1fff), UINT64_C(0xffffffff3e3f3fff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000020000000000), UINT64_C(0x0002060202000000),
+    UINT64_C(0x07070f0706000000), UINT64_C(0x0f0f1f0f0e000000),
+    UINT64_C(0xffffff1f1e1fffff), UINT64_C(0xffffff3f3e3fffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0002020200000000),
+    UINT64_C(0x0707070700000000), UINT64_C(0x0f0f0f0f00000000),
+    UINT64_C(0xffff1f1f1effffff), UINT64_C(0xffff3f3f3effffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0002020000000000),
+    UINT64_C(0x0707070000000000), UINT64_C(0x0f0f0f0f00000000),
+    UINT64_C(0xff1f1f1ffeffffff), UINT64_C(0xff3f3f3ffeffffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0002000000000000),
+    UINT64_C(0x0707070000000000), UINT64_C(0x0f0f0f0f00000000),
+    UINT64_C(0x1f1f1ffffeffffff), UINT64_C(0x3f3f3ffffeffffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0202000000000000),
+    UINT64_C(0x0707070000000000), UINT64_C(0x0f0f0f0f00000000),
+    UINT64_C(0x1f1ffffffeffffff), UINT64_C(0x3f3ffffffeffffff),
+    UINT64_C(0xfffffffffdfffcfc), UINT64_C(0xfffffffffdfff8f8),
+    UINT64_C(0xfffffffffdfff1f1), UINT64_C(0xfffffffffdffe3e3),
+    UINT64_C(0xfffffffffdffc7c7), UINT64_C(0xfffffffffdff8f8f),
+    UINT64_C(0xfffffffffdff1f1f), UINT64_C(0xfffffffffdff3f3f),
+    UINT64_C(0xfffffffffdfcfcfc), UINT64_C(0xfffffffffdf8f8f8),
+    UINT64_C(0xfffffffffdf1f1f1), UINT64_C(0xfffffffffde3e3e3),
+    UINT64_C(0xfffffffffdc7c7c7), UINT64_C(0xfffffffffd8f8f8f),
+    UINT64_C(0xfffffffffd1f1f1f), UINT64_C(0xfffffffffd3f3f3f),
+    UINT64_C(0xfffffffffcfcfcff), UINT64_C(0xfffffffff8f8f8ff),
+    UINT64_C(0xfffffffff1f1f1ff), UINT64_C(0xffffffffe1e3e3ff),
+    UINT64_C(0xffffffffc5c7c7ff), UINT64_C(0xffffffff8d8f8fff),
+    UINT64_C(0xffffffff1d1f1fff), UINT64_C(0xffffffff3d3f3fff),
+    UINT64_C(0x00000f0c0c0c0000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000070101010000), UINT64_C(0x000f0f0301030700),
+    UINT64_C(0x0f1f1f0705070700), UINT64_C(0x1f3f3f0f0d0f1f0f),
+    UINT64_C(0xffffff1f1d1fffff), UINT64_C(0xffffff3f3d3fffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0007030301030000),
+    UINT64_C(0x0f0f0707050f0700), UINT64_C(0x1f1f0f0f0d1f1f0f),
+    UINT64_C(0xffff1f1f1dffffff), UINT64_C(0xffff3f3f3dffffff),
+    UINT64_C(0x000c0c0c0c000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0001010101000000), UINT64_C(0x0703030305030000),
+    UINT64_C(0x0f0707070d0f0700), UINT64_C(0x1f0f0f0f1d1f1f0f),
+    UINT64_C(0xff1f1f1ffdffffff), UINT64_C(0xff3f3f3ffdffffff),
+    UINT64_C(0x0c0c0c0e0d000000), UINT64_C(0x0000000505000000),
+    UINT64_C(0x0101010b0d000000), UINT64_C(0x030303171d030000),
+    UINT64_C(0x0707072f3d0f0700), UINT64_C(0x0f0f0f5f7d1f1f0f),
+    UINT64_C(0x1f1f1ffffdffffff), UINT64_C(0x3f3f3ffffdffffff),
+    UINT64_C(0x0c0c0f0f0c000000), UINT64_C(0x00080f0f00000000),
+    UINT64_C(0x01010f0f01000000), UINT64_C(0x03031f1f05030000),
+    UINT64_C(0x07073f3f0d0f0700), UINT64_C(0x0f0f7f7f1d1f1f0f),
+    UINT64_C(0x1f1ffffffdffffff), UINT64_C(0x3f3ffffffdffffff),
+    UINT64_C(0xfffffffffdfffcfc), UINT64_C(0xfffffffffdfff8f8),
+    UINT64_C(0xfffffffffdfff1f1), UINT64_C(0xfffffffffdffe3e3),
+    UINT64_C(0xfffffffffdffc7c7), UINT64_C(0xfffffffffdff8f8f),
+    UINT64_C(0xfffffffffdff1f1f), UINT64_C(0xfffffffffdff3f3f),
+    UINT64_C(0xfffffffffdfcfcfc), UINT64_C(0xfffffffffdf8f8f8),
+    UINT64_C(0xfffffffffdf1f1f1), UINT64_C(0xfffffffffde3e3e3),
+    UINT64_C(0xfffffffffdc7c7c7), UINT64_C(0xfffffffffd8f8f8f),
+    UINT64_C(0xfffffffffd1f1f1f), UINT64_C(0xfffffffffd3f3f3f),
+    UINT64_C(0x0000000704040000), UINT64_C(0x0000000700000000),
+    UINT64_C(0x0000000701010000), UINT64_C(0x0000070f01030000),
+    UINT64_C(0x000f0f1f05070700), UINT64_C(0x0f1f1f3f0d0f0700),
+    UINT64_C(0x1f3f3f7f1d1f1f0f), UINT64_C(0xffffffff3d3f3fff),
+    UINT64_C(0x0000000404000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000101000000), UINT64_C(0x0000070301030000),
+    UINT64_C(0x00070f0705030000), UINT64_C(0x0f0f1f0f0d0f0700),
+    UINT64_C(0x1f1f3f1f1d1f1f0f), UINT64_C(0xffffff3f3d3fffff),
+    UINT64_C(0x0000000400000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000100000000), UINT64_C(0x0000030301000000),
+    UINT64_C(0x0007070705030000), UINT64_C(0x0f0f0f0f0d0f0700),
+    UINT64_C(0x1f1f1f1f1d1f1f0f), UINT64_C(0xffff3f3f3dffffff),
+    UINT64_C(0x0000040400000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000010100000000), UINT64_C(0x0003030301000000),
+    UINT64_C(0x0007070705030000), UINT64_C(0x0f0f0f0f0d0f0700),
+    UINT64_C(0x1f1f1f1f1d1f1f0f), UINT64_C(0xff3f3f3ffdffffff),
+    UINT64_C(0x0004040500000000), UINT64_C(0x0000000200000000),
+    UINT64_C(0x0001010500000000), UINT64_C(0x0003030b01000000),
+    UINT64_C(0x0707071705030000), UINT64_C(0x0f0f0f2f0d0f0700),
+    UINT64_C(0x1f1f1f5f1d1f1f0f), UINT64_C(0x3f3f3ffffdffffff),
+    UINT64_C(0x0404070400000000), UINT64_C(0x0000070000000000),
+    UINT64_C(0x0101070100000000), UINT64_C(0x03030f0301000000),
+    UINT64_C(0x07071f0705030000), UINT64_C(0x0f0f3f0f0d0f0700),
+    UINT64_C(0x1f1f7f5f1d1f1f0f), UINT64_C(0x3f3ffffffdffffff),
+    UINT64_C(0xfffffffffbfffcfc), UINT64_C(0xfffffffffbfff8f8),
+    UINT64_C(0xfffffffffbfff1f1), UINT64_C(0xfffffffffbffe3e3),
+    UINT64_C(0xfffffffffbffc7c7), UINT64_C(0xfffffffffbff8f8f),
+    UINT64_C(0xfffffffffbff1f1f), UINT64_C(0xfffffffffbff3f3f),
+    UINT64_C(0xfffffffffbfcfcfc), UINT64_C(0xfffffffffbf8f8f8),
+    UINT64_C(0xfffffffffbf1f1f1), UINT64_C(0xfffffffffbe3e3e3),
+    UINT64_C(0xfffffffffbc7c7c7), UINT64_C(0xfffffffffb8f8f8f),
+    UINT64_C(0xfffffffffb1f1f1f), UINT64_C(0xfffffffffb3f3f3f),
+    UINT64_C(0xfffffffff8fcfcff), UINT64_C(0xfffffffff8f8f8ff),
+    UINT64_C(0xfffffffff1f1f1ff), UINT64_C(0xffffffffe3e3e3ff),
+    UINT64_C(0xffffffffc3c7c7ff), UINT64_C(0xffffffff8b8f8fff),
+    UINT64_C(0xffffffff1b1f1fff), UINT64_C(0xffffffff3b3f3fff),
+    UINT64_C(0x003f3f3c383c3e00), UINT64_C(0x00001e1818180000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x00000f0303030000),
+    UINT64_C(0x001f1f0703070f00), UINT64_C(0x1f3f3f0f0b0f0f00),
+    UINT64_C(0x3f7f7f1f1b1f3f1f), UINT64_C(0xffffff3f3b3fffff),
+    UINT64_C(0x003e3c3c383c0000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x000f070703070000), UINT64_C(0x1f1f0f0f0b1f0f00),
+    UINT64_C(0x3f3f1f1f1b3f3f1f), UINT64_C(0xffff3f3f3bffffff),
+    UINT64_C(0x3e3c3c3c3a3c0000), UINT64_C(0x0018181818000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0003030303000000),
+    UINT64_C(0x0f0707070b070000), UINT64_C(0x1f0f0f0f1b1f0f00),
+    UINT64_C(0x3f1f1f1f3b3f3f1f), UINT64_C(0xff3f3f3ffbffffff),
+    UINT64_C(0x3c3c3c3e3b3c0000), UINT64_C(0x1818181d1b000000),
+    UINT64_C(0x0000000a0a000000), UINT64_C(0x030303171b000000),
+    UINT64_C(0x0707072f3b070000), UINT64_C(0x0f0f0f5f7b1f0f00),
+    UINT64_C(0x1f1f1fbffb3f3f1f), UINT64_C(0x3f3f3ffffbffffff),
+    UINT64_C(0x3c3c3f3f3a3c0000), UINT64_C(0x18181f1f18000000),
+    UINT64_C(0x00111f1f00000000), UINT64_C(0x03031f1f03000000),
+    UINT64_C(0x07073f3f0b070000), UINT64_C(0x0f0f7f7f1b1f0f00),
+    UINT64_C(0x1f1fffff3b3f3f1f), UINT64_C(0x3f3ffffffbffffff),
+    UINT64_C(0xfffffffffbfffcfc), UINT64_C(0xfffffffffbfff8f8),
+    UINT64_C(0xfffffffffbfff1f1), UINT64_C(0xfffffffffbffe3e3),
+    UINT64_C(0xfffffffffbffc7c7), UINT64_C(0xfffffffffbff8f8f),
+    UINT64_C(0xfffffffffbff1f1f), UINT64_C(0xfffffffffbff3f3f),
+    UINT64_C(0xfffffffffbfcfcfc), UINT64_C(0xfffffffffbf8f8f8),
+    UINT64_C(0xfffffffffbf1f1f1), UINT64_C(0xfffffffffbe3e3e3),
+    UINT64_C(0xfffffffffbc7c7c7), UINT64_C(0xfffffffffb8f8f8f),
+    UINT64_C(0xfffffffffb1f1f1f), UINT64_C(0xfffffffffb3f3f3f),
+    UINT64_C(0x00001e1f181c0000), UINT64_C(0x0000000e08080000),
+    UINT64_C(0x0000000e00000000), UINT64_C(0x0000000e02020000),
+    UINT64_C(0x00000f1f03070000), UINT64_C(0x001f1f3f0b0f0f00),
+    UINT64_C(0x1f3f3f7f1b1f0f00), UINT64_C(0x3f7f7fff3b3f3f1f),
+    UINT64_C(0x00001e1c181c0000), UINT64_C(0x0000000808000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000202000000),
+    UINT64_C(0x00000f0703070000), UINT64_C(0x000f1f0f0b070000),
+    UINT64_C(0x1f1f3f1f1b1f0f00), UINT64_C(0x3f3f7f3f3b3f3f1f),
+    UINT64_C(0x00001c1c18000000), UINT64_C(0x0000000800000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000200000000),
+    UINT64_C(0x0000070703000000), UINT64_C(0x000f0f0f0b070000),
+    UINT64_C(0x1f1f1f1f1b1f0f00), UINT64_C(0x3f3f3f3f3b3f3f1f),
+    UINT64_C(0x001c1c1c18000000), UINT64_C(0x0000080800000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000020200000000),
+    UINT64_C(0x0007070703000000), UINT64_C(0x000f0f0f0b070000),
+    UINT64_C(0x1f1f1f1f1b1f0f00), UINT64_C(0x3f3f3f3f3b3f3f1f),
+    UINT64_C(0x001c1c1d18000000), UINT64_C(0x0008080a00000000),
+    UINT64_C(0x0000000400000000), UINT64_C(0x0002020a00000000),
+    UINT64_C(0x0007071703000000), UINT64_C(0x0f0f0f2f0b070000),
+    UINT64_C(0x1f1f1f5f1b1f0f00), UINT64_C(0x3f3f3fbf3b3f3f1f),
+    UINT64_C(0x1c1c1f1c18000000), UINT64_C(0x08080e0800000000),
+    UINT64_C(0x00000e0000000000), UINT64_C(0x02020e0200000000),
+    UINT64_C(0x07071f0703000000), UINT64_C(0x0f0f3f0f0b070000),
+    UINT64_C(0x1f1f7f1f1b1f0f00), UINT64_C(0x3f3fffbf3b3f3f1f),
+    UINT64_C(0xfffffffff7fffcfc), UINT64_C(0xfffffffff7fff8f8),
+    UINT64_C(0xfffffffff7fff1f1), UINT64_C(0xfffffffff7ffe3e3),
+    UINT64_C(0xfffffffff7ffc7c7), UINT64_C(0xfffffffff7ff8f8f),
+    UINT64_C(0xfffffffff7ff1f1f), UINT64_C(0xfffffffff7ff3f3f),
+    UINT64_C(0xfffffffff7fcfcfc), UINT64_C(0xfffffffff7f8f8f8),
+    UINT64_C(0xfffffffff7f1f1f1), UINT64_C(0xfffffffff7e3e3e3),
+    UINT64_C(0xfffffffff7c7c7c7), UINT64_C(0xfffffffff78f8f8f),
+    UINT64_C(0xfffffffff71f1f1f), UINT64_C(0xfffffffff73f3f3f),
+    UINT64_C(0xfffffffff4fcfcff), UINT64_C(0xfffffffff0f8f8ff),
+    UINT64_C(0xfffffffff1f1f1ff), UINT64_C(0xffffffffe3e3e3ff),
+    UINT64_C(0xffffffffc7c7c7ff), UINT64_C(0xffffffff878f8fff),
+    UINT64_C(0xffffffff171f1fff), UINT64_C(0xffffffff373f3fff),
+    UINT64_C(0xfefffffcf4fcfc00), UINT64_C(0x007e7e7870787c00),
+    UINT64_C(0x00003c3030300000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x00001e0606060000), UINT64_C(0x003f3f0f070f1f00),
+    UINT64_C(0x3f7f7f1f171f1f00), UINT64_C(0x7fffff3f373f7f3f),
+    UINT64_C(0xfefefcfcf4fefc00), UINT64_C(0x007c787870780000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x001f0f0f070f0000),
+    UINT64_C(0x3f3f1f1f173f1f00), UINT64_C(0x7f7f3f3f377f7f3f),
+    UINT64_C(0xfefcfcfcf6fefc00), UINT64_C(0x7c78787874780000),
+    UINT64_C(0x0030303030000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0006060606000000), UINT64_C(0x1f0f0f0f170f0000),
+    UINT64_C(0x3f1f1f1f373f1f00), UINT64_C(0x7f3f3f3f777f7f3f),
+    UINT64_C(0xfcfcfcfef7fefc00), UINT64_C(0x7878787d77780000),
+    UINT64_C(0x3030303a36000000), UINT64_C(0x0000001414000000),
+    UINT64_C(0x0606062e36000000), UINT64_C(0x0f0f0f5f770f0000),
+    UINT64_C(0x1f1f1fbff73f1f00), UINT64_C(0x3f3f3f7ff77f7f3f),
+    UINT64_C(0xfcfcfffff6fefc00), UINT64_C(0x78787f7f74780000),
+    UINT64_C(0x30303e3e30000000), UINT64_C(0x00223e3e00000000),
+    UINT64_C(0x06063e3e06000000), UINT64_C(0x0f0f7f7f170f0000),
+    UINT64_C(0x1f1fffff373f1f00), UINT64_C(0x3f3fffff777f7f3f),
+    UINT64_C(0xfffffffff7fffcfc), UINT64_C(0xfffffffff7fff8f8),
+    UINT64_C(0xfffffffff7fff1f1), UINT64_C(0xfffffffff7ffe3e3),
+    UINT64_C(0xfffffffff7ffc7c7), UINT64_C(0xfffffffff7ff8f8f),
+    UINT64_C(0xfffffffff7ff1f1f), UINT64_C(0xfffffffff7ff3f3f),
+    UINT64_C(0xfffffffff7fcfcfc), UINT64_C(0xfffffffff7f8f8f8),
+    UINT64_C(0xfffffffff7f1f1f1), UINT64_C(0xfffffffff7e3e3e3),
+    UINT64_C(0xfffffffff7c7c7c7), UINT64_C(0xfffffffff78f8f8f),
+    UINT64_C(0xfffffffff71f1f1f), UINT64_C(0xfffffffff73f3f3f),
+    UINT64_C(0x007e7e7f747c7c00), UINT64_C(0x00003c3e30380000),
+    UINT64_C(0x0000001c10100000), UINT64_C(0x0000001c00000000),
+    UINT64_C(0x0000001c04040000), UINT64_C(0x00001e3e060e0000),
+    UINT64_C(0x003f3f7f171f1f00), UINT64_C(0x3f7f7fff373f1f00),
+    UINT64_C(0x007c7e7c74780000), UINT64_C(0x00003c3830380000),
+    UINT64_C(0x0000001010000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000404000000), UINT64_C(0x00001e0e060e0000),
+    UINT64_C(0x001f3f1f170f0000), UINT64_C(0x3f3f7f3f373f1f00),
+    UINT64_C(0x007c7c7c74780000), UINT64_C(0x0000383830000000),
+    UINT64_C(0x0000001000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000400000000), UINT64_C(0x00000e0e06000000),
+    UINT64_C(0x001f1f1f170f0000), UINT64_C(0x3f3f3f3f373f1f00),
+    UINT64_C(0x007c7c7c74780000), UINT64_C(0x0038383830000000),
+    UINT64_C(0x0000101000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000040400000000), UINT64_C(0x000e0e0e06000000),
+    UINT64_C(0x001f1f1f170f0000), UINT64_C(0x3f3f3f3f373f1f00),
+    UINT64_C(0x7c7c7c7d74780000), UINT64_C(0x0038383a30000000),
+    UINT64_C(0x0010101400000000), UINT64_C(0x0000000800000000),
+    UINT64_C(0x0004041400000000), UINT64_C(0x000e0e2e06000000),
+    UINT64_C(0x1f1f1f5f170f0000), UINT64_C(0x3f3f3fbf373f1f00),
+    UINT64_C(0x7c7c7f7c74780000), UINT64_C(0x38383e3830000000),
+    UINT64_C(0x10101c1000000000), UINT64_C(0x00001c0000000000),
+    UINT64_C(0x04041c0400000000), UINT64_C(0x0e0e3e0e06000000),
+    UINT64_C(0x1f1f7f1f170f0000), UINT64_C(0x3f3fff3f373f1f00),
+    UINT64_C(0xfffffffffffefcfc), UINT64_C(0xfffffffffffef8f8),
+    UINT64_C(0xfffffffffffef1f1), UINT64_C(0xfffffffffffee3e3),
+    UINT64_C(0xfffffffffffec7c7), UINT64_C(0xfffffffffffe8f8f),
+    UINT64_C(0xfffffffffffe1f1f), UINT64_C(0xfffffffffffe3f3f),
+    UINT64_C(0xfffffffffffcfcfc), UINT64_C(0xfffffffffff8f8f8),
+    UINT64_C(0xfffffffffff0f1f1), UINT64_C(0xffffffffffe2e3e3),
+    UINT64_C(0xffffffffffc6c7c7), UINT64_C(0xffffffffff8e8f8f),
+    UINT64_C(0xffffffffff1e1f1f), UINT64_C(0xffffffffff3e3f3f),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000300000000),
+    UINT64_C(0x0000070701000000), UINT64_C(0x00070f0f03020300),
+    UINT64_C(0x0f0f1f1f07060700), UINT64_C(0x1f1f3f3f0f0e0f00),
+    UINT64_C(0xffffffff1f1e1fff), UINT64_C(0xffffffff3f3e3fff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000020000000000), UINT64_C(0x0007070303020000),
+    UINT64_C(0x0f0f0f0707060000), UINT64_C(0x1f1f1f0f0f0e0000),
+    UINT64_C(0xffffff1f1f1effff), UINT64_C(0xffffff3f3f3effff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0007030303000000),
+    UINT64_C(0x0f0f070707000000), UINT64_C(0x1f1f0f0f0f000000),
+    UINT64_C(0xffff1f1f1ffeffff), UINT64_C(0xffff3f3f3ffeffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0003030300000000),
+    UINT64_C(0x0f07070700000000), UINT64_C(0x1f0f0f0f1f000000),
+    UINT64_C(0xff1f1f1ffffeffff), UINT64_C(0xff3f3f3ffffeffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0303030000000000),
+    UINT64_C(0x0707070f00000000), UINT64_C(0x0f0f0f1f1f000000),
+    UINT64_C(0x1f1f1ffffffeffff), UINT64_C(0x3f3f3ffffffeffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0303070000000000),
+    UINT64_C(0x07070f0f00000000), UINT64_C(0x0f0f1f1f1f000000),
+    UINT64_C(0x1f1ffffffffeffff), UINT64_C(0x3f3ffffffffeffff),
+    UINT64_C(0xfffffffffffefcfc), UINT64_C(0xfffffffffffef8f8),
+    UINT64_C(0xfffffffffffef1f1), UINT64_C(0xfffffffffffee3e3),
+    UINT64_C(0xfffffffffffec7c7), UINT64_C(0xfffffffffffe8f8f),
+    UINT64_C(0xfffffffffffe1f1f), UINT64_C(0xfffffffffffe3f3f),
+    UINT64_C(0x0000000003000000), UINT64_C(0x0000000003000000),
+    UINT64_C(0x0000000307000000), UINT64_C(0x000007070f020200),
+    UINT64_C(0x00070f0f1f060700), UINT64_C(0x0f0f1f1f3f0e0f00),
+    UINT64_C(0x1f1f3f3f7f1e1f00), UINT64_C(0xffffffffff3e3f3f),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000200000000), UINT64_C(0x0000020602020000),
+    UINT64_C(0x0007070f07060000), UINT64_C(0x0f0f0f1f0f0e0000),
+    UINT64_C(0x1f1f1f3f1f1e0000), UINT64_C(0xffffffff3f3e3fff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000020202000000),
+    UINT64_C(0x0007070707000000), UINT64_C(0x0f0f0f0f0f000000),
+    UINT64_C(0x1f1f1f1f1f000000), UINT64_C(0xffffff3f3f3effff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000020200000000),
+    UINT64_C(0x0007070700000000), UINT64_C(0x0f0f0f0f00000000),
+    UINT64_C(0x1f1f1f1f1f000000), UINT64_C(0xffff3f3f3ffeffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000020000000000),
+    UINT64_C(0x0007070000000000), UINT64_C(0x0f0f0f0f00000000),
+    UINT64_C(0x1f1f1f1f1f000000), UINT64_C(0xff3f3f3ffffeffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0002000000000000),
+    UINT64_C(0x0007070000000000), UINT64_C(0x0f0f0f0f00000000),
+    UINT64_C(0x1f1f1f1f1f000000), UINT64_C(0x3f3f3ffffffeffff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0202000000000000),
+    UINT64_C(0x0707070000000000), UINT64_C(0x0f0f0f0f00000000),
+    UINT64_C(0x1f1f1f1f1f000000), UINT64_C(0x3f3ffffffffeffff),
+    UINT64_C(0xfffffffffffdfcfc), UINT64_C(0xfffffffffffdf8f8),
+    UINT64_C(0xfffffffffffdf1f1), UINT64_C(0xfffffffffffde3e3),
+    UINT64_C(0xfffffffffffdc7c7), UINT64_C(0xfffffffffffd8f8f),
+    UINT64_C(0xfffffffffffd1f1f), UINT64_C(0xfffffffffffd3f3f),
+    UINT64_C(0xfffffffffffcfcfc), UINT64_C(0xfffffffffff8f8f8),
+    UINT64_C(0xfffffffffff1f1f1), UINT64_C(0xffffffffffe1e3e3),
+    UINT64_C(0xffffffffffc5c7c7), UINT64_C(0xffffffffff8d8f8f),
+    UINT64_C(0xffffffffff1d1f1f), UINT64_C(0xffffffffff3d3f3f),
+    UINT64_C(0x0000000f0c0c0c00), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000701010100), UINT64_C(0x00000f0f03010307),
+    UINT64_C(0x000f1f1f07050707), UINT64_C(0x1f1f3f3f0f0d0f1f),
+    UINT64_C(0x3f3f7f7f1f1d1f3f), UINT64_C(0xffffffff3f3d3fff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000070303010300),
+    UINT64_C(0x000f0f0707050f07), UINT64_C(0x1f1f1f0f0f0d1f1f),
+    UINT64_C(0x3f3f3f1f1f1d3f3f), UINT64_C(0xffffff3f3f3dffff),
+    UINT64_C(0x00000c0c0c0c0000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000010101010000), UINT64_C(0x0007030303050300),
+    UINT64_C(0x000f0707070d0f07), UINT64_C(0x1f1f0f0f0f1d1f1f),
+    UINT64_C(0x3f3f1f1f1f3d3f3f), UINT64_C(0xffff3f3f3ffdffff),
+    UINT64_C(0x000c0c0c0e0d0000), UINT64_C(0x0000000005050000),
+    UINT64_C(0x000101010b0d0000), UINT64_C(0x00030303171d0300),
+    UINT64_C(0x0f0707072f3d0f07), UINT64_C(0x1f0f0f0f5f7d1f1f),
+    UINT64_C(0x3f1f1f1fbffd3f3f), UINT64_C(0xff3f3f3ffffdffff),
+    UINT64_C(0x0c0c0c0f0f0c0000), UINT64_C(0x0000080f0f000000),
+    UINT64_C(0x0101010f0f010000), UINT64_C(0x0303031f1f050300),
+    UINT64_C(0x0707073f3f0d0f07), UINT64_C(0x0f0f0f7f7f1d1f1f),
+    UINT64_C(0x1f1f1fffff3d3f3f), UINT64_C(0x3f3f3ffffffdffff),
+    UINT64_C(0x0c1c1f1f1f1d0000), UINT64_C(0x00181f1f1f1d0000),
+    UINT64_C(0x01111f1f1f1d0000), UINT64_C(0x03031f1f1f1d0300),
+    UINT64_C(0x07073f3f3f3d0f07), UINT64_C(0x0f0f7f7f7f7d1f1f),
+    UINT64_C(0x1f1ffffffffd3f3f), UINT64_C(0x3f3ffffffffdffff),
+    UINT64_C(0xfffffffffffdfcfc), UINT64_C(0xfffffffffffdf8f8),
+    UINT64_C(0xfffffffffffdf1f1), UINT64_C(0xfffffffffffde3e3),
+    UINT64_C(0xfffffffffffdc7c7), UINT64_C(0xfffffffffffd8f8f),
+    UINT64_C(0xfffffffffffd1f1f), UINT64_C(0xfffffffffffd3f3f),
+    UINT64_C(0x0000000007040400), UINT64_C(0x0000000007000000),
+    UINT64_C(0x0000000007010100), UINT64_C(0x000000070f010300),
+    UINT64_C(0x00000f0f1f050707), UINT64_C(0x000f1f1f3f0d0f07),
+    UINT64_C(0x1f1f3f3f7f1d1f1f), UINT64_C(0x3f3f7f7fff3d3f3f),
+    UINT64_C(0x0000000004040000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000001010000), UINT64_C(0x0000000703010300),
+    UINT64_C(0x0000070f07050300), UINT64_C(0x000f0f1f0f0d0f07),
+    UINT64_C(0x1f1f1f3f1f1d1f1f), UINT64_C(0x3f3f3f7f3f3d3f3f),
+    UINT64_C(0x0000000004000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000001000000), UINT64_C(0x0000000303010000),
+    UINT64_C(0x0000070707050300), UINT64_C(0x000f0f0f0f0d0f07),
+    UINT64_C(0x1f1f1f1f1f1d1f1f), UINT64_C(0x3f3f3f3f3f3d3f3f),
+    UINT64_C(0x0000000404000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000101000000), UINT64_C(0x0000030303010000),
+    UINT64_C(0x0000070707050300), UINT64_C(0x000f0f0f0f0d0f07),
+    UINT64_C(0x1f1f1f1f1f1d1f1f), UINT64_C(0x3f3f3f3f3f3d3f3f),
+    UINT64_C(0x0000040405000000), UINT64_C(0x0000000002000000),
+    UINT64_C(0x0000010105000000), UINT64_C(0x000003030b010000),
+    UINT64_C(0x0007070717050300), UINT64_C(0x000f0f0f2f0d0f07),
+    UINT64_C(0x1f1f1f1f5f1d1f1f), UINT64_C(0x3f3f3f3fbf3d3f3f),
+    UINT64_C(0x0004040704000000), UINT64_C(0x0000000700000000),
+    UINT64_C(0x0001010701000000), UINT64_C(0x0003030f03010000),
+    UINT64_C(0x0007071f07050300), UINT64_C(0x0f0f0f3f0f0d0f07),
+    UINT64_C(0x1f1f1f7f1f1d1f1f), UINT64_C(0x3f3f3fffbf3d3f3f),
+    UINT64_C(0x04040f0f0f000000), UINT64_C(0x00000f0f0f000000),
+    UINT64_C(0x01010f0f0f000000), UINT64_C(0x03030f0f0f010000),
+    UINT64_C(0x07071f1f1f050300), UINT64_C(0x0f0f3f3f3f0d0f07),
+    UINT64_C(0x1f1f7f7f7f1d1f1f), UINT64_C(0x3f3fffffff3d3f3f),
+    UINT64_C(0xfffffffffffbfcfc), UINT64_C(0xfffffffffffbf8f8),
+    UINT64_C(0xfffffffffffbf1f1), UINT64_C(0xfffffffffffbe3e3),
+    UINT64_C(0xfffffffffffbc7c7), UINT64_C(0xfffffffffffb8f8f),
+    UINT64_C(0xfffffffffffb1f1f), UINT64_C(0xfffffffffffb3f3f),
+    UINT64_C(0xfffffffffff8fcfc), UINT64_C(0xfffffffffff8f8f8),
+    UINT64_C(0xfffffffffff1f1f1), UINT64_C(0xffffffffffe3e3e3),
+    UINT64_C(0xffffffffffc3c7c7), UINT64_C(0xffffffffff8b8f8f),
+    UINT64_C(0xffffffffff1b1f1f), UINT64_C(0xffffffffff3b3f3f),
+    UINT64_C(0x00003f3f3c383c3e), UINT64_C(0x0000001e18181800),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000f03030300),
+    UINT64_C(0x00001f1f0703070f), UINT64_C(0x001f3f3f0f0b0f0f),
+    UINT64_C(0x3f3f7f7f1f1b1f3f), UINT64_C(0x7f7fffff3f3b3f7f),
+    UINT64_C(0x00003e3c3c383c00), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x00000f0707030700), UINT64_C(0x001f1f0f0f0b1f0f),
+    UINT64_C(0x3f3f3f1f1f1b3f3f), UINT64_C(0x7f7f7f3f3f3b7f7f),
+    UINT64_C(0x003e3c3c3c3a3c00), UINT64_C(0x0000181818180000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000030303030000),
+    UINT64_C(0x000f0707070b0700), UINT64_C(0x001f0f0f0f1b1f0f),
+    UINT64_C(0x3f3f1f1f1f3b3f3f), UINT64_C(0x7f7f3f3f3f7b7f7f),
+    UINT64_C(0x003c3c3c3e3b3c00), UINT64_C(0x001818181d1b0000),
+    UINT64_C(0x000000000a0a0000), UINT64_C(0x00030303171b0000),
+    UINT64_C(0x000707072f3b0700), UINT64_C(0x1f0f0f0f5f7b1f0f),
+    UINT64_C(0x3f1f1f1fbffb3f3f), UINT64_C(0x7f3f3f3f7ffb7f7f),
+    UINT64_C(0x3c3c3c3f3f3a3c00), UINT64_C(0x1818181f1f180000),
+    UINT64_C(0x0000111f1f000000), UINT64_C(0x0303031f1f030000),
+    UINT64_C(0x0707073f3f0b0700), UINT64_C(0x0f0f0f7f7f1b1f0f),
+    UINT64_C(0x1f1f1fffff3b3f3f), UINT64_C(0x3f3f3fffff7b7f7f),
+    UINT64_C(0x3c3c3f3f3f3b3c00), UINT64_C(0x18383f3f3f3b0000),
+    UINT64_C(0x00313f3f3f3b0000), UINT64_C(0x03233f3f3f3b0000),
+    UINT64_C(0x07073f3f3f3b0700), UINT64_C(0x0f0f7f7f7f7b1f0f),
+    UINT64_C(0x1f1ffffffffb3f3f), UINT64_C(0x3f3ffffffffb7f7f),
+    UINT64_C(0xfffffffffffbfcfc), UINT64_C(0xfffffffffffbf8f8),
+    UINT64_C(0xfffffffffffbf1f1), UINT64_C(0xfffffffffffbe3e3),
+    UINT64_C(0xfffffffffffbc7c7), UINT64_C(0xfffffffffffb8f8f),
+    UINT64_C(0xfffffffffffb1f1f), UINT64_C(0xfffffffffffb3f3f),
+    UINT64_C(0x0000001e1f181c00), UINT64_C(0x000000000e080800),
+    UINT64_C(0x000000000e000000), UINT64_C(0x000000000e020200),
+    UINT64_C(0x0000000f1f030700), UINT64_C(0x00001f1f3f0b0f0f),
+    UINT64_C(0x001f3f3f7f1b1f0f), UINT64_C(0x3f3f7f7fff3b3f3f),
+    UINT64_C(0x0000001e1c181c00), UINT64_C(0x0000000008080000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000002020000),
+    UINT64_C(0x0000000f07030700), UINT64_C(0x00000f1f0f0b0700),
+    UINT64_C(0x001f1f3f1f1b1f0f), UINT64_C(0x3f3f3f7f3f3b3f3f),
+    UINT64_C(0x0000001c1c180000), UINT64_C(0x0000000008000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000002000000),
+    UINT64_C(0x0000000707030000), UINT64_C(0x00000f0f0f0b0700),
+    UINT64_C(0x001f1f1f1f1b1f0f), UINT64_C(0x3f3f3f3f3f3b3f3f),
+    UINT64_C(0x00001c1c1c180000), UINT64_C(0x0000000808000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000202000000),
+    UINT64_C(0x0000070707030000), UINT64_C(0x00000f0f0f0b0700),
+    UINT64_C(0x001f1f1f1f1b1f0f), UINT64_C(0x3f3f3f3f3f3b3f3f),
+    UINT64_C(0x00001c1c1d180000), UINT64_C(0x000008080a000000),
+    UINT64_C(0x0000000004000000), UINT64_C(0x000002020a000000),
+    UINT64_C(0x0000070717030000), UINT64_C(0x000f0f0f2f0b0700),
+    UINT64_C(0x001f1f1f5f1b1f0f), UINT64_C(0x3f3f3f3fbf3b3f3f),
+    UINT64_C(0x001c1c1f1c180000), UINT64_C(0x0008080e08000000),
+    UINT64_C(0x0000000e00000000), UINT64_C(0x0002020e02000000),
+    UINT64_C(0x0007071f07030000), UINT64_C(0x000f0f3f0f0b0700),
+    UINT64_C(0x1f1f1f7f1f1b1f0f), UINT64_C(0x3f3f3fff3f3b3f3f),
+    UINT64_C(0x1c1c1f1f1f180000), UINT64_C(0x08081f1f1f000000),
+    UINT64_C(0x00001f1f1f000000), UINT64_C(0x02021f1f1f000000),
+    UINT64_C(0x07071f1f1f030000), UINT64_C(0x0f0f3f3f3f0b0700),
+    UINT64_C(0x1f1f7f7f7f1b1f0f), UINT64_C(0x3f3fffffff3b3f3f),
+    UINT64_C(0xfffffffffff7fcfc), UINT64_C(0xfffffffffff7f8f8),
+    UINT64_C(0xfffffffffff7f1f1), UINT64_C(0xfffffffffff7e3e3),
+    UINT64_C(0xfffffffffff7c7c7), UINT64_C(0xfffffffffff78f8f),
+    UINT64_C(0xfffffffffff71f1f), UINT64_C(0xfffffffffff73f3f),
+    UINT64_C(0xfffffffffff4fcfc), UINT64_C(0xfffffffffff0f8f8),
+    UINT64_C(0xfffffffffff1f1f1), UINT64_C(0xffffffffffe3e3e3),
+    UINT64_C(0xffffffffffc7c7c7), UINT64_C(0xffffffffff878f8f),
+    UINT64_C(0xffffffffff171f1f), UINT64_C(0xffffffffff373f3f),
+    UINT64_C(0x00fefffffcf4fcfc), UINT64_C(0x00007e7e7870787c),
+    UINT64_C(0x0000003c30303000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000001e06060600), UINT64_C(0x00003f3f0f070f1f),
+    UINT64_C(0x003f7f7f1f171f1f), UINT64_C(0x7f7fffff3f373f7f),
+    UINT64_C(0x00fefefcfcf4fefc), UINT64_C(0x00007c7878707800),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x00001f0f0f070f00),
+    UINT64_C(0x003f3f1f1f173f1f), UINT64_C(0x7f7f7f3f3f377f7f),
+    UINT64_C(0x00fefcfcfcf6fefc), UINT64_C(0x007c787878747800),
+    UINT64_C(0x0000303030300000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000060606060000), UINT64_C(0x001f0f0f0f170f00),
+    UINT64_C(0x003f1f1f1f373f1f), UINT64_C(0x7f7f3f3f3f777f7f),
+    UINT64_C(0xfefcfcfcfef7fefc), UINT64_C(0x007878787d777800),
+    UINT64_C(0x003030303a360000), UINT64_C(0x0000000014140000),
+    UINT64_C(0x000606062e360000), UINT64_C(0x000f0f0f5f770f00),
+    UINT64_C(0x3f1f1f1fbff73f1f), UINT64_C(0x7f3f3f3f7ff77f7f),
+    UINT64_C(0xfcfcfcfffff6fefc), UINT64_C(0x7878787f7f747800),
+    UINT64_C(0x3030303e3e300000), UINT64_C(0x0000223e3e000000),
+    UINT64_C(0x0606063e3e060000), UINT64_C(0x0f0f0f7f7f170f00),
+    UINT64_C(0x1f1f1fffff373f1f), UINT64_C(0x3f3f3fffff777f7f),
+    UINT64_C(0xfcfcfffffff7fefc), UINT64_C(0x78787f7f7f777800),
+    UINT64_C(0x30717f7f7f770000), UINT64_C(0x00637f7f7f770000),
+    UINT64_C(0x06477f7f7f770000), UINT64_C(0x0f0f7f7f7f770f00),
+    UINT64_C(0x1f1ffffffff73f1f), UINT64_C(0x3f3ffffffff77f7f),
+    UINT64_C(0xfffffffffff7fcfc), UINT64_C(0xfffffffffff7f8f8),
+    UINT64_C(0xfffffffffff7f1f1), UINT64_C(0xfffffffffff7e3e3),
+    UINT64_C(0xfffffffffff7c7c7), UINT64_C(0xfffffffffff78f8f),
+    UINT64_C(0xfffffffffff71f1f), UINT64_C(0xfffffffffff73f3f),
+    UINT64_C(0x00007e7e7f747c7c), UINT64_C(0x0000003c3e303800),
+    UINT64_C(0x000000001c101000), UINT64_C(0x000000001c000000),
+    UINT64_C(0x000000001c040400), UINT64_C(0x0000001e3e060e00),
+    UINT64_C(0x00003f3f7f171f1f), UINT64_C(0x003f7f7fff373f1f),
+    UINT64_C(0x00007c7e7c747800), UINT64_C(0x0000003c38303800),
+    UINT64_C(0x0000000010100000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000004040000), UINT64_C(0x0000001e0e060e00),
+    UINT64_C(0x00001f3f1f170f00), UINT64_C(0x003f3f7f3f373f1f),
+    UINT64_C(0x00007c7c7c747800), UINT64_C(0x0000003838300000),
+    UINT64_C(0x0000000010000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000004000000), UINT64_C(0x0000000e0e060000),
+    UINT64_C(0x00001f1f1f170f00), UINT64_C(0x003f3f3f3f373f1f),
+    UINT64_C(0x00007c7c7c747800), UINT64_C(0x0000383838300000),
+    UINT64_C(0x0000001010000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000404000000), UINT64_C(0x00000e0e0e060000),
+    UINT64_C(0x00001f1f1f170f00), UINT64_C(0x003f3f3f3f373f1f),
+    UINT64_C(0x007c7c7c7d747800), UINT64_C(0x000038383a300000),
+    UINT64_C(0x0000101014000000), UINT64_C(0x0000000008000000),
+    UINT64_C(0x0000040414000000), UINT64_C(0x00000e0e2e060000),
+    UINT64_C(0x001f1f1f5f170f00), UINT64_C(0x003f3f3fbf373f1f),
+    UINT64_C(0x007c7c7f7c747800), UINT64_C(0x0038383e38300000),
+    UINT64_C(0x0010101c10000000), UINT64_C(0x0000001c00000000),
+    UINT64_C(0x0004041c04000000), UINT64_C(0x000e0e3e0e060000),
+    UINT64_C(0x001f1f7f1f170f00), UINT64_C(0x3f3f3fff3f373f1f),
+    UINT64_C(0x7c7c7f7f7f747800), UINT64_C(0x38383e3e3e300000),
+    UINT64_C(0x10103e3e3e000000), UINT64_C(0x00003e3e3e000000),
+    UINT64_C(0x04043e3e3e000000), UINT64_C(0x0e0e3e3e3e060000),
+    UINT64_C(0x1f1f7f7f7f170f00), UINT64_C(0x3f3fffffff373f1f),
+    UINT64_C(0xfffffffffffffcfc), UINT64_C(0xfffffffffffff8f8),
+    UINT64_C(0xfffffffffffff0f1), UINT64_C(0xffffffffffffe2e3),
+    UINT64_C(0xffffffffffffc6c7), UINT64_C(0xffffffffffff8e8f),
+    UINT64_C(0xffffffffffff1e1f), UINT64_C(0xffffffffffff3e3f),
+    UINT64_C(0x0000000000000000), UINT64_C(0xfffffffffff8f8f8),
+    UINT64_C(0xfffffffffff1f0f1), UINT64_C(0xffffffffffe3e2e3),
+    UINT64_C(0xffffffffffc7c6c7), UINT64_C(0xffffffffff8f8e8f),
+    UINT64_C(0xffffffffff1f1e1f), UINT64_C(0xffffffffff3f3e3f),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x00000f0f01000000), UINT64_C(0x00071f1f03030200),
+    UINT64_C(0x0f0f3f3f07070600), UINT64_C(0x1f1f7f7f0f0f0e00),
+    UINT64_C(0xffffffff1f1f1eff), UINT64_C(0xffffffff3f3f3eff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000020000000000), UINT64_C(0x0007070303030000),
+    UINT64_C(0x0f0f0f0707070000), UINT64_C(0x1f1f1f0f0f0f0000),
+    UINT64_C(0xffffff1f1f1ffeff), UINT64_C(0xffffff3f3f3ffeff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0007030303000000),
+    UINT64_C(0x0f0f070707000000), UINT64_C(0x1f1f0f0f0f000000),
+    UINT64_C(0xffff1f1f1ffffeff), UINT64_C(0xffff3f3f3ffffeff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0003030300000000),
+    UINT64_C(0x0f07070700000000), UINT64_C(0x1f0f0f0f1f000000),
+    UINT64_C(0xff1f1f1ffffffeff), UINT64_C(0xff3f3f3ffffffeff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0303030000000000),
+    UINT64_C(0x0707070f00000000), UINT64_C(0x0f0f0f1f1f000000),
+    UINT64_C(0x1f1f1ffffffffeff), UINT64_C(0x3f3f3ffffffffeff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0303070000000000),
+    UINT64_C(0x07070f0f00000000), UINT64_C(0x0f0f1f1f1f000000),
+    UINT64_C(0x1f1ffffffffffeff), UINT64_C(0x3f3ffffffffffeff),
+    UINT64_C(0x0000000000030000), UINT64_C(0x0000000000030000),
+    UINT64_C(0xfffffffffffff0f1), UINT64_C(0xffffffffffffe2e3),
+    UINT64_C(0xffffffffffffc6c7), UINT64_C(0xffffffffffff8e8f),
+    UINT64_C(0xffffffffffff1e1f), UINT64_C(0xffffffffffff3e3f),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x00000f0f0f000000), UINT64_C(0x00000f0f0f020200),
+    UINT64_C(0x00071f1f1f070600), UINT64_C(0x0f0f3f3f3f0f0e00),
+    UINT64_C(0x1f1f7f7f7f1f1e00), UINT64_C(0xffffffffff3f3e3f),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000600000000), UINT64_C(0x0000020e02020000),
+    UINT64_C(0x0007071f07070000), UINT64_C(0x0f0f0f3f0f0f0000),
+    UINT64_C(0x1f1f1f7f1f1f0000), UINT64_C(0xffffffff3f3f3eff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000020202000000),
+    UINT64_C(0x0007070707000000), UINT64_C(0x0f0f0f0f0f000000),
+    UINT64_C(0x1f1f1f1f1f000000), UINT64_C(0xffffff3f3f3ffeff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000020200000000),
+    UINT64_C(0x0007070700000000), UINT64_C(0x0f0f0f0f00000000),
+    UINT64_C(0x1f1f1f1f1f000000), UINT64_C(0xffff3f3f3ffffeff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000020000000000),
+    UINT64_C(0x0007070000000000), UINT64_C(0x0f0f0f0f00000000),
+    UINT64_C(0x1f1f1f1f1f000000), UINT64_C(0xff3f3f3ffffffeff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0002000000000000),
+    UINT64_C(0x0007070000000000), UINT64_C(0x0f0f0f0f00000000),
+    UINT64_C(0x1f1f1f1f1f000000), UINT64_C(0x3f3f3ffffffffeff),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0202000000000000),
+    UINT64_C(0x0707070000000000), UINT64_C(0x0f0f0f0f00000000),
+    UINT64_C(0x1f1f1f1f1f000000), UINT64_C(0x3f3ffffffffffeff),
+    UINT64_C(0xfffffffffffffcfc), UINT64_C(0xfffffffffffff8f8),
+    UINT64_C(0xfffffffffffff1f1), UINT64_C(0xffffffffffffe1e3),
+    UINT64_C(0xffffffffffffc5c7), UINT64_C(0xffffffffffff8d8f),
+    UINT64_C(0xffffffffffff1d1f), UINT64_C(0xffffffffffff3d3f),
+    UINT64_C(0xfffffffffffcfcfc), UINT64_C(0x0000000000000000),
+    UINT64_C(0xfffffffffff1f1f1), UINT64_C(0xffffffffffe3e1e3),
+    UINT64_C(0xffffffffffc7c5c7), UINT64_C(0xffffffffff8f8d8f),
+    UINT64_C(0xffffffffff1f1d1f), UINT64_C(0xffffffffff3f3d3f),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x00001f1f03030103),
+    UINT64_C(0x000f3f3f0707050f), UINT64_C(0x1f1f7f7f0f0f0d1f),
+    UINT64_C(0x3f3fffff1f1f1d3f), UINT64_C(0xffffffff3f3f3dff),
+    UINT64_C(0x0000000c0c0c0c00), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000101010100), UINT64_C(0x0000070303030503),
+    UINT64_C(0x000f0f0707070d0f), UINT64_C(0x1f1f1f0f0f0f1d1f),
+    UINT64_C(0x3f3f3f1f1f1f3d3f), UINT64_C(0xffffff3f3f3ffdff),
+    UINT64_C(0x00000c0c0c0e0d00), UINT64_C(0x0000000000050500),
+    UINT64_C(0x00000101010b0d00), UINT64_C(0x0000030303171d03),
+    UINT64_C(0x000f0707072f3d0f), UINT64_C(0x1f1f0f0f0f5f7d1f),
+    UINT64_C(0x3f3f1f1f1fbffd3f), UINT64_C(0xffff3f3f3ffffdff),
+    UINT64_C(0x000c0c0c0f0f0c00), UINT64_C(0x000000080f0f0000),
+    UINT64_C(0x000101010f0f0100), UINT64_C(0x000303031f1f0503),
+    UINT64_C(0x000707073f3f0d0f), UINT64_C(0x1f0f0f0f7f7f1d1f),
+    UINT64_C(0x3f1f1f1fffff3d3f), UINT64_C(0xff3f3f3ffffffdff),
+    UINT64_C(0x0c0c1c1f1f1f1d00), UINT64_C(0x0000181f1f1f1d00),
+    UINT64_C(0x0101111f1f1f1d00), UINT64_C(0x0303031f1f1f1d03),
+    UINT64_C(0x0707073f3f3f3d0f), UINT64_C(0x0f0f0f7f7f7f7d1f),
+    UINT64_C(0x1f1f1ffffffffd3f), UINT64_C(0x3f3f3ffffffffdff),
+    UINT64_C(0x0c3c3f3f3f3f3d3f), UINT64_C(0x00383f3f3f3f3d3f),
+    UINT64_C(0x01313f3f3f3f3d3f), UINT64_C(0x03233f3f3f3f3d3f),
+    UINT64_C(0x07073f3f3f3f3d3f), UINT64_C(0x0f0f7f7f7f7f7d7f),
+    UINT64_C(0x1f1ffffffffffdff), UINT64_C(0x3f3ffffffffffdff),
+    UINT64_C(0x0000000000070404), UINT64_C(0x0000000000070000),
+    UINT64_C(0x0000000000070101), UINT64_C(0xffffffffffffe1e3),
+    UINT64_C(0xffffffffffffc5c7), UINT64_C(0xffffffffffff8d8f),
+    UINT64_C(0xffffffffffff1d1f), UINT64_C(0xffffffffffff3d3f),
+    UINT64_C(0x0000000000040400), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000010100), UINT64_C(0x00001f1f1f030103),
+    UINT64_C(0x00001f1f1f070503), UINT64_C(0x000f3f3f3f0f0d0f),
+    UINT64_C(0x1f1f7f7f7f1f1d1f), UINT64_C(0x3f3fffffff3f3d3f),
+    UINT64_C(0x0000000000040000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000010000), UINT64_C(0x0000000f03030100),
+    UINT64_C(0x0000071f07070503), UINT64_C(0x000f0f3f0f0f0d0f),
+    UINT64_C(0x1f1f1f7f1f1f1d1f), UINT64_C(0x3f3f3fff3f3f3d3f),
+    UINT64_C(0x0000000004040000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000001010000), UINT64_C(0x0000000303030100),
+    UINT64_C(0x0000070707070503), UINT64_C(0x000f0f0f0f0f0d0f),
+    UINT64_C(0x1f1f1f1f1f1f1d1f), UINT64_C(0x3f3f3f3f3f3f3d3f),
+    UINT64_C(0x0000000404050000), UINT64_C(0x0000000000020000),
+    UINT64_C(0x0000000101050000), UINT64_C(0x00000003030b0100),
+    UINT64_C(0x0000070707170503), UINT64_C(0x000f0f0f0f2f0d0f),
+    UINT64_C(0x1f1f1f1f1f5f1d1f), UINT64_C(0x3f3f3f3f3fbf3d3f),
+    UINT64_C(0x0000040407040000), UINT64_C(0x0000000007000000),
+    UINT64_C(0x0000010107010000), UINT64_C(0x000003030f030100),
+    UINT64_C(0x000007071f070503), UINT64_C(0x000f0f0f3f0f0d0f),
+    UINT64_C(0x1f1f1f1f7f1f1d1f), UINT64_C(0x3f3f3f3fffbf3d3f),
+    UINT64_C(0x0004040f0f0f0000), UINT64_C(0x0000000f0f0f0000),
+    UINT64_C(0x0001010f0f0f0000), UINT64_C(0x0003030f0f0f0100),
+    UINT64_C(0x0007071f1f1f0503), UINT64_C(0x000f0f3f3f3f0d0f),
+    UINT64_C(0x1f1f1f7f7f7f1d1f), UINT64_C(0x3f3f3fffffff3d3f),
+    UINT64_C(0x04041f1f1f1f1d00), UINT64_C(0x00001f1f1f1f1d00),
+    UINT64_C(0x01011f1f1f1f1d00), UINT64_C(0x03031f1f1f1f1d00),
+    UINT64_C(0x07071f1f1f1f1d03), UINT64_C(0x0f0f3f3f3f3f3d0f),
+    UINT64_C(0x1f1f7f7f7f7f7d1f), UINT64_C(0x3f3ffffffffffd3f),
+    UINT64_C(0xfffffffffffff8fc), UINT64_C(0xfffffffffffff8f8),
+    UINT64_C(0xfffffffffffff1f1), UINT64_C(0xffffffffffffe3e3),
+    UINT64_C(0xffffffffffffc3c7), UINT64_C(0xffffffffffff8b8f),
+    UINT64_C(0xffffffffffff1b1f), UINT64_C(0xffffffffffff3b3f),
+    UINT64_C(0xfffffffffffcf8fc), UINT64_C(0xfffffffffff8f8f8),
+    UINT64_C(0x0000000000000000), UINT64_C(0xffffffffffe3e3e3),
+    UINT64_C(0xffffffffffc7c3c7), UINT64_C(0xffffffffff8f8b8f),
+    UINT64_C(0xffffffffff1f1b1f), UINT64_C(0xffffffffff3f3b3f),
+    UINT64_C(0x00003f3f3c3c383c), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x00003f3f07070307), UINT64_C(0x001f7f7f0f0f0b1f),
+    UINT64_C(0x3f3fffff1f1f1b3f), UINT64_C(0x7f7fffff3f3f3b7f),
+    UINT64_C(0x00003e3c3c3c3a3c), UINT64_C(0x0000001818181800),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000303030300),
+    UINT64_C(0x00000f0707070b07), UINT64_C(0x001f1f0f0f0f1b1f),
+    UINT64_C(0x3f3f3f1f1f1f3b3f), UINT64_C(0x7f7f7f3f3f3f7b7f),
+    UINT64_C(0x00003c3c3c3e3b3c), UINT64_C(0x00001818181d1b00),
+    UINT64_C(0x00000000000a0a00), UINT64_C(0x0000030303171b00),
+    UINT64_C(0x00000707072f3b07), UINT64_C(0x001f0f0f0f5f7b1f),
+    UINT64_C(0x3f3f1f1f1fbffb3f), UINT64_C(0x7f7f3f3f3f7ffb7f),
+    UINT64_C(0x003c3c3c3f3f3a3c), UINT64_C(0x001818181f1f1800),
+    UINT64_C(0x000000111f1f0000), UINT64_C(0x000303031f1f0300),
+    UINT64_C(0x000707073f3f0b07), UINT64_C(0x000f0f0f7f7f1b1f),
+    UINT64_C(0x3f1f1f1fffff3b3f), UINT64_C(0x7f3f3f3fffff7b7f),
+    UINT64_C(0x3c3c3c3f3f3f3b3c), UINT64_C(0x1818383f3f3f3b00),
+    UINT64_C(0x0000313f3f3f3b00), UINT64_C(0x0303233f3f3f3b00),
+    UINT64_C(0x0707073f3f3f3b07), UINT64_C(0x0f0f0f7f7f7f7b1f),
+    UINT64_C(0x1f1f1ffffffffb3f), UINT64_C(0x3f3f3ffffffffb7f),
+    UINT64_C(0x3c7c7f7f7f7f7b7f), UINT64_C(0x18787f7f7f7f7b7f),
+    UINT64_C(0x00717f7f7f7f7b7f), UINT64_C(0x03637f7f7f7f7b7f),
+    UINT64_C(0x07477f7f7f7f7b7f), UINT64_C(0x0f0f7f7f7f7f7b7f),
+    UINT64_C(0x1f1ffffffffffbff), UINT64_C(0x3f3ffffffffffbff),
+    UINT64_C(0xfffffffffffff8fc), UINT64_C(0x00000000000e0808),
+    UINT64_C(0x00000000000e0000), UINT64_C(0x00000000000e0202),
+    UINT64_C(0xffffffffffffc3c7), UINT64_C(0xffffffffffff8b8f),
+    UINT64_C(0xffffffffffff1b1f), UINT64_C(0xffffffffffff3b3f),
+    UINT64_C(0x00003f3f3f3c383c), UINT64_C(0x0000000000080800),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000020200),
+    UINT64_C(0x00003f3f3f070307), UINT64_C(0x00003f3f3f0f0b07),
+    UINT64_C(0x001f7f7f7f1f1b1f), UINT64_C(0x3f3fffffff3f3b3f),
+    UINT64_C(0x0000001f1c1c1800), UINT64_C(0x0000000000080000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000020000),
+    UINT64_C(0x0000001f07070300), UINT64_C(0x00000f3f0f0f0b07),
+    UINT64_C(0x001f1f7f1f1f1b1f), UINT64_C(0x3f3f3fff3f3f3b3f),
+    UINT64_C(0x0000001c1c1c1800), UINT64_C(0x0000000008080000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000002020000),
+    UINT64_C(0x0000000707070300), UINT64_C(0x00000f0f0f0f0b07),
+    UINT64_C(0x001f1f1f1f1f1b1f), UINT64_C(0x3f3f3f3f3f3f3b3f),
+    UINT64_C(0x0000001c1c1d1800), UINT64_C(0x00000008080a0000),
+    UINT64_C(0x0000000000040000), UINT64_C(0x00000002020a0000),
+    UINT64_C(0x0000000707170300), UINT64_C(0x00000f0f0f2f0b07),
+    UINT64_C(0x001f1f1f1f5f1b1f), UINT64_C(0x3f3f3f3f3fbf3b3f),
+    UINT64_C(0x00001c1c1f1c1800), UINT64_C(0x000008080e080000),
+    UINT64_C(0x000000000e000000), UINT64_C(0x000002020e020000),
+    UINT64_C(0x000007071f070300), UINT64_C(0x00000f0f3f0f0b07),
+    UINT64_C(0x001f1f1f7f1f1b1f), UINT64_C(0x3f3f3f3fff3f3b3f),
+    UINT64_C(0x001c1c1f1f1f1800), UINT64_C(0x0008081f1f1f0000),
+    UINT64_C(0x0000001f1f1f0000), UINT64_C(0x0002021f1f1f0000),
+    UINT64_C(0x0007071f1f1f0300), UINT64_C(0x000f0f3f3f3f0b07),
+    UINT64_C(0x001f1f7f7f7f1b1f), UINT64_C(0x3f3f3fffffff3b3f),
+    UINT64_C(0x1c1c3f3f3f3f3b00), UINT64_C(0x08083f3f3f3f3b00),
+    UINT64_C(0x00003f3f3f3f3b00), UINT64_C(0x02023f3f3f3f3b00),
+    UINT64_C(0x07073f3f3f3f3b00), UINT64_C(0x0f0f3f3f3f3f3b07),
+    UINT64_C(0x1f1f7f7f7f7f7b1f), UINT64_C(0x3f3ffffffffffb3f),
+    UINT64_C(0xfffffffffffff4fc), UINT64_C(0xfffffffffffff0f8),
+    UINT64_C(0xfffffffffffff1f1), UINT64_C(0xffffffffffffe3e3),
+    UINT64_C(0xffffffffffffc7c7), UINT64_C(0xffffffffffff878f),
+    UINT64_C(0xffffffffffff171f), UINT64_C(0xffffffffffff373f),
+    UINT64_C(0xfffffffffffcf4fc), UINT64_C(0xfffffffffff8f0f8),
+    UINT64_C(0xfffffffffff1f1f1), UINT64_C(0x0000000000000000),
+    UINT64_C(0xffffffffffc7c7c7), UINT64_C(0xffffffffff8f878f),
+    UINT64_C(0xffffffffff1f171f), UINT64_C(0xffffffffff3f373f),
+    UINT64_C(0x00fefffffcfcf4fe), UINT64_C(0x00007f7f78787078),
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000000000), UINT64_C(0x00007f7f0f0f070f),
+    UINT64_C(0x003fffff1f1f173f), UINT64_C(0x7f7fffff3f3f377f),
+    UINT64_C(0x00fefefcfcfcf6fe), UINT64_C(0x00007c7878787478),
+    UINT64_C(0x0000003030303000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000606060600), UINT64_C(0x00001f0f0f0f170f),
+    UINT64_C(0x003f3f1f1f1f373f), UINT64_C(0x7f7f7f3f3f3f777f),
+    UINT64_C(0x00fefcfcfcfef7fe), UINT64_C(0x00007878787d7778),
+    UINT64_C(0x00003030303a3600), UINT64_C(0x0000000000141400),
+    UINT64_C(0x00000606062e3600), UINT64_C(0x00000f0f0f5f770f),
+    UINT64_C(0x003f1f1f1fbff73f), UINT64_C(0x7f7f3f3f3f7ff77f),
+    UINT64_C(0x00fcfcfcfffff6fe), UINT64_C(0x007878787f7f7478),
+    UINT64_C(0x003030303e3e3000), UINT64_C(0x000000223e3e0000),
+    UINT64_C(0x000606063e3e0600), UINT64_C(0x000f0f0f7f7f170f),
+    UINT64_C(0x001f1f1fffff373f), UINT64_C(0x7f3f3f3fffff777f),
+    UINT64_C(0xfcfcfcfffffff7fe), UINT64_C(0x7878787f7f7f7778),
+    UINT64_C(0x3030717f7f7f7700), UINT64_C(0x0000637f7f7f7700),
+    UINT64_C(0x0606477f7f7f7700), UINT64_C(0x0f0f0f7f7f7f770f),
+    UINT64_C(0x1f1f1ffffffff73f), UINT64_C(0x3f3f3ffffffff77f),
+    UINT64_C(0xfcfcfffffffff7ff), UINT64_C(0x78f8fffffffff7ff),
+    UINT64_C(0x30f1fffffffff7ff), UINT64_C(0x00e3fffffffff7ff),
+    UINT64_C(0x06c7fffffffff7ff), UINT64_C(0x0f8ffffffffff7ff),
+    UINT64_C(0x1f1ffffffffff7ff), UINT64_C(0x3f3ffffffffff7ff),
+    UINT64_C(0xfffffffffffff4fc), UINT64_C(0xfffffffffffff0f8),
+    UINT64_C(0x00000000001c1010), UINT64_C(0x00000000001c0000),
+    UINT64_C(0x00000000001c0404), UINT64_C(0xffffffffffff878f),
+    UINT64_C(0xffffffffffff171f), UINT64_C(0xffffffffffff373f),
+    UINT64_C(0x00007f7f7f7c7478), UINT64_C(0x00007f7f7f787078),
+    UINT64_C(0x0000000000101000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000040400), UINT64_C(0x00007f7f7f0f070f),
+    UINT64_C(0x00007f7f7f1f170f), UINT64_C(0x003fffffff3f373f),
+    UINT64_C(0x00007c7f7c7c7478), UINT64_C(0x0000003e38383000),
+    UINT64_C(0x0000000000100000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000000040000), UINT64_C(0x0000003e0e0e0600),
+    UINT64_C(0x00001f7f1f1f170f), UINT64_C(0x003f3fff3f3f373f),
+    UINT64_C(0x00007c7c7c7c7478), UINT64_C(0x0000003838383000),
+    UINT64_C(0x0000000010100000), UINT64_C(0x0000000000000000),
+    UINT64_C(0x0000000004040000), UINT64_C(0x0000000e0e0e0600),
+    UINT64_C(0x00001f1f1f1f170f), UINT64_C(0x003f3f3f3f3f373f),
+    UINT64_C(0x00007c7c7c7d7478), UINT64_C(0x00000038383a3000),
+    UINT64_C(0x0000001010140000), UINT64_C(0x0000000000080000),
+    UINT64_C(0x0000000404140000), UINT64_C(0x0000000e0e2e0600),
+    UINT64_C(0x00001f1f1f5f170f), UINT64_C(0x003f3f3f3fbf373f),
+    UINT64_C(0x00007c7c7f7c7478), UINT64_C(0x000038383e383000),
+    UINT64_C(0x000010101c100000), UINT64_C(0x000000001c000000),
+    UINT64_C(0x000004041c040000), UINT64_C(0x00000e0e3e0e0600),
+    UINT64_C(0x00001f1f7f1f170f), UINT64_C(0x003f3f3fff3f373f),
+    UINT64_C(0x007c7c7f7f7f7478), UINT64_C(0x0038383e3e3e3000),
+    UINT64_C(0x0010103e3e3e0000), UINT64_C(0x0000003e3e3e0000),
+    UINT64_C(0x0004043e3e3e0000), UINT64_C(0x000e0e3e3e3e0600),
+    UINT64_C(0x001f1f7f7f7f170f), UINT64_C(0x003f3fffffff373f),
+    UINT64_C(0x7c7c7f7f7f7f7778), UINT64_C(0x38387f7f7f7f7700),
+    UINT64_C(0x10107f7f7f7f7700), UINT64_C(0x00007f7f7f7f7700),
+    UINT64_C(0x04047f7f7f7f7700), UINT64_C(0x0e0e7f7f7f7f7700),
+    UINT64_C(0x1f1f7f7f7f7f770f), UINT64_C(0x3f3ffffffffff73f),
+};
+
+
+} // namespace DZChess
+
+#endif // DZCHESS_KPK_BITBASE_DATA_HPP_INCLUDED
@@ -0,0 +1,54 @@
+#include <cstddef>  // for std::size_t
+#include <bit>      // for std::popcount
+#include <cstdint>  // for std::uint64_t
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+
+#include "KPKBitbase.hpp"
+
+
+using namespace DZChess;
+
+
+// Writes KPKBitbaseData.hpp to standard output:
+//     KPKBitbaseGenerator > KPKBitbaseData.hpp
+// With --check, compares the generated bitbase to the embedded one instead.
+
+
+int main(int argc, char **argv) {
+
+    const auto bitbase = detail::make_kpk_bitbase();
+
+    if ((argc > 1) && (std::string_view{argv[1]} == "--check")) {
+        if (bitbase == KPK_BITBASE) {
+            std::cerr << "KPKBitbaseData.hpp is up to date." << std::endl;
+            return 0;
+        }
+        std::cerr << "ERROR: KPKBitbaseData.hpp is out of date." << std::endl;
+        return 1;
+    }
+
+    std::size_t wins = 0;
+    for (const std::uint64_t word : bitbase) { wins += std::popcount(word); }
+    std::cout << "#ifndef DZCHESS_KPK_BITBASE_DATA_HPP_INCLUDED\n"
+              << "#define DZCHESS_KPK_BITBASE_DATA_HPP_INCLUDED\n\n"
+              << "#include <array>   // for std::array\n"
+              << "#include <cstdint> // for std::uint64_t, UINT64_C\n\n"
+              << "namespace DZChess {\n\n\n"
+              << "// Generated by KPKBitbaseGenerator.cpp; do not edit. One bit"
+              << " per position\n// (see detail::kpk_index), set for the "
+              << wins << " won positions.\n"
+              << "constexpr std::array<std::uint64_t, " << bitbase.size()
+              << "> KPK_BITBASE = {\n";
+    std::cout << std::hex << std::setfill('0');
+    for (std::size_t i = 0; i < bitbase.size(); i += 2) {
+        std::cout << "    UINT64_C(0x" << std::setw(16) << bitbase[i]
+                  << "), UINT64_C(0x" << std::setw(16) << bitbase[i + 1]
+                  << "),\n";
+    }
+    std::cout << "};\n\n\n"
+              << "} // namespace DZChess\n\n"
+              << "#endif // DZCHESS_KPK_BITBASE_DATA_HPP_INCLUDED\n";
+
+}
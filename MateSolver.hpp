@@ -0,0 +1,329 @@
+#ifndef DZCHESS_MATE_SOLVER_HPP_INCLUDED
+#define DZCHESS_MATE_SOLVER_HPP_INCLUDED
+
+#include <algorithm> // for std::min
+#include <array>     // for std::array
+#include <bit>       // for std::bit_floor
+#include <cstddef>   // for std::size_t
+#include <cstdint>   // for std::uint32_t, std::uint64_t, UINT64_C
+#include <vector>    // for std::vector
+
+#include "ChessPiece.hpp"
+#include "ChessBoard.hpp"
+#include "MoveList.hpp"
+#include "Search.hpp"
+
+namespace DZChess {
+
+
+struct MateResult {
+    bool found;   // a forced mate was proven
+    bool aborted; // the node limit was reached before an answer
+    int moves;    // length of the shortest mate, in moves of the attacker
+    std::vector<ChessMove> principal_variation;
+    std::uint64_t nodes;
+};
+
+
+// Depth-first proof-number search (df-pn) for forced mates. Every node is
+// either an OR node, where the attacker needs one move that mates, or an
+// AND node, where every defence must be mated. Each node carries a proof
+// number and a disproof number, the minimum number of leaves that must be
+// resolved to prove or disprove it, and the search always expands the most
+// proving node. Unlike alpha-beta, effort goes to lines with few defences,
+// which is where forced mates are found.
+//
+// Numbers are kept in negamax form: phi is the proof number of the side to
+// move (the attacker's proof number at OR nodes, the disproof number at
+// AND nodes) and delta the other one, so a node whose side to move has lost
+// has phi = INFINITE and delta = 0. Nodes are bounded by the remaining
+// plies, which are part of the table key, so cycles cannot occur.
+//
+// Results are cached in a fixed-size table of four-entry buckets. When a
+// bucket is full, the entry whose subtree took the least work is replaced,
+// so proofs of large subtrees survive longest.
+class MateSolver {
+
+    static constexpr std::uint32_t INFINITE = 0x7FFF'FFFF;
+
+    struct Numbers {
+        std::uint32_t phi;
+        std::uint32_t delta;
+    };
+
+    struct Entry {
+        std::uint64_t key;
+        Numbers numbers;
+        std::uint64_t work;
+    };
+
+    static constexpr std::size_t BUCKET_SIZE = 4;
+
+    std::vector<Entry> table;
+    std::size_t bucket_mask;
+    std::size_t used;
+    PieceColor attacker;
+    std::uint64_t node_count;
+    std::uint64_t node_limit;
+    bool aborted;
+
+    static std::size_t buckets_for(std::size_t megabytes) noexcept {
+        const std::size_t buckets =
+            (megabytes << 20) / (sizeof(Entry) * BUCKET_SIZE);
+        return std::bit_floor(buckets > 0 ? buckets : std::size_t{1});
+    }
+
+    // Saturating addition: finite sums never reach INFINITE, which would
+    // mark a node as resolved.
+    static constexpr std::uint32_t add(std::uint32_t a,
+                                       std::uint32_t b) noexcept {
+        if ((a >= INFINITE) || (b >= INFINITE)) { return INFINITE; }
+        return static_cast<std::uint32_t>(std::min<std::uint64_t>(
+            std::uint64_t{a} + b, INFINITE - 1));
+    }
+
+    static constexpr std::uint64_t node_key(std::uint64_t position,
+                                            int remaining) noexcept {
+        return position ^ (static_cast<std::uint64_t>(remaining + 1) *
+                           UINT64_C(0x9E3779B97F4A7C15));
+    }
+
+    const Entry *find(std::uint64_t key) const noexcept {
+        const Entry *bucket = &table[(key & bucket_mask) * BUCKET_SIZE];
+        for (std::size_t i = 0; i < BUCKET_SIZE; ++i) {
+            if (bucket[i].key == key) { return &bucket[i]; }
+        }
+        return nullptr;
+    }
+
+    void store(std::uint64_t key, Numbers numbers,
+               std::uint64_t work) noexcept {
+        Entry *bucket = &table[(key & bucket_mask) * BUCKET_SIZE];
+        Entry *victim = &bucket[0];
+        for (std::size_t i = 0; i < BUCKET_SIZE; ++i) {
+            if (bucket[i].key == key) {
+                victim = &bucket[i];
+                break;
+            }
+            if (bucket[i].key == 0) {
+                if (victim->key != 0) { victim = &bucket[i]; }
+            } else if ((victim->key != 0) &&
+                       (bucket[i].work < victim->work)) {
+                victim = &bucket[i];
+            }
+        }
+        used += (victim->key == 0);
+        *victim = {key, numbers, work};
+    }
+
+    // Generates the legal moves of the side to move and reports whether
+    // the node is resolved without search, and if so, how.
+    template <PieceColor COLOR>
+    bool is_terminal(const ChessBoard &board, int remaining, MoveList &moves,
+                     Numbers &numbers) const noexcept {
+        constexpr Numbers LOST = {INFINITE, 0};
+        constexpr Numbers WON = {0, INFINITE};
+        const bool attacking = (COLOR == attacker);
+        generate_legal_moves<COLOR>(board, moves);
+        if (moves.empty()) {
+            // Stalemate saves the defender and fails the attacker.
+            numbers = (board.in_check<COLOR>() || attacking) ? LOST : WON;
+            return true;
+        }
+        if (remaining <= 0) {
+            numbers = attacking ? LOST : WON;
+            return true;
+        }
+        return false;
+    }
+
+    // Numbers of a node that has not been searched yet. Nodes with many
+    // moves are harder to resolve for the other side, which has to answer
+    // every one of them (df-pn+ mobility initialization).
+    template <PieceColor COLOR>
+    Numbers initial_numbers(const ChessBoard &board,
+                            int remaining) const noexcept {
+        MoveList moves{};
+        Numbers numbers{};
+        if (is_terminal<COLOR>(board, remaining, moves, numbers)) {
+            return numbers;
+        }
+        return {1, static_cast<std::uint32_t>(moves.size())};
+    }
+
+    template <PieceColor COLOR>
+    Numbers child_numbers(const ChessBoard &child, std::uint64_t key,
+                          int remaining) noexcept {
+        if (const Entry *entry = find(key)) { return entry->numbers; }
+        const Numbers numbers = initial_numbers<COLOR>(child, remaining);
+        store(key, numbers, 0);
+        return numbers;
+    }
+
+    // Multiple iterative deepening: searches below the node until its
+    // numbers reach one of the thresholds, then returns them.
+    template <PieceColor COLOR>
+    Numbers search(const ChessBoard &board, std::uint64_t key, int remaining,
+                   std::uint32_t phi_threshold,
+                   std::uint32_t delta_threshold) noexcept {
+        ++node_count;
+        const std::uint64_t start = node_count;
+        MoveList moves{};
+        Numbers numbers{};
+        if (is_terminal<COLOR>(board, remaining, moves, numbers)) {
+            store(key, numbers, 1);
+            return numbers;
+        }
+
+        std::array<std::uint64_t, MAX_MOVES> keys;
+        std::array<Numbers, MAX_MOVES> children;
+        for (std::size_t i = 0; i < moves.size(); ++i) {
+            const ChessBoard child = board.after_move<COLOR>(moves[i]);
+            keys[i] = node_key(position_key<other(COLOR)>(child),
+                               remaining - 1);
+            children[i] = child_numbers<other(COLOR)>(
+                child, keys[i], remaining - 1);
+        }
+
+        while (true) {
+            std::uint32_t phi = INFINITE;
+            std::uint32_t delta = 0;
+            std::uint32_t second_delta = INFINITE;
+            std::size_t best = 0;
+            for (std::size_t i = 0; i < moves.size(); ++i) {
+                delta = add(delta, children[i].phi);
+                if (children[i].delta < phi) {
+                    second_delta = phi;
+                    phi = children[i].delta;
+                    best = i;
+                } else if (children[i].delta < second_delta) {
+                    second_delta = children[i].delta;
+                }
+            }
+            numbers = {phi, delta};
+            if ((phi >= phi_threshold) || (delta >= delta_threshold) ||
+                aborted) {
+                break;
+            }
+            if ((node_limit != 0) && (node_count >= node_limit)) {
+                aborted = true;
+                break;
+            }
+            // The child may use the slack left by the other children's
+            // contribution to delta, and must stop once it is no longer
+            // the most proving child.
+            const std::uint64_t slack = std::uint64_t{delta_threshold} -
+                                        delta + children[best].phi;
+            const std::uint32_t child_phi = static_cast<std::uint32_t>(
+                std::min<std::uint64_t>(slack, INFINITE));
+            const std::uint32_t child_delta =
+                std::min(phi_threshold, add(second_delta, 1));
+            children[best] = search<other(COLOR)>(
+                board.after_move<COLOR>(moves[best]), keys[best],
+                remaining - 1, child_phi, child_delta);
+        }
+        if (!aborted) { store(key, numbers, node_count - start + 1); }
+        return numbers;
+    }
+
+    // Follows a proof from the root. The attacker plays a proven move; the
+    // defender plays the reply whose proof took the most work, as a proxy
+    // for the most stubborn defence. Proofs lost to replacement are redone.
+    template <PieceColor COLOR>
+    void extract_variation(const ChessBoard &board, int remaining,
+                           std::vector<ChessMove> &variation) noexcept {
+        MoveList moves{};
+        Numbers numbers{};
+        if (is_terminal<COLOR>(board, remaining, moves, numbers)) { return; }
+        const bool attacking = (COLOR == attacker);
+        std::size_t chosen = moves.size();
+        std::uint64_t most_work = 0;
+        for (std::size_t i = 0; i < moves.size(); ++i) {
+            const ChessBoard child = board.after_move<COLOR>(moves[i]);
+            const std::uint64_t key = node_key(
+                position_key<other(COLOR)>(child), remaining - 1);
+            const Entry *entry = find(key);
+            Numbers result = (entry != nullptr) ? entry->numbers : Numbers{};
+            if (entry == nullptr) {
+                result = search<other(COLOR)>(child, key, remaining - 1,
+                                              INFINITE, INFINITE);
+                entry = find(key);
+            }
+            // The attacker needs a child lost for its side to move, and
+            // every child of a defender node is won for its side to move.
+            const bool proven = attacking ? (result.phi == INFINITE)
+                                          : (result.phi == 0);
+            if (!proven) { continue; }
+            const std::uint64_t work = (entry != nullptr) ? entry->work : 0;
+            if ((chosen == moves.size()) || (!attacking && work > most_work)) {
+                chosen = i;
+                most_work = work;
+                if (attacking) { break; }
+            }
+        }
+        if (chosen == moves.size()) { return; }
+        variation.push_back(moves[chosen]);
+        extract_variation<other(COLOR)>(
+            board.after_move<COLOR>(moves[chosen]), remaining - 1, variation);
+    }
+
+public:
+
+    explicit MateSolver(std::size_t megabytes = 64) :
+        table(buckets_for(megabytes) * BUCKET_SIZE),
+        bucket_mask(buckets_for(megabytes) - 1), used(0),
+        attacker(PieceColor::WHITE), node_count(0), node_limit(0),
+        aborted(false) {}
+
+    void clear() noexcept {
+        for (Entry &entry : table) { entry = {}; }
+        used = 0;
+    }
+
+    std::size_t capacity() const noexcept { return table.size(); }
+
+    std::size_t entries_used() const noexcept { return used; }
+
+    std::size_t memory_bytes() const noexcept {
+        return table.size() * sizeof(Entry);
+    }
+
+    // Looks for a forced mate by COLOR, the side to move, in at most
+    // max_moves of its moves, trying each length in turn so that the
+    // shortest mate is reported. A node limit of 0 means no limit.
+    template <PieceColor COLOR>
+    MateResult solve(const ChessBoard &board, int max_moves,
+                     std::uint64_t nodes = 0) {
+        attacker = COLOR;
+        node_count = 0;
+        node_limit = nodes;
+        aborted = false;
+        MateResult result{false, false, 0, {}, 0};
+        for (int moves = 1; moves <= max_moves; ++moves) {
+            const int plies = 2 * moves - 1;
+            const std::uint64_t key =
+                node_key(position_key<COLOR>(board), plies);
+            const Numbers numbers = search<COLOR>(board, key, plies,
+                                                  INFINITE, INFINITE);
+            if (aborted) {
+                result.aborted = true;
+                break;
+            }
+            if (numbers.phi == 0) {
+                result.found = true;
+                result.moves = moves;
+                extract_variation<COLOR>(board, plies,
+                                         result.principal_variation);
+                break;
+            }
+        }
+        result.nodes = node_count;
+        return result;
+    }
+
+}; // class MateSolver
+
+
+} // namespace DZChess
+
+#endif // DZCHESS_MATE_SOLVER_HPP_INCLUDED
@@ -0,0 +1,115 @@
+#ifndef DZCHESS_MOBILITY_HPP_INCLUDED
+#define DZCHESS_MOBILITY_HPP_INCLUDED
+
+#include <array>   // for std::array
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::uint64_t, std::int32_t
+
+#include "ChessPiece.hpp"
+#include "BitBoard.hpp"
+#include "ChessBoard.hpp"
+#include "AttackInfo.hpp"
+
+namespace DZChess {
+
+
+// Bonus per safe destination square, indexed by PieceType. Kings and pawns
+// are not scored for mobility.
+constexpr std::array<int, 6> MOBILITY_MIDGAME = {0, 1, 2, 4, 4, 0};
+constexpr std::array<int, 6> MOBILITY_ENDGAME = {0, 2, 4, 4, 4, 0};
+
+// Weight of each attack on a square next to the enemy king, indexed by
+// PieceType. King safety only matters in the middlegame.
+constexpr std::array<int, 6> KING_ZONE_ATTACK_WEIGHT = {0, 5, 3, 2, 2, 0};
+
+// Bonus for the attacking side, indexed by total attack weight and clamped
+// to the last entry. It grows faster than linearly, since one attacker is
+// rarely dangerous but several coordinated ones are.
+constexpr std::array<int, 16> KING_ZONE_BONUS = {
+    0, 0, 1, 3, 6, 10, 15, 21, 28, 36, 45, 55, 66, 78, 91, 105
+};
+
+
+struct MobilityEvaluation {
+    std::int32_t midgame;
+    std::int32_t endgame;
+};
+
+
+template <PieceColor COLOR>
+constexpr BitBoard king_zone(const ChessBoard &board) noexcept {
+    const BitBoard king = board.get_piece<COLOR, PieceType::KING>();
+    if (king.is_empty()) { return BitBoard{0}; }
+    const std::uint64_t square = *king.begin();
+    return king | king.king_moves(square, BitBoard{0});
+}
+
+
+template <PieceColor COLOR, PieceType TYPE>
+void evaluate_piece_mobility(
+    const ChessBoard &board, const AttackInfo &info, BitBoard targets,
+    BitBoard zone, MobilityEvaluation &result, int &attack_weight
+) noexcept {
+    constexpr auto t = static_cast<std::size_t>(TYPE);
+    for (const std::uint64_t src : board.get_piece<COLOR, TYPE>()) {
+        const BitBoard destinations = info.attacks_from[src] & targets;
+        const int mobility = destinations.popcount();
+        result.midgame += MOBILITY_MIDGAME[t] * mobility;
+        result.endgame += MOBILITY_ENDGAME[t] * mobility;
+        attack_weight +=
+            KING_ZONE_ATTACK_WEIGHT[t] * (destinations & zone).popcount();
+    }
+    // Without the attack map, each piece would need its own lookups.
+    if constexpr (TYPE == PieceType::QUEEN) {
+        attack_statistics().lookups_saved +=
+            2 * board.piece_count<COLOR, TYPE>();
+    } else if constexpr ((TYPE == PieceType::ROOK) ||
+                         (TYPE == PieceType::BISHOP)) {
+        attack_statistics().lookups_saved += board.piece_count<COLOR, TYPE>();
+    }
+}
+
+
+// Evaluates the mobility of one color's pieces and their pressure on the
+// enemy king from that color's point of view. Mobility counts destination
+// squares that are neither occupied by friendly pieces nor attacked by
+// enemy pawns; a piece that can only move to squares covered by pawns is
+// not really mobile. Only attack sets are counted; no moves are generated.
+template <PieceColor COLOR>
+MobilityEvaluation evaluate_mobility_for(const ChessBoard &board,
+                                         const AttackInfo &info) noexcept {
+    constexpr PieceColor OTHER = other(COLOR);
+    const BitBoard targets = ~board.get_pieces<COLOR>() &
+                             ~info.attacks_of<OTHER, PieceType::PAWN>();
+    const BitBoard zone = king_zone<OTHER>(board);
+    MobilityEvaluation result{0, 0};
+    int attack_weight = 0;
+    evaluate_piece_mobility<COLOR, PieceType::QUEEN >(
+        board, info, targets, zone, result, attack_weight);
+    evaluate_piece_mobility<COLOR, PieceType::ROOK  >(
+        board, info, targets, zone, result, attack_weight);
+    evaluate_piece_mobility<COLOR, PieceType::BISHOP>(
+        board, info, targets, zone, result, attack_weight);
+    evaluate_piece_mobility<COLOR, PieceType::KNIGHT>(
+        board, info, targets, zone, result, attack_weight);
+    const std::size_t index = (attack_weight < 16)
+        ? static_cast<std::size_t>(attack_weight) : 15;
+    result.midgame += KING_ZONE_BONUS[index];
+    return result;
+}
+
+
+// Mobility and king-zone evaluation from white's point of view.
+inline MobilityEvaluation evaluate_mobility(const ChessBoard &board,
+                                            const AttackInfo &info) noexcept {
+    const MobilityEvaluation w =
+        evaluate_mobility_for<PieceColor::WHITE>(board, info);
+    const MobilityEvaluation b =
+        evaluate_mobility_for<PieceColor::BLACK>(board, info);
+    return {w.midgame - b.midgame, w.endgame - b.endgame};
+}
+
+
+} // namespace DZChess
+
+#endif // DZCHESS_MOBILITY_HPP_INCLUDED
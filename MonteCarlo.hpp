@@ -0,0 +1,382 @@
+#ifndef DZCHESS_MONTE_CARLO_HPP_INCLUDED
+#define DZCHESS_MONTE_CARLO_HPP_INCLUDED
+
+#include <algorithm> // for std::clamp, std::max
+#include <atomic>    // for std::atomic
+#include <chrono>    // for std::chrono::steady_clock
+#include <cmath>     // for std::sqrt, std::tanh, std::atanh, std::llround
+#include <cstddef>   // for std::size_t
+#include <cstdint>   // for std::uint8_t, std::uint32_t, std::int64_t
+#include <memory>    // for std::unique_ptr
+#include <random>    // for std::mt19937_64
+#include <vector>    // for std::vector
+
+#include "ChessPiece.hpp"
+#include "ChessBoard.hpp"
+#include "MoveList.hpp"
+#include "AttackInfo.hpp"
+#include "Search.hpp"
+#include "ThreadPool.hpp"
+
+namespace DZChess {
+
+
+struct MonteCarloOptions {
+    double exploration = 1.5; // PUCT constant
+    int rollout_plies = 0;    // random moves before evaluating a leaf
+    int virtual_loss = 3;     // losses charged to a node being visited
+};
+
+
+struct MonteCarloLimits {
+    std::uint64_t iterations = 0; // 0 for no limit
+    std::chrono::steady_clock::time_point deadline =
+        std::chrono::steady_clock::time_point::max();
+    const std::atomic<bool> *stop = nullptr; // set by another thread
+};
+
+
+struct MonteCarloStatistics {
+    std::uint64_t iterations = 0;
+    std::uint64_t tree_nodes = 0;
+    std::uint64_t tree_bytes = 0;
+    bool tree_full = false; // some leaves could not be expanded
+};
+
+
+// Monte Carlo tree search with PUCT selection over the legal move
+// generator. Each iteration descends the tree by maximizing
+//
+//     Q(child) + exploration * P(child) * sqrt(N(node)) / (1 + N(child)),
+//
+// expands the leaf it reaches, scores it with Visitor<COLOR, 0>::visit
+// (after an optional random rollout), squashed into [-1, 1], and adds the
+// result to every node on the path. Priors favour captures of valuable
+// pieces and promotions over quiet moves.
+//
+// Threads share one tree (tree parallelism). Visit counts and value sums
+// are atomic, and a thread descending through a node charges it a virtual
+// loss, which steers the other threads to different lines until the real
+// result replaces it. A leaf is expanded by the first thread to claim it;
+// the others evaluate it without expanding.
+//
+// Nodes come from an arena of fixed capacity that is filled front to back
+// and initialized on allocation, so clearing the tree between moves only
+// resets the allocation index. When the arena is full, leaves are still
+// evaluated but no longer expanded.
+template <template <PieceColor, int> typename Visitor>
+class MonteCarloSearcher {
+
+    // Values are accumulated in fixed point, with VALUE_ONE for a win.
+    static constexpr std::int64_t VALUE_ONE = 1 << 16;
+
+    // Centipawns at which a leaf evaluation counts as three-quarters of a
+    // win (tanh(1) = 0.76).
+    static constexpr double EVALUATION_SCALE = 400.0;
+
+    static constexpr std::uint32_t NO_CHILDREN = 0xFFFF'FFFF;
+
+    enum class NodeState : std::uint8_t {
+        UNEXPANDED, EXPANDING, EXPANDED, TERMINAL
+    };
+
+    // The value sum is from the point of view of the side that played the
+    // move leading to the node, so parents maximize their children's Q.
+    struct Node {
+        std::atomic<std::int64_t> value;
+        std::atomic<std::uint32_t> visits;
+        std::atomic<NodeState> state;
+        std::int8_t terminal_value; // for the side to move: -1, 0
+        std::uint8_t src;
+        std::uint8_t dst;
+        PieceType src_type;
+        PieceType dst_type;
+        std::uint16_t child_count;
+        std::uint32_t first_child;
+        float prior;
+
+        ChessMove move() const noexcept {
+            return {src, dst, src_type, dst_type};
+        }
+    };
+
+    std::unique_ptr<Node[]> nodes;
+    std::size_t capacity;
+    std::atomic<std::size_t> used;
+    std::atomic<bool> full;
+    std::atomic<std::uint64_t> iterations;
+
+    void initialize(Node &node, const ChessMove &move, float prior) noexcept {
+        node.value.store(0, std::memory_order_relaxed);
+        node.visits.store(0, std::memory_order_relaxed);
+        node.state.store(NodeState::UNEXPANDED, std::memory_order_relaxed);
+        node.terminal_value = 0;
+        node.src = static_cast<std::uint8_t>(move.src);
+        node.dst = static_cast<std::uint8_t>(move.dst);
+        node.src_type = move.src_type;
+        node.dst_type = move.dst_type;
+        node.child_count = 0;
+        node.first_child = NO_CHILDREN;
+        node.prior = prior;
+    }
+
+    // Reserves count consecutive nodes, or returns NO_CHILDREN if the
+    // arena cannot hold them.
+    std::uint32_t allocate(std::size_t count) noexcept {
+        const std::size_t first = used.fetch_add(count);
+        if (first + count > capacity) {
+            full.store(true, std::memory_order_relaxed);
+            return NO_CHILDREN;
+        }
+        return static_cast<std::uint32_t>(first);
+    }
+
+    template <PieceColor COLOR>
+    static float move_weight(const ChessBoard &board,
+                             const ChessMove &move) noexcept {
+        float weight = 1.0f;
+        if (board.is_occupied(move.dst)) {
+            const PieceType victim =
+                board.piece_type_at<other(COLOR)>(move.dst);
+            weight += static_cast<float>(
+                ORDERING_VALUE[static_cast<std::size_t>(victim)]) / 100.0f;
+        }
+        if (move.src_type != move.dst_type) {
+            weight += static_cast<float>(
+                ORDERING_VALUE[static_cast<std::size_t>(move.dst_type)])
+                / 100.0f;
+        }
+        return weight;
+    }
+
+    // Scores a position for the side to move, in [-1, 1].
+    template <PieceColor COLOR>
+    static double evaluate(const ChessBoard &board) noexcept {
+        int score = 0;
+        if constexpr (requires(const AttackInfo &info) {
+                          Visitor<COLOR, 0>::visit(board, info);
+                      }) {
+            score = Visitor<COLOR, 0>::visit(board, AttackInfo{board});
+        } else {
+            score = Visitor<COLOR, 0>::visit(board);
+        }
+        if constexpr (COLOR == PieceColor::BLACK) { score = -score; }
+        return std::tanh(static_cast<double>(score) / EVALUATION_SCALE);
+    }
+
+    // Plays up to plies random legal moves from the position and scores
+    // the result for the side to move at the start.
+    template <PieceColor COLOR>
+    double rollout(const ChessBoard &board, int plies,
+                   std::mt19937_64 &rng) const noexcept {
+        if (plies <= 0) { return evaluate<COLOR>(board); }
+        MoveList moves{};
+        generate_legal_moves<COLOR>(board, moves);
+        if (moves.empty()) {
+            return board.in_check<COLOR>() ? -1.0 : 0.0;
+        }
+        const ChessMove &move = moves[rng() % moves.size()];
+        return -rollout<other(COLOR)>(
+            board.after_move<COLOR>(move), plies - 1, rng);
+    }
+
+    template <PieceColor COLOR>
+    double evaluate_leaf(const ChessBoard &board,
+                         std::mt19937_64 &rng) const noexcept {
+        return rollout<COLOR>(board, options.rollout_plies, rng);
+    }
+
+    // Generates the children of a node claimed by this thread and
+    // publishes them. Returns false if the arena is full, leaving the node
+    // unexpanded.
+    template <PieceColor COLOR>
+    bool expand(Node &node, const ChessBoard &board) noexcept {
+        MoveList moves{};
+        generate_legal_moves<COLOR>(board, moves);
+        if (moves.empty()) {
+            node.terminal_value = board.in_check<COLOR>() ? -1 : 0;
+            node.state.store(NodeState::TERMINAL, std::memory_order_release);
+            return true;
+        }
+        const std::uint32_t first = allocate(moves.size());
+        if (first == NO_CHILDREN) {
+            node.state.store(NodeState::UNEXPANDED,
+                             std::memory_order_release);
+            return false;
+        }
+        float total = 0.0f;
+        for (const ChessMove &move : moves) {
+            total += move_weight<COLOR>(board, move);
+        }
+        for (std::size_t i = 0; i < moves.size(); ++i) {
+            initialize(nodes[first + i], moves[i],
+                       move_weight<COLOR>(board, moves[i]) / total);
+        }
+        node.first_child = first;
+        node.child_count = static_cast<std::uint16_t>(moves.size());
+        node.state.store(NodeState::EXPANDED, std::memory_order_release);
+        return true;
+    }
+
+    Node &select(const Node &node) const noexcept {
+        const double parent_visits = static_cast<double>(
+            node.visits.load(std::memory_order_relaxed));
+        const double exploration =
+            options.exploration * std::sqrt(std::max(parent_visits, 1.0));
+        Node *best = &nodes[node.first_child];
+        double best_score = -1.0e300;
+        for (std::uint32_t i = 0; i < node.child_count; ++i) {
+            Node &child = nodes[node.first_child + i];
+            const std::uint32_t visits =
+                child.visits.load(std::memory_order_relaxed);
+            const double q = (visits == 0) ? 0.0
+                : static_cast<double>(
+                      child.value.load(std::memory_order_relaxed))
+                  / static_cast<double>(VALUE_ONE * visits);
+            const double score = q + exploration * child.prior /
+                                         (1.0 + static_cast<double>(visits));
+            if (score > best_score) {
+                best_score = score;
+                best = &child;
+            }
+        }
+        return *best;
+    }
+
+    // Runs one iteration below node, whose visit has already been counted,
+    // and returns its result for the side to move.
+    template <PieceColor COLOR>
+    double simulate(Node &node, const ChessBoard &board, int ply,
+                    std::mt19937_64 &rng) noexcept {
+        NodeState state = node.state.load(std::memory_order_acquire);
+        if (state == NodeState::UNEXPANDED) {
+            if ((ply < MAX_PLY) && node.state.compare_exchange_strong(
+                    state, NodeState::EXPANDING,
+                    std::memory_order_acquire)) {
+                expand<COLOR>(node, board);
+                state = node.state.load(std::memory_order_relaxed);
+                if (state == NodeState::TERMINAL) {
+                    return node.terminal_value;
+                }
+            }
+            return evaluate_leaf<COLOR>(board, rng);
+        }
+        if (state == NodeState::TERMINAL) { return node.terminal_value; }
+        if (state == NodeState::EXPANDING) {
+            return evaluate_leaf<COLOR>(board, rng);
+        }
+        Node &child = select(node);
+        const std::int64_t loss = options.virtual_loss * VALUE_ONE;
+        child.visits.fetch_add(1, std::memory_order_relaxed);
+        child.value.fetch_sub(loss, std::memory_order_relaxed);
+        const double result = -simulate<other(COLOR)>(
+            child, board.after_move<COLOR>(child.move()), ply + 1, rng);
+        child.value.fetch_add(
+            loss + std::llround(result * static_cast<double>(VALUE_ONE)),
+            std::memory_order_relaxed);
+        return result;
+    }
+
+    bool should_stop() const noexcept {
+        if ((limits.stop != nullptr) &&
+            limits.stop->load(std::memory_order_relaxed)) {
+            return true;
+        }
+        return std::chrono::steady_clock::now() >= limits.deadline;
+    }
+
+    Node &root() noexcept { return nodes[0]; }
+
+public:
+
+    MonteCarloOptions options;
+    MonteCarloLimits limits;
+    MonteCarloStatistics statistics;
+
+    explicit MonteCarloSearcher(std::size_t megabytes = 64) :
+        nodes(), capacity(std::max<std::size_t>(
+            (megabytes << 20) / sizeof(Node), 1)),
+        used(0), full(false), iterations(0), options(), limits(),
+        statistics() {
+        nodes = std::make_unique<Node[]>(capacity);
+        clear();
+    }
+
+    // Discards the tree in constant time.
+    void clear() noexcept {
+        used.store(1);
+        full.store(false);
+        initialize(root(), ChessMove{}, 1.0f);
+    }
+
+    std::size_t memory_bytes() const noexcept {
+        return capacity * sizeof(Node);
+    }
+
+    // Grows a fresh tree from the position, with COLOR to move, until a
+    // limit is reached, using every thread of the pool. The best move is
+    // the most visited one, and the principal variation follows the most
+    // visited child down the tree. The score is converted back from the
+    // root's mean value to centipawns.
+    template <PieceColor COLOR>
+    SearchResult search(const ChessBoard &board, ThreadPool &pool) {
+        clear();
+        iterations.store(0);
+        const std::uint64_t limit = limits.iterations;
+        pool.parallel_for(pool.size(), [&](std::size_t index, std::size_t) {
+            std::mt19937_64 rng{index + 1};
+            constexpr std::uint64_t CHECK_INTERVAL = 64;
+            for (std::uint64_t n = 1;; ++n) {
+                const std::uint64_t i = iterations.fetch_add(1);
+                if (((limit != 0) && (i >= limit)) ||
+                    ((n % CHECK_INTERVAL == 0) && should_stop())) {
+                    break;
+                }
+                root().visits.fetch_add(1, std::memory_order_relaxed);
+                simulate<COLOR>(root(), board, 0, rng);
+            }
+        });
+
+        statistics.iterations = root().visits.load();
+        statistics.tree_nodes = std::min(used.load(), capacity);
+        statistics.tree_bytes = statistics.tree_nodes * sizeof(Node);
+        statistics.tree_full = full.load();
+
+        SearchResult result{ChessMove{}, 0, 0, {}};
+        const Node *node = &root();
+        double value = 0.0;
+        while (node->state.load() == NodeState::EXPANDED) {
+            const Node *best = &nodes[node->first_child];
+            for (std::uint32_t i = 1; i < node->child_count; ++i) {
+                const Node &child = nodes[node->first_child + i];
+                if (child.visits.load() > best->visits.load()) {
+                    best = &child;
+                }
+            }
+            if (best->visits.load() == 0) { break; }
+            if (node == &root()) {
+                value = static_cast<double>(best->value.load()) /
+                        static_cast<double>(VALUE_ONE * best->visits.load());
+            }
+            result.principal_variation.push_back(best->move());
+            node = best;
+        }
+        if (!result.principal_variation.empty()) {
+            result.best_move = result.principal_variation.front();
+        }
+        result.depth = static_cast<int>(result.principal_variation.size());
+        value = std::clamp(value, -0.999, 0.999);
+        result.score = static_cast<int>(
+            std::llround(EVALUATION_SCALE * std::atanh(value)));
+        if constexpr (COLOR == PieceColor::BLACK) {
+            result.score = -result.score;
+        }
+        return result;
+    }
+
+}; // class MonteCarloSearcher
+
+
+} // namespace DZChess
+
+#endif // DZCHESS_MONTE_CARLO_HPP_INCLUDED
@@ -0,0 +1,103 @@
+#ifndef DZCHESS_MOVE_LIST_HPP_INCLUDED
+#define DZCHESS_MOVE_LIST_HPP_INCLUDED
+
+#include <array>   // for std::array
+#include <cassert> // for assert
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::uint64_t
+
+#include "ChessPiece.hpp"
+#include "ChessBoard.hpp"
+
+namespace DZChess {
+
+
+// No position with material that parse_fen accepts, or reachable from one,
+// has more pseudo-legal moves, even counting each promotion piece
+// separately.
+constexpr std::size_t MAX_MOVES = 256;
+
+
+// Fixed-capacity move buffer used by the searches, which must not allocate.
+class MoveList {
+
+    std::array<ChessMove, MAX_MOVES> moves;
+    std::size_t count;
+
+public:
+
+    explicit constexpr MoveList() noexcept : moves(), count(0) {}
+
+    constexpr std::size_t size() const noexcept { return count; }
+
+    constexpr bool empty() const noexcept { return count == 0; }
+
+    constexpr ChessMove &operator[](std::size_t i) noexcept {
+        return moves[i];
+    }
+
+    constexpr const ChessMove &operator[](std::size_t i) const noexcept {
+        return moves[i];
+    }
+
+    constexpr const ChessMove *begin() const noexcept { return moves.data(); }
+
+    constexpr const ChessMove *end() const noexcept {
+        return moves.data() + count;
+    }
+
+    constexpr void push_back(const ChessMove &move) noexcept {
+        assert(count < moves.size());
+        moves[count++] = move;
+    }
+
+}; // class MoveList
+
+
+template <PieceColor COLOR, PieceType TYPE>
+constexpr void generate_piece_moves(const ChessBoard &board, MoveList &list,
+                                    BitBoard targets) noexcept {
+    const BitBoard all_pieces = board.get_all_pieces();
+    for (const std::uint64_t src : board.get_piece<COLOR, TYPE>()) {
+        const BitBoard destinations = all_pieces.moves<COLOR, TYPE>(
+            src, board.get_pieces<COLOR>()
+        ) & targets;
+        if constexpr (TYPE == PieceType::PAWN) {
+            const bool promotes = (COLOR == PieceColor::WHITE)
+                ? ((48 <= src) && (src < 56))
+                : ((8 <= src) && (src < 16));
+            if (promotes) {
+                for (const std::uint64_t dst : destinations) {
+                    list.push_back({src, dst, TYPE, PieceType::QUEEN });
+                    list.push_back({src, dst, TYPE, PieceType::ROOK  });
+                    list.push_back({src, dst, TYPE, PieceType::BISHOP});
+                    list.push_back({src, dst, TYPE, PieceType::KNIGHT});
+                }
+                continue;
+            }
+        }
+        for (const std::uint64_t dst : destinations) {
+            list.push_back({src, dst, TYPE, TYPE});
+        }
+    }
+}
+
+
+// Appends every pseudo-legal move of the given color to the list, in the
+// same order in which ChessBoard::visit enumerates them. Only destinations
+// in targets are generated, so passing the opponent's pieces yields captures.
+template <PieceColor COLOR>
+constexpr void generate_moves(const ChessBoard &board, MoveList &list,
+                              BitBoard targets = ~BitBoard{0}) noexcept {
+    generate_piece_moves<COLOR, PieceType::KING  >(board, list, targets);
+    generate_piece_moves<COLOR, PieceType::QUEEN >(board, list, targets);
+    generate_piece_moves<COLOR, PieceType::ROOK  >(board, list, targets);
+    generate_piece_moves<COLOR, PieceType::BISHOP>(board, list, targets);
+    generate_piece_moves<COLOR, PieceType::KNIGHT>(board, list, targets);
+    generate_piece_moves<COLOR, PieceType::PAWN  >(board, list, targets);
+}
+
+
+} // namespace DZChess
+
+#endif // DZCHESS_MOVE_LIST_HPP_INCLUDED
@@ -0,0 +1,573 @@
+#ifndef DZCHESS_NNUE_HPP_INCLUDED
+#define DZCHESS_NNUE_HPP_INCLUDED
+
+#include <algorithm>   // for std::clamp, std::copy
+#include <array>       // for std::array
+#include <cstddef>     // for std::size_t
+#include <cstdint>     // for std::int8_t, std::int16_t, std::int32_t
+#include <fstream>     // for std::ifstream, std::ofstream
+#include <memory>      // for std::shared_ptr
+#include <random>      // for std::mt19937_64
+#include <string>      // for std::string
+#include <type_traits> // for std::remove_reference_t
+#include <vector>      // for std::vector
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define DZCHESS_NNUE_AVX2
+#endif
+
+#include "ChessPiece.hpp"
+#include "ChessBoard.hpp"
+#include "Evaluation.hpp"
+
+namespace DZChess {
+
+
+// Network shape: king-relative piece features for each perspective feed an
+// int16 accumulator of NNUE_HIDDEN neurons. The side to move's accumulator
+// is concatenated with the other side's and passed through clipped ReLUs
+// and two int8 dense layers to a single output.
+constexpr std::size_t NNUE_PIECE_KINDS = 10; // 5 non-king types x 2 colors
+constexpr std::size_t NNUE_FEATURES = 64 * NNUE_PIECE_KINDS * 64;
+constexpr std::size_t NNUE_HIDDEN = 256;
+constexpr std::size_t NNUE_L1 = 32;
+constexpr std::size_t NNUE_L2 = 32;
+constexpr int NNUE_WEIGHT_SHIFT = 6;
+constexpr int NNUE_OUTPUT_SCALE = 16;
+constexpr std::uint32_t NNUE_MAGIC = 0x4E4E5A44; // "DZNN"
+constexpr std::uint32_t NNUE_VERSION = 1;
+
+
+struct NNUENetwork {
+    std::vector<std::int16_t> feature_weights; // [NNUE_FEATURES][NNUE_HIDDEN]
+    std::vector<std::int16_t> feature_biases;  // [NNUE_HIDDEN]
+    std::vector<std::int8_t> l1_weights;       // [NNUE_L1][2 * NNUE_HIDDEN]
+    std::vector<std::int32_t> l1_biases;       // [NNUE_L1]
+    std::vector<std::int8_t> l2_weights;       // [NNUE_L2][NNUE_L1]
+    std::vector<std::int32_t> l2_biases;       // [NNUE_L2]
+    std::vector<std::int8_t> output_weights;   // [NNUE_L2]
+    std::int32_t output_bias;
+};
+
+
+inline void resize_nnue_network(NNUENetwork &network) {
+    network.feature_weights.resize(NNUE_FEATURES * NNUE_HIDDEN);
+    network.feature_biases.resize(NNUE_HIDDEN);
+    network.l1_weights.resize(NNUE_L1 * 2 * NNUE_HIDDEN);
+    network.l1_biases.resize(NNUE_L1);
+    network.l2_weights.resize(NNUE_L2 * NNUE_L1);
+    network.l2_biases.resize(NNUE_L2);
+    network.output_weights.resize(NNUE_L2);
+}
+
+
+// Weight files are a header of six little-endian uint32 values (magic,
+// version and the four layer sizes) followed by the arrays of NNUENetwork
+// in declaration order, stored as raw little-endian integers.
+inline std::shared_ptr<NNUENetwork>
+load_nnue_network(const std::string &path) {
+    std::ifstream file{path, std::ios::binary};
+    if (!file) { return nullptr; }
+    std::array<std::uint32_t, 6> header{};
+    file.read(reinterpret_cast<char *>(header.data()), sizeof(header));
+    const std::array<std::uint32_t, 6> expected = {
+        NNUE_MAGIC, NNUE_VERSION,
+        static_cast<std::uint32_t>(NNUE_FEATURES),
+        static_cast<std::uint32_t>(NNUE_HIDDEN),
+        static_cast<std::uint32_t>(NNUE_L1),
+        static_cast<std::uint32_t>(NNUE_L2),
+    };
+    if (!file || (header != expected)) { return nullptr; }
+    auto network = std::make_shared<NNUENetwork>();
+    resize_nnue_network(*network);
+    const auto read = [&](auto &v) {
+        file.read(reinterpret_cast<char *>(v.data()),
+                  static_cast<std::streamsize>(v.size() * sizeof(v[0])));
+    };
+    read(network->feature_weights);
+    read(network->feature_biases);
+    read(network->l1_weights);
+    read(network->l1_biases);
+    read(network->l2_weights);
+    read(network->l2_biases);
+    read(network->output_weights);
+    file.read(reinterpret_cast<char *>(&network->output_bias),
+              sizeof(network->output_bias));
+    if (!file) { return nullptr; }
+    return network;
+}
+
+
+inline bool save_nnue_network(const NNUENetwork &network,
+                              const std::string &path) {
+    std::ofstream file{path, std::ios::binary};
+    const std::array<std::uint32_t, 6> header = {
+        NNUE_MAGIC, NNUE_VERSION,
+        static_cast<std::uint32_t>(NNUE_FEATURES),
+        static_cast<std::uint32_t>(NNUE_HIDDEN),
+        static_cast<std::uint32_t>(NNUE_L1),
+        static_cast<std::uint32_t>(NNUE_L2),
+    };
+    file.write(reinterpret_cast<const char *>(header.data()), sizeof(header));
+    const auto write = [&](const auto &v) {
+        file.write(reinterpret_cast<const char *>(v.data()),
+                   static_cast<std::streamsize>(v.size() * sizeof(v[0])));
+    };
+    write(network.feature_weights);
+    write(network.feature_biases);
+    write(network.l1_weights);
+    write(network.l1_biases);
+    write(network.l2_weights);
+    write(network.l2_biases);
+    write(network.output_weights);
+    file.write(reinterpret_cast<const char *>(&network.output_bias),
+               sizeof(network.output_bias));
+    return static_cast<bool>(file);
+}
+
+
+// Small random weights, for benchmarking without a trained network.
+inline std::shared_ptr<NNUENetwork> random_nnue_network(std::uint64_t seed) {
+    auto network = std::make_shared<NNUENetwork>();
+    resize_nnue_network(*network);
+    std::mt19937_64 rng{seed};
+    std::uniform_int_distribution<int> small{-8, 8};
+    const auto fill = [&](auto &v) {
+        for (auto &w : v) {
+            w = static_cast<std::remove_reference_t<decltype(w)>>(small(rng));
+        }
+    };
+    fill(network->feature_weights);
+    fill(network->feature_biases);
+    fill(network->l1_weights);
+    fill(network->l1_biases);
+    fill(network->l2_weights);
+    fill(network->l2_biases);
+    fill(network->output_weights);
+    network->output_bias = 0;
+    return network;
+}
+
+
+struct NNUEKernels {
+    void (*add_feature)(std::int16_t *, const std::int16_t *) noexcept;
+    void (*remove_feature)(std::int16_t *, const std::int16_t *) noexcept;
+    std::int32_t (*propagate)(const NNUENetwork &, const std::int16_t *,
+                              const std::int16_t *) noexcept;
+    const char *name;
+};
+
+
+inline void nnue_add_feature_scalar(std::int16_t *accumulator,
+                                    const std::int16_t *weights) noexcept {
+    for (std::size_t i = 0; i < NNUE_HIDDEN; ++i) {
+        accumulator[i] = static_cast<std::int16_t>(accumulator[i] + weights[i]);
+    }
+}
+
+
+inline void nnue_remove_feature_scalar(std::int16_t *accumulator,
+                                       const std::int16_t *weights) noexcept {
+    for (std::size_t i = 0; i < NNUE_HIDDEN; ++i) {
+        accumulator[i] = static_cast<std::int16_t>(accumulator[i] - weights[i]);
+    }
+}
+
+
+template <std::size_t INPUTS, std::size_t OUTPUTS>
+void nnue_affine_scalar(const std::uint8_t *input, const std::int8_t *weights,
+                        const std::int32_t *biases,
+                        std::int32_t *output) noexcept {
+    for (std::size_t j = 0; j < OUTPUTS; ++j) {
+        std::int32_t sum = biases[j];
+        for (std::size_t i = 0; i < INPUTS; ++i) {
+            sum += static_cast<std::int32_t>(input[i]) *
+                   static_cast<std::int32_t>(weights[j * INPUTS + i]);
+        }
+        output[j] = sum;
+    }
+}
+
+
+template <std::size_t SIZE>
+void nnue_clipped_relu(const std::int32_t *input, std::uint8_t *output,
+                       int shift) noexcept {
+    for (std::size_t i = 0; i < SIZE; ++i) {
+        output[i] = static_cast<std::uint8_t>(
+            std::clamp(input[i] >> shift, 0, 127)
+        );
+    }
+}
+
+
+inline std::int32_t nnue_propagate_scalar(const NNUENetwork &network,
+                                          const std::int16_t *us,
+                                          const std::int16_t *them) noexcept {
+    std::array<std::uint8_t, 2 * NNUE_HIDDEN> input;
+    for (std::size_t i = 0; i < NNUE_HIDDEN; ++i) {
+        input[i] = static_cast<std::uint8_t>(
+            std::clamp<int>(us[i], 0, 127));
+        input[NNUE_HIDDEN + i] = static_cast<std::uint8_t>(
+            std::clamp<int>(them[i], 0, 127));
+    }
+    std::array<std::int32_t, NNUE_L1> l1;
+    std::array<std::uint8_t, NNUE_L1> h1;
+    nnue_affine_scalar<2 * NNUE_HIDDEN, NNUE_L1>(
+        input.data(), network.l1_weights.data(),
+        network.l1_biases.data(), l1.data());
+    nnue_clipped_relu<NNUE_L1>(l1.data(), h1.data(), NNUE_WEIGHT_SHIFT);
+    std::array<std::int32_t, NNUE_L2> l2;
+    std::array<std::uint8_t, NNUE_L2> h2;
+    nnue_affine_scalar<NNUE_L1, NNUE_L2>(
+        h1.data(), network.l2_weights.data(),
+        network.l2_biases.data(), l2.data());
+    nnue_clipped_relu<NNUE_L2>(l2.data(), h2.data(), NNUE_WEIGHT_SHIFT);
+    std::int32_t output = network.output_bias;
+    for (std::size_t i = 0; i < NNUE_L2; ++i) {
+        output += static_cast<std::int32_t>(h2[i]) *
+                  static_cast<std::int32_t>(network.output_weights[i]);
+    }
+    return output;
+}
+
+
+constexpr NNUEKernels NNUE_SCALAR_KERNELS = {
+    nnue_add_feature_scalar,
+    nnue_remove_feature_scalar,
+    nnue_propagate_scalar,
+    "scalar",
+};
+
+
+#ifdef DZCHESS_NNUE_AVX2
+
+__attribute__((target("avx2")))
+inline void nnue_add_feature_avx2(std::int16_t *accumulator,
+                                  const std::int16_t *weights) noexcept {
+    for (std::size_t i = 0; i < NNUE_HIDDEN; i += 16) {
+        auto *a = reinterpret_cast<__m256i *>(accumulator + i);
+        const auto *w = reinterpret_cast<const __m256i *>(weights + i);
+        _mm256_storeu_si256(a, _mm256_add_epi16(_mm256_loadu_si256(a),
+                                                _mm256_loadu_si256(w)));
+    }
+}
+
+
+__attribute__((target("avx2")))
+inline void nnue_remove_feature_avx2(std::int16_t *accumulator,
+                                     const std::int16_t *weights) noexcept {
+    for (std::size_t i = 0; i < NNUE_HIDDEN; i += 16) {
+        auto *a = reinterpret_cast<__m256i *>(accumulator + i);
+        const auto *w = reinterpret_cast<const __m256i *>(weights + i);
+        _mm256_storeu_si256(a, _mm256_sub_epi16(_mm256_loadu_si256(a),
+                                                _mm256_loadu_si256(w)));
+    }
+}
+
+
+// Packs 32 int16 values into 32 uint8 values clamped to [0, 127].
+__attribute__((target("avx2")))
+inline __m256i nnue_pack_avx2(const std::int16_t *values) noexcept {
+    const __m256i lo = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i *>(values));
+    const __m256i hi = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i *>(values + 16));
+    // packs_epi16 saturates to [-128, 127] but interleaves the 128-bit
+    // lanes of its operands, which the permutation undoes.
+    const __m256i packed = _mm256_max_epi8(_mm256_packs_epi16(lo, hi),
+                                           _mm256_setzero_si256());
+    return _mm256_permute4x64_epi64(packed, 0b11011000);
+}
+
+
+__attribute__((target("avx2")))
+inline std::int32_t nnue_horizontal_sum_avx2(__m256i v) noexcept {
+    const __m128i sum128 = _mm_add_epi32(_mm256_castsi256_si128(v),
+                                         _mm256_extracti128_si256(v, 1));
+    const __m128i sum64 = _mm_add_epi32(sum128,
+                                        _mm_unpackhi_epi64(sum128, sum128));
+    const __m128i sum32 = _mm_add_epi32(sum64,
+                                        _mm_shuffle_epi32(sum64, 0b10110001));
+    return _mm_cvtsi128_si32(sum32);
+}
+
+
+// Dot products of uint8 inputs with int8 weight rows. The inputs are at
+// most 127, so maddubs cannot saturate its int16 pair sums.
+template <std::size_t INPUTS, std::size_t OUTPUTS>
+__attribute__((target("avx2")))
+void nnue_affine_avx2(const std::uint8_t *input, const std::int8_t *weights,
+                      const std::int32_t *biases,
+                      std::int32_t *output) noexcept {
+    const __m256i ones = _mm256_set1_epi16(1);
+    for (std::size_t j = 0; j < OUTPUTS; ++j) {
+        __m256i sum = _mm256_setzero_si256();
+        for (std::size_t i = 0; i < INPUTS; i += 32) {
+            const __m256i x = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i *>(input + i));
+            const __m256i w = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i *>(weights + j * INPUTS + i));
+            sum = _mm256_add_epi32(sum, _mm256_madd_epi16(
+                _mm256_maddubs_epi16(x, w), ones));
+        }
+        output[j] = biases[j] + nnue_horizontal_sum_avx2(sum);
+    }
+}
+
+
+__attribute__((target("avx2")))
+inline std::int32_t nnue_propagate_avx2(const NNUENetwork &network,
+                                        const std::int16_t *us,
+                                        const std::int16_t *them) noexcept {
+    alignas(32) std::array<std::uint8_t, 2 * NNUE_HIDDEN> input;
+    for (std::size_t i = 0; i < NNUE_HIDDEN; i += 32) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(input.data() + i),
+                            nnue_pack_avx2(us + i));
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i *>(input.data() + NNUE_HIDDEN + i),
+            nnue_pack_avx2(them + i));
+    }
+    alignas(32) std::array<std::int32_t, NNUE_L1> l1;
+    alignas(32) std::array<std::uint8_t, NNUE_L1> h1;
+    nnue_affine_avx2<2 * NNUE_HIDDEN, NNUE_L1>(
+        input.data(), network.l1_weights.data(),
+        network.l1_biases.data(), l1.data());
+    nnue_clipped_relu<NNUE_L1>(l1.data(), h1.data(), NNUE_WEIGHT_SHIFT);
+    alignas(32) std::array<std::int32_t, NNUE_L2> l2;
+    alignas(32) std::array<std::uint8_t, NNUE_L2> h2;
+    nnue_affine_avx2<NNUE_L1, NNUE_L2>(
+        h1.data(), network.l2_weights.data(),
+        network.l2_biases.data(), l2.data());
+    nnue_clipped_relu<NNUE_L2>(l2.data(), h2.data(), NNUE_WEIGHT_SHIFT);
+    std::int32_t output = network.output_bias;
+    for (std::size_t i = 0; i < NNUE_L2; ++i) {
+        output += static_cast<std::int32_t>(h2[i]) *
+                  static_cast<std::int32_t>(network.output_weights[i]);
+    }
+    return output;
+}
+
+
+constexpr NNUEKernels NNUE_AVX2_KERNELS = {
+    nnue_add_feature_avx2,
+    nnue_remove_feature_avx2,
+    nnue_propagate_avx2,
+    "avx2",
+};
+
+#endif // DZCHESS_NNUE_AVX2
+
+
+inline bool nnue_avx2_supported() noexcept {
+#ifdef DZCHESS_NNUE_AVX2
+    return __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+}
+
+
+// Kernels used by all accumulators, chosen once at startup from the CPU's
+// capabilities. Benchmarks may reassign it to compare implementations.
+inline const NNUEKernels *&nnue_kernels() noexcept {
+#ifdef DZCHESS_NNUE_AVX2
+    static const NNUEKernels *kernels = nnue_avx2_supported()
+        ? &NNUE_AVX2_KERNELS : &NNUE_SCALAR_KERNELS;
+#else
+    static const NNUEKernels *kernels = &NNUE_SCALAR_KERNELS;
+#endif
+    return kernels;
+}
+
+
+// First-layer outputs for both perspectives. Rather than being rebuilt for
+// every position, the accumulator is moved from the last position it
+// described to the next one by adding and removing only the features of
+// pieces that differ between them. A perspective is rebuilt from scratch
+// only when its own king has moved, since every feature depends on it.
+class NNUEAccumulator {
+
+    alignas(32) std::array<std::array<std::int16_t, NNUE_HIDDEN>, 2> values;
+    ChessBoard board;
+    std::shared_ptr<const NNUENetwork> network;
+
+    template <PieceColor PERSPECTIVE>
+    static constexpr std::uint64_t orient(std::uint64_t square) noexcept {
+        return (PERSPECTIVE == PieceColor::WHITE) ? square : (square ^ 56);
+    }
+
+    template <PieceColor PERSPECTIVE, PieceColor COLOR, PieceType TYPE>
+    static constexpr std::size_t feature(std::uint64_t king,
+                                         std::uint64_t square) noexcept {
+        const std::size_t kind = static_cast<std::size_t>(TYPE) - 1 +
+            ((COLOR == PERSPECTIVE) ? 0 : NNUE_PIECE_KINDS / 2);
+        return (orient<PERSPECTIVE>(king) * NNUE_PIECE_KINDS + kind) * 64 +
+               orient<PERSPECTIVE>(square);
+    }
+
+    template <PieceColor PERSPECTIVE>
+    std::int16_t *row() noexcept {
+        return values[static_cast<std::size_t>(PERSPECTIVE)].data();
+    }
+
+    template <PieceColor PERSPECTIVE, PieceColor COLOR, PieceType TYPE>
+    void add_pieces(const NNUENetwork &net, std::uint64_t king,
+                    BitBoard pieces) noexcept {
+        for (const std::uint64_t square : pieces) {
+            nnue_kernels()->add_feature(row<PERSPECTIVE>(),
+                net.feature_weights.data() +
+                feature<PERSPECTIVE, COLOR, TYPE>(king, square) * NNUE_HIDDEN);
+        }
+    }
+
+    template <PieceColor PERSPECTIVE, PieceColor COLOR, PieceType TYPE>
+    void remove_pieces(const NNUENetwork &net, std::uint64_t king,
+                       BitBoard pieces) noexcept {
+        for (const std::uint64_t square : pieces) {
+            nnue_kernels()->remove_feature(row<PERSPECTIVE>(),
+                net.feature_weights.data() +
+                feature<PERSPECTIVE, COLOR, TYPE>(king, square) * NNUE_HIDDEN);
+        }
+    }
+
+    template <PieceColor PERSPECTIVE, PieceColor COLOR, PieceType TYPE>
+    void update_pieces(const NNUENetwork &net, std::uint64_t king,
+                       const ChessBoard &next) noexcept {
+        const BitBoard before = board.get_piece<COLOR, TYPE>();
+        const BitBoard after = next.get_piece<COLOR, TYPE>();
+        remove_pieces<PERSPECTIVE, COLOR, TYPE>(net, king, before & ~after);
+        add_pieces<PERSPECTIVE, COLOR, TYPE>(net, king, after & ~before);
+    }
+
+    template <PieceColor PERSPECTIVE, PieceColor COLOR>
+    void refresh_color(const NNUENetwork &net, std::uint64_t king,
+                       const ChessBoard &next) noexcept {
+        using enum PieceType;
+        add_pieces<PERSPECTIVE, COLOR, QUEEN >(
+            net, king, next.get_piece<COLOR, QUEEN >());
+        add_pieces<PERSPECTIVE, COLOR, ROOK  >(
+            net, king, next.get_piece<COLOR, ROOK  >());
+        add_pieces<PERSPECTIVE, COLOR, BISHOP>(
+            net, king, next.get_piece<COLOR, BISHOP>());
+        add_pieces<PERSPECTIVE, COLOR, KNIGHT>(
+            net, king, next.get_piece<COLOR, KNIGHT>());
+        add_pieces<PERSPECTIVE, COLOR, PAWN  >(
+            net, king, next.get_piece<COLOR, PAWN  >());
+    }
+
+    template <PieceColor PERSPECTIVE, PieceColor COLOR>
+    void update_color(const NNUENetwork &net, std::uint64_t king,
+                      const ChessBoard &next) noexcept {
+        using enum PieceType;
+        update_pieces<PERSPECTIVE, COLOR, QUEEN >(net, king, next);
+        update_pieces<PERSPECTIVE, COLOR, ROOK  >(net, king, next);
+        update_pieces<PERSPECTIVE, COLOR, BISHOP>(net, king, next);
+        update_pieces<PERSPECTIVE, COLOR, KNIGHT>(net, king, next);
+        update_pieces<PERSPECTIVE, COLOR, PAWN  >(net, king, next);
+    }
+
+    template <PieceColor PERSPECTIVE>
+    void refresh(const NNUENetwork &net, const ChessBoard &next) noexcept {
+        const std::int16_t *biases = net.feature_biases.data();
+        std::copy(biases, biases + NNUE_HIDDEN, row<PERSPECTIVE>());
+        const std::uint64_t king =
+            *next.get_piece<PERSPECTIVE, PieceType::KING>().begin();
+        refresh_color<PERSPECTIVE, PieceColor::WHITE>(net, king, next);
+        refresh_color<PERSPECTIVE, PieceColor::BLACK>(net, king, next);
+    }
+
+    template <PieceColor PERSPECTIVE>
+    void update(const NNUENetwork &net, const ChessBoard &next,
+                bool force_refresh) noexcept {
+        const BitBoard king = next.get_piece<PERSPECTIVE, PieceType::KING>();
+        if (force_refresh ||
+            !(king & ~board.get_piece<PERSPECTIVE, PieceType::KING>())
+                .is_empty()) {
+            refresh<PERSPECTIVE>(net, next);
+        } else {
+            update_color<PERSPECTIVE, PieceColor::WHITE>(net, *king.begin(),
+                                                         next);
+            update_color<PERSPECTIVE, PieceColor::BLACK>(net, *king.begin(),
+                                                         next);
+        }
+    }
+
+public:
+
+    explicit NNUEAccumulator() noexcept :
+        values(), board(), network() {}
+
+    // Brings the accumulator to the given position, which must contain
+    // both kings. Accumulators built with a different network are rebuilt;
+    // holding a reference to the old one keeps its address from being
+    // reused by the new one.
+    void update(const std::shared_ptr<const NNUENetwork> &net,
+                const ChessBoard &next, bool force_refresh = false) noexcept {
+        if (network != net) {
+            network = net;
+            force_refresh = true;
+        }
+        update<PieceColor::WHITE>(*net, next, force_refresh);
+        update<PieceColor::BLACK>(*net, next, force_refresh);
+        board = next;
+    }
+
+    // Evaluates the current position with COLOR to move, returning the
+    // score in centipawns from white's point of view.
+    template <PieceColor COLOR>
+    int evaluate() const noexcept {
+        const std::size_t us = static_cast<std::size_t>(COLOR);
+        const std::int32_t output = nnue_kernels()->propagate(
+            *network, values[us].data(), values[1 - us].data()
+        );
+        const int score = static_cast<int>(output / NNUE_OUTPUT_SCALE);
+        return (COLOR == PieceColor::WHITE) ? score : -score;
+    }
+
+}; // class NNUEAccumulator
+
+
+// Network used by NNUEEvaluationVisitor. Loading a new network replaces it;
+// accumulators notice the change and rebuild themselves. It must not be
+// replaced while a search is running.
+inline std::shared_ptr<const NNUENetwork> &active_nnue_network() noexcept {
+    static std::shared_ptr<const NNUENetwork> network{};
+    return network;
+}
+
+
+// Neural network evaluation for the same leaf slot as the other visitors.
+// Each thread keeps its own accumulator, which follows the positions that
+// thread evaluates. Falls back to the piece-square evaluation when no
+// network has been loaded.
+template <PieceColor COLOR, int DEPTH>
+struct NNUEEvaluationVisitor
+    : public MaterialisticEvaluationVisitor<COLOR, DEPTH> {
+
+    using result_type = int;
+    using MaterialisticEvaluationVisitor<COLOR, DEPTH>::visit;
+
+    static result_type visit(const ChessBoard &b) noexcept {
+        if (b.piece_count<PieceColor::WHITE, PieceType::KING>() == 0)
+            return -1'000'000;
+        if (b.piece_count<PieceColor::BLACK, PieceType::KING>() == 0)
+            return +1'000'000;
+        const auto &network = active_nnue_network();
+        if (!network) {
+            return PieceSquareEvaluationVisitor<COLOR, DEPTH>::visit(b);
+        }
+        thread_local NNUEAccumulator accumulator{};
+        accumulator.update(network, b);
+        return accumulator.evaluate<COLOR>();
+    }
+
+    explicit constexpr NNUEEvaluationVisitor() noexcept
+        : MaterialisticEvaluationVisitor<COLOR, DEPTH>() {}
+
+}; // struct NNUEEvaluationVisitor
+
+
+} // namespace DZChess
+
+#endif // DZCHESS_NNUE_HPP_INCLUDED
@@ -0,0 +1,101 @@
+#include <chrono>   // for std::chrono::steady_clock
+#include <cstddef>  // for std::size_t
+#include <cstdint>  // for std::uint64_t
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ChessPiece.hpp"
+#include "ChessBoard.hpp"
+#include "MoveList.hpp"
+#include "Evaluation.hpp"
+#include "NNUE.hpp"
+#include "RandomGames.hpp"
+
+
+using namespace DZChess;
+
+
+template <typename Function>
+void benchmark(const std::string &name, std::size_t count, Function f) {
+    const auto start = std::chrono::steady_clock::now();
+    const long long checksum = f();
+    const auto stop = std::chrono::steady_clock::now();
+    const double seconds = std::chrono::duration<double>(stop - start).count();
+    std::cout << "    " << name << ": "
+              << static_cast<double>(count) / seconds << " evals/s"
+              << " (checksum " << checksum << ")" << std::endl;
+}
+
+
+void benchmark_kernels(
+    const std::shared_ptr<const NNUENetwork> &network,
+    const std::vector<std::pair<ChessBoard, PieceColor>> &positions
+) {
+    std::cout << nnue_kernels()->name << " kernels:" << std::endl;
+    benchmark("full refresh", positions.size(), [&]() {
+        NNUEAccumulator accumulator{};
+        long long checksum = 0;
+        for (const auto &[board, color] : positions) {
+            accumulator.update(network, board, true);
+            checksum += (color == PieceColor::WHITE)
+                ? accumulator.evaluate<PieceColor::WHITE>()
+                : accumulator.evaluate<PieceColor::BLACK>();
+        }
+        return checksum;
+    });
+    benchmark("incremental", positions.size(), [&]() {
+        NNUEAccumulator accumulator{};
+        long long checksum = 0;
+        for (const auto &[board, color] : positions) {
+            accumulator.update(network, board);
+            checksum += (color == PieceColor::WHITE)
+                ? accumulator.evaluate<PieceColor::WHITE>()
+                : accumulator.evaluate<PieceColor::BLACK>();
+        }
+        return checksum;
+    });
+}
+
+
+int main(int argc, char **argv) {
+
+    std::shared_ptr<const NNUENetwork> network{};
+    if (argc > 1) {
+        network = load_nnue_network(argv[1]);
+        if (!network) {
+            std::cout << "ERROR: could not load network from "
+                      << argv[1] << std::endl;
+            return 1;
+        }
+    } else {
+        std::cout << "No weights file given; using a random network."
+                  << std::endl;
+        network = random_nnue_network(1);
+    }
+
+    const std::size_t count = 1'000'000;
+    const auto positions = random_game_positions(count, 2);
+
+    std::cout << "piece-square baseline:" << std::endl;
+    benchmark("incremental", count, [&]() {
+        long long checksum = 0;
+        for (const auto &[board, color] : positions) {
+            checksum += PieceSquareEvaluationVisitor<
+                PieceColor::WHITE, 0>::visit(board);
+        }
+        return checksum;
+    });
+
+    const NNUEKernels *detected = nnue_kernels();
+    nnue_kernels() = &NNUE_SCALAR_KERNELS;
+    benchmark_kernels(network, positions);
+    if (detected != &NNUE_SCALAR_KERNELS) {
+        nnue_kernels() = detected;
+        benchmark_kernels(network, positions);
+    } else {
+        std::cout << "AVX2 not available on this CPU." << std::endl;
+    }
+
+}
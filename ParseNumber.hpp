@@ -0,0 +1,25 @@
+#ifndef DZCHESS_PARSE_NUMBER_HPP_INCLUDED
+#define DZCHESS_PARSE_NUMBER_HPP_INCLUDED
+
+#include <charconv>     // for std::from_chars
+#include <string_view>  // for std::string_view
+#include <system_error> // for std::errc
+
+namespace DZChess {
+
+
+// Reads text that must consist of a number and nothing else: no sign for
+// unsigned types, no trailing characters and no value out of range. Unlike
+// std::stoi, reports bad input instead of throwing, so that user input
+// cannot end a batch run, a UCI session or a server connection.
+template <typename T>
+constexpr bool parse_number(std::string_view text, T &result) noexcept {
+    const char *end = text.data() + text.size();
+    const auto [last, error] = std::from_chars(text.data(), end, result);
+    return (error == std::errc{}) && (last == end);
+}
+
+
+} // namespace DZChess
+
+#endif // DZCHESS_PARSE_NUMBER_HPP_INCLUDED
@@ -0,0 +1,190 @@
+#ifndef DZCHESS_PAWN_STRUCTURE_HPP_INCLUDED
+#define DZCHESS_PAWN_STRUCTURE_HPP_INCLUDED
+
+#include <array>   // for std::array
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::uint64_t, std::int32_t
+#include <vector>  // for std::vector
+
+#include "ChessPiece.hpp"
+#include "BitBoard.hpp"
+#include "ChessBoard.hpp"
+
+namespace DZChess {
+
+
+// Pawn structure terms in centipawns, as (midgame, endgame) pairs.
+constexpr int DOUBLED_PAWN_MIDGAME = -10;
+constexpr int DOUBLED_PAWN_ENDGAME = -20;
+constexpr int ISOLATED_PAWN_MIDGAME = -10;
+constexpr int ISOLATED_PAWN_ENDGAME = -15;
+constexpr int BACKWARD_PAWN_MIDGAME = -8;
+constexpr int BACKWARD_PAWN_ENDGAME = -10;
+
+// Passed pawn bonuses indexed by rank, counted from the pawn's own side.
+constexpr std::array<int, 8> PASSED_PAWN_MIDGAME = {
+    0, 5, 10, 20, 35, 60, 100, 0
+};
+constexpr std::array<int, 8> PASSED_PAWN_ENDGAME = {
+    0, 10, 20, 40, 70, 120, 200, 0
+};
+
+
+struct PawnEvaluation {
+    std::int32_t midgame;
+    std::int32_t endgame;
+};
+
+
+template <PieceColor COLOR>
+constexpr BitBoard shift_forward(BitBoard b) noexcept {
+    if constexpr (COLOR == PieceColor::WHITE) {
+        return b.shift_up();
+    } else {
+        return b.shift_down();
+    }
+}
+
+
+template <PieceColor COLOR>
+constexpr BitBoard fill_forward(BitBoard b) noexcept {
+    if constexpr (COLOR == PieceColor::WHITE) {
+        return b.fill_up();
+    } else {
+        return b.fill_down();
+    }
+}
+
+
+template <PieceColor COLOR>
+constexpr BitBoard fill_backward(BitBoard b) noexcept {
+    return fill_forward<other(COLOR)>(b);
+}
+
+
+template <PieceColor COLOR>
+constexpr BitBoard pawn_attacks(BitBoard pawns) noexcept {
+    const BitBoard forward = shift_forward<COLOR>(pawns);
+    return forward.shift_east() | forward.shift_west();
+}
+
+
+// Evaluates the pawns of one color from that color's point of view. Every
+// term is computed for all pawns at once from the two pawn bitboards.
+template <PieceColor COLOR>
+constexpr PawnEvaluation evaluate_pawns(BitBoard own,
+                                        BitBoard opp) noexcept {
+    constexpr PieceColor OTHER = other(COLOR);
+
+    // A pawn is doubled if another pawn of its color stands in front of it.
+    const BitBoard behind_own =
+        fill_backward<COLOR>(shift_forward<OTHER>(own));
+    const int doubled = (own & behind_own).popcount();
+
+    // A pawn is isolated if no pawn of its color stands on an adjacent file.
+    const BitBoard files = own.fill_up() | own.fill_down();
+    const BitBoard isolated = own & ~(files.shift_east() | files.shift_west());
+
+    // A pawn is passed if no enemy pawn stands in front of it on its own or
+    // an adjacent file, and it is not behind a pawn of its own color.
+    const BitBoard opp_front = fill_forward<OTHER>(shift_forward<OTHER>(opp));
+    const BitBoard blocked = opp_front | opp_front.shift_east() |
+                             opp_front.shift_west();
+    const BitBoard passed = own & ~blocked & ~behind_own;
+
+    // A pawn is backward if enemy pawns control the square in front of it
+    // and no pawn of its color on an adjacent file can advance to defend it.
+    const BitBoard stops = shift_forward<COLOR>(own);
+    const BitBoard support = fill_forward<COLOR>(pawn_attacks<COLOR>(own));
+    const BitBoard backward = stops & pawn_attacks<OTHER>(opp) & ~support;
+
+    PawnEvaluation result{
+        doubled * DOUBLED_PAWN_MIDGAME +
+        isolated.popcount() * ISOLATED_PAWN_MIDGAME +
+        backward.popcount() * BACKWARD_PAWN_MIDGAME,
+        doubled * DOUBLED_PAWN_ENDGAME +
+        isolated.popcount() * ISOLATED_PAWN_ENDGAME +
+        backward.popcount() * BACKWARD_PAWN_ENDGAME
+    };
+    for (const std::uint64_t square : passed) {
+        const std::size_t rank = (COLOR == PieceColor::WHITE)
+            ? (square / 8) : (7 - square / 8);
+        result.midgame += PASSED_PAWN_MIDGAME[rank];
+        result.endgame += PASSED_PAWN_ENDGAME[rank];
+    }
+    return result;
+}
+
+
+// Pawn structure evaluation from white's point of view.
+constexpr PawnEvaluation evaluate_pawns(const ChessBoard &board) noexcept {
+    const BitBoard white =
+        board.get_piece<PieceColor::WHITE, PieceType::PAWN>();
+    const BitBoard black =
+        board.get_piece<PieceColor::BLACK, PieceType::PAWN>();
+    const PawnEvaluation w = evaluate_pawns<PieceColor::WHITE>(white, black);
+    const PawnEvaluation b = evaluate_pawns<PieceColor::BLACK>(black, white);
+    return {w.midgame - b.midgame, w.endgame - b.endgame};
+}
+
+
+// Direct-mapped cache of pawn structure evaluations keyed by the board's
+// pawn hash. Pawn structures change far less often than positions, so
+// almost every probe hits. Fresh entries have key zero and score zero,
+// which is exactly right for positions without pawns.
+class PawnHashTable {
+
+    struct Entry {
+        std::uint64_t key;
+        PawnEvaluation evaluation;
+    };
+
+    std::vector<Entry> entries;
+    std::uint64_t mask;
+
+public:
+
+    std::uint64_t probes;
+    std::uint64_t hits;
+
+    explicit PawnHashTable(std::size_t log2_size = 14) :
+        entries(std::size_t{1} << log2_size, Entry{0, {0, 0}}),
+        mask((std::uint64_t{1} << log2_size) - 1),
+        probes(0),
+        hits(0) {}
+
+    PawnEvaluation probe(const ChessBoard &board) noexcept {
+        const std::uint64_t key = board.get_pawn_hash();
+        Entry &entry = entries[key & mask];
+        ++probes;
+        if (entry.key == key) {
+            ++hits;
+            return entry.evaluation;
+        }
+        entry = {key, evaluate_pawns(board)};
+        return entry.evaluation;
+    }
+
+    double hit_rate() const noexcept {
+        return (probes == 0) ? 0.0 : static_cast<double>(hits) /
+                                     static_cast<double>(probes);
+    }
+
+    void reset_statistics() noexcept {
+        probes = 0;
+        hits = 0;
+    }
+
+}; // class PawnHashTable
+
+
+// Each thread has its own pawn hash table, so evaluation needs no locking.
+inline PawnHashTable &pawn_hash_table() {
+    thread_local PawnHashTable table{};
+    return table;
+}
+
+
+} // namespace DZChess
+
+#endif // DZCHESS_PAWN_STRUCTURE_HPP_INCLUDED
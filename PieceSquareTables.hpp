@@ -0,0 +1,211 @@
+#ifndef DZCHESS_PIECE_SQUARE_TABLES_HPP_INCLUDED
+#define DZCHESS_PIECE_SQUARE_TABLES_HPP_INCLUDED
+
+#include <algorithm> // for std::min
+#include <array>     // for std::array
+#include <cstddef>   // for std::size_t
+#include <cstdint>   // for std::uint64_t
+
+#include "ChessPiece.hpp"
+
+namespace DZChess {
+
+
+using PieceSquareTable = std::array<int, 64>;
+
+
+// Material values in centipawns, indexed by PieceType. The king is not
+// given a value because losing it ends the game.
+constexpr std::array<int, 6> MIDGAME_MATERIAL = {0, 900, 500, 300, 300, 100};
+constexpr std::array<int, 6> ENDGAME_MATERIAL = {0, 900, 500, 300, 300, 120};
+
+// Contribution of each piece type to the game phase. The phase starts at
+// MAX_PHASE with all pieces on the board and reaches zero in pawn endings.
+constexpr std::array<int, 6> PHASE_WEIGHT = {0, 4, 2, 1, 1, 0};
+constexpr int MAX_PHASE = 24;
+
+
+// The tables below are written from white's point of view with rank 8 at
+// the top, so that they read like a diagram. The entry for a white piece on
+// square s is therefore at index s ^ 56, and for a black piece at index s.
+
+constexpr PieceSquareTable KING_MIDGAME_TABLE = {
+    -30, -40, -40, -50, -50, -40, -40, -30,
+    -30, -40, -40, -50, -50, -40, -40, -30,
+    -30, -40, -40, -50, -50, -40, -40, -30,
+    -30, -40, -40, -50, -50, -40, -40, -30,
+    -20, -30, -30, -40, -40, -30, -30, -20,
+    -10, -20, -20, -20, -20, -20, -20, -10,
+     20,  20,   0,   0,   0,   0,  20,  20,
+     20,  30,  10,   0,   0,  10,  30,  20,
+};
+
+constexpr PieceSquareTable KING_ENDGAME_TABLE = {
+    -50, -40, -30, -20, -20, -30, -40, -50,
+    -30, -20, -10,   0,   0, -10, -20, -30,
+    -30, -10,  20,  30,  30,  20, -10, -30,
+    -30, -10,  30,  40,  40,  30, -10, -30,
+    -30, -10,  30,  40,  40,  30, -10, -30,
+    -30, -10,  20,  30,  30,  20, -10, -30,
+    -30, -30,   0,   0,   0,   0, -30, -30,
+    -50, -30, -30, -30, -30, -30, -30, -50,
+};
+
+constexpr PieceSquareTable QUEEN_TABLE = {
+    -20, -10, -10,  -5,  -5, -10, -10, -20,
+    -10,   0,   0,   0,   0,   0,   0, -10,
+    -10,   0,   5,   5,   5,   5,   0, -10,
+     -5,   0,   5,   5,   5,   5,   0,  -5,
+      0,   0,   5,   5,   5,   5,   0,  -5,
+    -10,   5,   5,   5,   5,   5,   0, -10,
+    -10,   0,   5,   0,   0,   0,   0, -10,
+    -20, -10, -10,  -5,  -5, -10, -10, -20,
+};
+
+constexpr PieceSquareTable ROOK_TABLE = {
+      0,   0,   0,   0,   0,   0,   0,   0,
+      5,  10,  10,  10,  10,  10,  10,   5,
+     -5,   0,   0,   0,   0,   0,   0,  -5,
+     -5,   0,   0,   0,   0,   0,   0,  -5,
+     -5,   0,   0,   0,   0,   0,   0,  -5,
+     -5,   0,   0,   0,   0,   0,   0,  -5,
+     -5,   0,   0,   0,   0,   0,   0,  -5,
+      0,   0,   0,   5,   5,   0,   0,   0,
+};
+
+constexpr PieceSquareTable BISHOP_TABLE = {
+    -20, -10, -10, -10, -10, -10, -10, -20,
+    -10,   0,   0,   0,   0,   0,   0, -10,
+    -10,   0,   5,  10,  10,   5,   0, -10,
+    -10,   5,   5,  10,  10,   5,   5, -10,
+    -10,   0,  10,  10,  10,  10,   0, -10,
+    -10,  10,  10,  10,  10,  10,  10, -10,
+    -10,   5,   0,   0,   0,   0,   5, -10,
+    -20, -10, -10, -10, -10, -10, -10, -20,
+};
+
+constexpr PieceSquareTable KNIGHT_TABLE = {
+    -50, -40, -30, -30, -30, -30, -40, -50,
+    -40, -20,   0,   0,   0,   0, -20, -40,
+    -30,   0,  10,  15,  15,  10,   0, -30,
+    -30,   5,  15,  20,  20,  15,   5, -30,
+    -30,   0,  15,  20,  20,  15,   0, -30,
+    -30,   5,  10,  15,  15,  10,   5, -30,
+    -40, -20,   0,   5,   5,   0, -20, -40,
+    -50, -40, -30, -30, -30, -30, -40, -50,
+};
+
+constexpr PieceSquareTable PAWN_MIDGAME_TABLE = {
+      0,   0,   0,   0,   0,   0,   0,   0,
+     50,  50,  50,  50,  50,  50,  50,  50,
+     10,  10,  20,  30,  30,  20,  10,  10,
+      5,   5,  10,  25,  25,  10,   5,   5,
+      0,   0,   0,  20,  20,   0,   0,   0,
+      5,  -5, -10,   0,   0, -10,  -5,   5,
+      5,  10,  10, -20, -20,  10,  10,   5,
+      0,   0,   0,   0,   0,   0,   0,   0,
+};
+
+constexpr PieceSquareTable PAWN_ENDGAME_TABLE = {
+      0,   0,   0,   0,   0,   0,   0,   0,
+     80,  80,  80,  80,  80,  80,  80,  80,
+     50,  50,  50,  50,  50,  50,  50,  50,
+     30,  30,  30,  30,  30,  30,  30,  30,
+     15,  15,  15,  15,  15,  15,  15,  15,
+      5,   5,   5,   5,   5,   5,   5,   5,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+};
+
+
+// Material plus piece-square bonus, indexed by [PieceType][table index].
+constexpr std::array<PieceSquareTable, 6> combine_tables(
+    const std::array<int, 6> &material,
+    const std::array<PieceSquareTable, 6> &tables
+) noexcept {
+    std::array<PieceSquareTable, 6> result{};
+    for (std::size_t type = 0; type < 6; ++type) {
+        for (std::size_t i = 0; i < 64; ++i) {
+            result[type][i] = material[type] + tables[type][i];
+        }
+    }
+    return result;
+}
+
+constexpr std::array<PieceSquareTable, 6> MIDGAME_TABLE = combine_tables(
+    MIDGAME_MATERIAL, {KING_MIDGAME_TABLE, QUEEN_TABLE, ROOK_TABLE,
+                       BISHOP_TABLE, KNIGHT_TABLE, PAWN_MIDGAME_TABLE}
+);
+
+constexpr std::array<PieceSquareTable, 6> ENDGAME_TABLE = combine_tables(
+    ENDGAME_MATERIAL, {KING_ENDGAME_TABLE, QUEEN_TABLE, ROOK_TABLE,
+                       BISHOP_TABLE, KNIGHT_TABLE, PAWN_ENDGAME_TABLE}
+);
+
+
+// Interpolates between midgame and endgame scores by game phase. Promotions
+// can push the phase above MAX_PHASE, so it is clamped.
+constexpr int taper(int midgame, int endgame, int phase) noexcept {
+    const int p = std::min(phase, MAX_PHASE);
+    return (midgame * p + endgame * (MAX_PHASE - p)) / MAX_PHASE;
+}
+
+
+// Material and piece-square score of a position from white's point of view,
+// maintained incrementally as pieces are added and removed.
+struct PieceSquareScore {
+
+    int midgame;
+    int endgame;
+    int phase;
+
+    template <PieceColor COLOR>
+    static constexpr std::size_t table_index(std::uint64_t square) noexcept {
+        if constexpr (COLOR == PieceColor::WHITE) {
+            return static_cast<std::size_t>(square ^ 56);
+        } else {
+            return static_cast<std::size_t>(square);
+        }
+    }
+
+    template <PieceColor COLOR>
+    constexpr void add(PieceType type, std::uint64_t square) noexcept {
+        const auto t = static_cast<std::size_t>(type);
+        const std::size_t i = table_index<COLOR>(square);
+        if constexpr (COLOR == PieceColor::WHITE) {
+            midgame += MIDGAME_TABLE[t][i];
+            endgame += ENDGAME_TABLE[t][i];
+        } else {
+            midgame -= MIDGAME_TABLE[t][i];
+            endgame -= ENDGAME_TABLE[t][i];
+        }
+        phase += PHASE_WEIGHT[t];
+    }
+
+    template <PieceColor COLOR>
+    constexpr void remove(PieceType type, std::uint64_t square) noexcept {
+        const auto t = static_cast<std::size_t>(type);
+        const std::size_t i = table_index<COLOR>(square);
+        if constexpr (COLOR == PieceColor::WHITE) {
+            midgame -= MIDGAME_TABLE[t][i];
+            endgame -= ENDGAME_TABLE[t][i];
+        } else {
+            midgame += MIDGAME_TABLE[t][i];
+            endgame += ENDGAME_TABLE[t][i];
+        }
+        phase -= PHASE_WEIGHT[t];
+    }
+
+    constexpr int tapered() const noexcept {
+        return taper(midgame, endgame, phase);
+    }
+
+    constexpr bool operator==(const PieceSquareScore &) const noexcept
+        = default;
+
+}; // struct PieceSquareScore
+
+
+} // namespace DZChess
+
+#endif // DZCHESS_PIECE_SQUARE_TABLES_HPP_INCLUDED
@@ -0,0 +1,62 @@
+#ifndef DZCHESS_RANDOM_GAMES_HPP_INCLUDED
+#define DZCHESS_RANDOM_GAMES_HPP_INCLUDED
+
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::uint64_t
+#include <random>  // for std::mt19937_64
+#include <utility> // for std::pair
+#include <vector>  // for std::vector
+
+#include "ChessPiece.hpp"
+#include "ChessBoard.hpp"
+#include "MoveList.hpp"
+
+namespace DZChess {
+
+
+// Plays random games from the starting position and records every position
+// reached, so that consecutive positions differ by a single move, as they
+// mostly do between the leaves of a search.
+inline std::vector<std::pair<ChessBoard, PieceColor>>
+random_game_positions(std::size_t count, std::uint64_t seed) {
+    std::vector<std::pair<ChessBoard, PieceColor>> result{};
+    std::mt19937_64 rng{seed};
+    ChessBoard board{};
+    PieceColor color = PieceColor::WHITE;
+    while (result.size() < count) {
+        MoveList moves{};
+        if (color == PieceColor::WHITE) {
+            generate_moves<PieceColor::WHITE>(board, moves);
+        } else {
+            generate_moves<PieceColor::BLACK>(board, moves);
+        }
+        // Restart the game when it is over or when the next move could
+        // capture a king, so that every recorded position has both kings.
+        bool king_capture = moves.empty();
+        for (const ChessMove &move : moves) {
+            king_capture |= board.has_piece<PieceColor::WHITE,
+                                            PieceType::KING>(move.dst) ||
+                            board.has_piece<PieceColor::BLACK,
+                                            PieceType::KING>(move.dst);
+        }
+        if (king_capture) {
+            board = ChessBoard{};
+            color = PieceColor::WHITE;
+            continue;
+        }
+        const ChessMove move = moves[rng() % moves.size()];
+        if (color == PieceColor::WHITE) {
+            board = board.after_move<PieceColor::WHITE>(move);
+        } else {
+            board = board.after_move<PieceColor::BLACK>(move);
+        }
+        color = other(color);
+        result.emplace_back(board, color);
+    }
+    return result;
+}
+
+
+} // namespace DZChess
+
+#endif // DZCHESS_RANDOM_GAMES_HPP_INCLUDED
@@ -0,0 +1,794 @@
+#ifndef DZCHESS_SEARCH_HPP_INCLUDED
+#define DZCHESS_SEARCH_HPP_INCLUDED
+
+#include <algorithm>  // for std::max, std::min, std::swap, std::stable_sort
+#include <array>      // for std::array
+#include <atomic>     // for std::atomic
+#include <chrono>     // for std::chrono::steady_clock
+#include <cstddef>    // for std::size_t
+#include <cstdint>    // for std::uint64_t
+#include <cstdlib>    // for std::abs
+#include <functional> // for std::function
+#include <utility>    // for std::move
+#include <vector>     // for std::vector
+
+#include "ChessPiece.hpp"
+#include "ChessBoard.hpp"
+#include "MoveList.hpp"
+#include "AttackInfo.hpp"
+#include "EvaluationCache.hpp"
+#include "KPKBitbase.hpp"
+#include "TranspositionTable.hpp"
+#include "Tablebase.hpp"
+#include "Zobrist.hpp"
+
+namespace DZChess {
+
+
+// Scores are measured in centipawns. A side whose king has been captured
+// scores -(MATE_SCORE - ply), so that shorter mates are preferred.
+constexpr int MATE_SCORE = 1'000'000;
+constexpr int MATE_BOUND = MATE_SCORE - 1'000;
+constexpr int INFINITE_SCORE = MATE_SCORE + 1;
+constexpr int MAX_PLY = 64;
+
+// Added to the evaluation of positions known to be won, such as those in
+// the KPK bitbase, so that the search prefers them to any material edge.
+constexpr int KNOWN_WIN_SCORE = 10'000;
+
+
+// Each selectivity technique can be switched off individually so that its
+// effect on node counts and solve rates can be measured in isolation.
+struct SearchOptions {
+    bool null_move_pruning = true;
+    bool late_move_reductions = true;
+    bool futility_pruning = true;
+    bool razoring = true;
+    bool principal_variation_search = true;
+    bool aspiration_windows = true;
+    bool static_exchange_pruning = true;
+    bool evaluation_cache = true;
+    bool transposition_table = true;
+};
+
+
+// Bounds on a single call to search_root, beyond its maximum depth. When a
+// limit is reached the iteration in progress is abandoned, and the result
+// of the last completed iteration is returned.
+struct SearchLimits {
+    std::uint64_t nodes = 0; // including quiescence nodes; 0 for no limit
+    std::chrono::steady_clock::time_point deadline =
+        std::chrono::steady_clock::time_point::max();
+    const std::atomic<bool> *stop = nullptr; // set by another thread
+};
+
+
+struct SearchStatistics {
+    std::uint64_t nodes = 0;
+    std::uint64_t quiescence_nodes = 0;
+    std::uint64_t null_move_cutoffs = 0;
+    std::uint64_t late_move_reductions = 0;
+    std::uint64_t late_move_researches = 0;
+    std::uint64_t futility_prunes = 0;
+    std::uint64_t razoring_cutoffs = 0;
+    std::uint64_t principal_variation_researches = 0;
+    std::uint64_t aspiration_researches = 0;
+    std::uint64_t static_exchange_prunes = 0;
+    std::uint64_t evaluation_cache_probes = 0;
+    std::uint64_t evaluation_cache_hits = 0;
+    std::uint64_t transposition_probes = 0;
+    std::uint64_t transposition_hits = 0;
+    std::uint64_t transposition_cutoffs = 0;
+    std::uint64_t draws = 0; // by repetition or the fifty-move rule
+    std::uint64_t tablebase_hits = 0;
+    std::uint64_t bitbase_hits = 0;
+};
+
+
+struct SearchResult {
+    ChessMove best_move;
+    int score; // from white's point of view, like the leaf evaluators
+    int depth;
+    std::vector<ChessMove> principal_variation;
+};
+
+
+// Values used to order captures most-valuable-victim first. Capturing the
+// king ends the game, so it is always tried first.
+constexpr std::array<int, 6> ORDERING_VALUE = {
+    20'000, // KING
+       900, // QUEEN
+       500, // ROOK
+       300, // BISHOP
+       300, // KNIGHT
+       100, // PAWN
+};
+
+constexpr std::array<int, 3> FUTILITY_MARGIN = {0, 200, 500};
+constexpr std::array<int, 3> RAZORING_MARGIN = {0, 300, 550};
+constexpr int ASPIRATION_WINDOW = 50;
+
+// Halfmove clock at which the fifty-move rule makes the game a draw.
+constexpr int FIFTY_MOVE_LIMIT = 100;
+
+// Reading the clock at every node would be slower than the node itself.
+constexpr std::uint64_t DEADLINE_CHECK_INTERVAL = 1024;
+
+
+// Board hashes do not include the side to move, but search results and
+// repetitions depend on it.
+template <PieceColor COLOR>
+constexpr std::uint64_t position_key(const ChessBoard &board) noexcept {
+    if constexpr (COLOR == PieceColor::WHITE) {
+        return board.get_hash();
+    } else {
+        return board.get_hash() ^ ZOBRIST_KEYS.black_to_move;
+    }
+}
+
+constexpr std::uint64_t position_key(const ChessBoard &board,
+                                     PieceColor color) noexcept {
+    return (color == PieceColor::WHITE)
+        ? position_key<PieceColor::WHITE>(board)
+        : position_key<PieceColor::BLACK>(board);
+}
+
+
+// Search score of a tablebase value (see TABLEBASE_DRAW) for the side to
+// move at ply, counting mates from the root like the search does.
+constexpr int tablebase_score(std::uint8_t value, int ply) noexcept {
+    if (value < TABLEBASE_RESULT) { return 0; }
+    const int plies = ply + (value - TABLEBASE_RESULT);
+    return tablebase_win(value) ? MATE_SCORE - plies : -(MATE_SCORE - plies);
+}
+
+
+template <PieceColor COLOR>
+void generate_legal_moves(const ChessBoard &board, MoveList &list) noexcept {
+    const AttackInfo info{board};
+    MoveList candidates{};
+    generate_moves<COLOR>(board, candidates);
+    for (const ChessMove &move : candidates) {
+        if (info.is_legal<COLOR>(board, move)) { list.push_back(move); }
+    }
+}
+
+
+// Negamax alpha-beta search over the pseudo-legal move generator, skipping
+// moves that leave the king attacked. Leaves are scored by
+// Visitor<COLOR, 0>::visit, the same slot that ChessBoard::visit uses at
+// depth zero, so any leaf evaluator can be plugged in. Evaluators that also
+// accept the attack map of the position are given the one built for the
+// node, which is shared with legality checking and exchange evaluation.
+template <template <PieceColor, int> typename Visitor>
+class Searcher {
+
+    std::array<std::array<std::array<int, 64>, 64>, 2> history;
+
+    // Triangular principal variation table: row ply holds the best line
+    // found from that ply, in entries ply through pv_length[ply] - 1.
+    std::array<std::array<ChessMove, MAX_PLY + 1>, MAX_PLY + 1> pv_table;
+    std::array<int, MAX_PLY + 1> pv_length;
+
+    // Keys of the game history followed by those of the current search
+    // path, with the root at root_index, and the halfmove clock at each
+    // ply of the path.
+    std::vector<std::uint64_t> position_keys;
+    std::size_t root_index;
+    std::array<int, MAX_PLY + 1> halfmove_clocks;
+
+    std::uint64_t node_limit;
+    bool aborted;
+
+public:
+
+    SearchOptions options;
+    SearchLimits limits;
+    SearchStatistics statistics;
+
+    // Optional, and possibly shared with other searchers. Leaf evaluations
+    // in the main search and in quiescence are looked up here first.
+    EvaluationCache *evaluation_cache;
+
+    // Optional, and possibly shared with other searchers. Main search
+    // nodes store their result here, and reuse it for move ordering and,
+    // outside the principal variation, for cutoffs.
+    TranspositionTable *transposition_table;
+
+    // Optional, and possibly shared with other searchers. Main search
+    // nodes with few enough pieces take their exact score from here.
+    const Tablebases *tablebases;
+
+    // Keys (see position_key) of the positions played before the root,
+    // oldest first, and the halfmove clock of the root, for detecting
+    // draws by repetition and by the fifty-move rule.
+    std::vector<std::uint64_t> game_history;
+    int halfmove_clock;
+
+    explicit Searcher() noexcept :
+        history(), pv_table(), pv_length(), position_keys(), root_index(0),
+        halfmove_clocks(), node_limit(0), aborted(false), options(),
+        limits(), statistics(), evaluation_cache(nullptr),
+        transposition_table(nullptr), tablebases(nullptr), game_history(),
+        halfmove_clock(0) {}
+
+    // Whether the last call to search_root stopped at one of its limits.
+    constexpr bool was_aborted() const noexcept { return aborted; }
+
+private:
+
+    template <PieceColor COLOR>
+    static constexpr int relative(int score) noexcept {
+        if constexpr (COLOR == PieceColor::WHITE) {
+            return score;
+        } else {
+            return -score;
+        }
+    }
+
+    template <PieceColor COLOR>
+    static constexpr int evaluate(const ChessBoard &board) noexcept {
+        return relative<COLOR>(Visitor<COLOR, 0>::visit(board));
+    }
+
+    // Whether the position is a legal king and pawn versus king position,
+    // which the KPK bitbase decides. The bitbase only covers pawns on
+    // ranks 2-7.
+    template <PieceColor COLOR>
+    static constexpr bool is_kpk(const ChessBoard &board) noexcept {
+        using enum PieceColor;
+        using enum PieceType;
+        constexpr std::uint64_t BACK_RANKS = 0xFF000000000000FF;
+        const BitBoard pawns = board.get_piece<WHITE, PAWN>() |
+                               board.get_piece<BLACK, PAWN>();
+        return (board.get_all_pieces().popcount() == 3) &&
+               (board.piece_count<WHITE, KING>() == 1) &&
+               (board.piece_count<BLACK, KING>() == 1) &&
+               (pawns.popcount() == 1) &&
+               ((pawns.get_data() & BACK_RANKS) == 0) &&
+               !board.in_check<other(COLOR)>();
+    }
+
+    // Drawn KPK positions score exactly 0. Won ones keep the evaluation,
+    // which guides the pawn forward, shifted by KNOWN_WIN_SCORE.
+    template <PieceColor COLOR>
+    int evaluate_kpk(const ChessBoard &board) noexcept {
+        ++statistics.bitbase_hits;
+        if (!kpk_is_win<COLOR>(board)) { return 0; }
+        const int score = evaluate<COLOR>(board);
+        return (board.piece_count<COLOR, PieceType::PAWN>() == 1)
+            ? score + KNOWN_WIN_SCORE : score - KNOWN_WIN_SCORE;
+    }
+
+    template <PieceColor COLOR>
+    int evaluate(const ChessBoard &board, const AttackInfo &info) noexcept {
+        if (is_kpk<COLOR>(board)) { return evaluate_kpk<COLOR>(board); }
+        const bool cached = options.evaluation_cache &&
+                            (evaluation_cache != nullptr);
+        const std::uint64_t key = position_key<COLOR>(board);
+        int score = 0;
+        if (cached) {
+            ++statistics.evaluation_cache_probes;
+            if (evaluation_cache->probe(key, score)) {
+                ++statistics.evaluation_cache_hits;
+                return relative<COLOR>(score);
+            }
+        }
+        if constexpr (requires { Visitor<COLOR, 0>::visit(board, info); }) {
+            score = Visitor<COLOR, 0>::visit(board, info);
+        } else {
+            score = Visitor<COLOR, 0>::visit(board);
+        }
+        if (cached) { evaluation_cache->store(key, score); }
+        return relative<COLOR>(score);
+    }
+
+    template <PieceColor COLOR>
+    int &history_entry(const ChessMove &move) noexcept {
+        return history[static_cast<std::size_t>(COLOR)][move.src][move.dst];
+    }
+
+    static constexpr bool is_quiet(const ChessBoard &board,
+                                   const ChessMove &move) noexcept {
+        return !board.is_occupied(move.dst) &&
+               (move.src_type == move.dst_type);
+    }
+
+    template <PieceColor COLOR>
+    void score_moves(const ChessBoard &board, const MoveList &moves,
+                     std::array<int, MAX_MOVES> &scores) noexcept {
+        for (std::size_t i = 0; i < moves.size(); ++i) {
+            const ChessMove &move = moves[i];
+            if (board.is_occupied(move.dst)) {
+                const PieceType victim =
+                    board.piece_type_at<other(COLOR)>(move.dst);
+                scores[i] = 2'000'000
+                    + 16 * ORDERING_VALUE[static_cast<std::size_t>(victim)]
+                    - ORDERING_VALUE[static_cast<std::size_t>(move.src_type)]
+                      / 100;
+            } else if (move.src_type != move.dst_type) {
+                scores[i] = 1'000'000
+                    + ORDERING_VALUE[static_cast<std::size_t>(move.dst_type)];
+            } else {
+                scores[i] = history_entry<COLOR>(move);
+            }
+        }
+    }
+
+    void update_pv(int ply, const ChessMove &move) noexcept {
+        pv_table[ply][ply] = move;
+        for (int i = ply + 1; i < pv_length[ply + 1]; ++i) {
+            pv_table[ply][i] = pv_table[ply + 1][i];
+        }
+        pv_length[ply] = std::max(pv_length[ply + 1], ply + 1);
+    }
+
+    // Selection sort one step at a time: most nodes cut off after the first
+    // few moves, so fully sorting the list would be wasted work.
+    static ChessMove pick_move(MoveList &moves,
+                               std::array<int, MAX_MOVES> &scores,
+                               std::size_t index) noexcept {
+        std::size_t best = index;
+        for (std::size_t i = index + 1; i < moves.size(); ++i) {
+            if (scores[i] > scores[best]) { best = i; }
+        }
+        std::swap(moves[index], moves[best]);
+        std::swap(scores[index], scores[best]);
+        return moves[index];
+    }
+
+    // Called once per node. Once a limit is hit, every node returns at
+    // once, and the scores they return are discarded by search_root.
+    bool out_of_budget() noexcept {
+        if (aborted) { return true; }
+        const std::uint64_t total =
+            statistics.nodes + statistics.quiescence_nodes;
+        aborted = (total >= node_limit) ||
+            ((total % DEADLINE_CHECK_INTERVAL == 0) &&
+             (((limits.stop != nullptr) &&
+               limits.stop->load(std::memory_order_relaxed)) ||
+              (std::chrono::steady_clock::now() >= limits.deadline)));
+        return aborted;
+    }
+
+    // Sets the halfmove clock of the child reached by a move. Captures and
+    // pawn moves reset it: positions before them can never recur.
+    void enter_child(const ChessBoard &board, const ChessMove &move,
+                     int ply) noexcept {
+        halfmove_clocks[ply + 1] = (board.is_occupied(move.dst) ||
+                                    (move.src_type == PieceType::PAWN))
+            ? 0 : halfmove_clocks[ply] + 1;
+    }
+
+    // Records the position on the search path and reports whether it is a
+    // draw: by the fifty-move rule unless the side to move has been
+    // checkmated, by a repetition of any earlier position on the search
+    // path, or by a third occurrence counting the game history. Only
+    // positions since the last irreversible move with the same side to
+    // move are compared, and a position cannot recur within fewer than
+    // four plies.
+    template <PieceColor COLOR>
+    bool is_draw(const ChessBoard &board, int ply) noexcept {
+        const std::size_t index = root_index + static_cast<std::size_t>(ply);
+        const std::uint64_t key = position_key<COLOR>(board);
+        position_keys[index] = key;
+        const int clock = halfmove_clocks[ply];
+        if (clock >= FIFTY_MOVE_LIMIT) {
+            // Checkmate on the last move counts before the fifty-move rule.
+            if (!board.in_check<COLOR>()) { return true; }
+            MoveList moves{};
+            generate_legal_moves<COLOR>(board, moves);
+            return !moves.empty();
+        }
+        int repetitions = 0;
+        for (std::size_t back = 4; (back <= static_cast<std::size_t>(clock))
+                                   && (back <= index); back += 2) {
+            if ((position_keys[index - back] == key) &&
+                ((index - back >= root_index) || (++repetitions == 2))) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Mate scores are stored relative to the node rather than the root, so
+    // that they stay correct when the position is reached at another ply.
+    static constexpr int score_to_table(int score, int ply) noexcept {
+        if (score >= MATE_BOUND) { return score + ply; }
+        if (score <= -MATE_BOUND) { return score - ply; }
+        return score;
+    }
+
+    static constexpr int score_from_table(int score, int ply) noexcept {
+        if (score >= MATE_BOUND) { return score - ply; }
+        if (score <= -MATE_BOUND) { return score + ply; }
+        return score;
+    }
+
+    static constexpr bool same_move(const ChessMove &a,
+                                    const ChessMove &b) noexcept {
+        return (a.src == b.src) && (a.dst == b.dst) &&
+               (a.src_type == b.src_type) && (a.dst_type == b.dst_type);
+    }
+
+    // Principal variation search: once a first move has been searched with
+    // the full window, the others only need to be proven worse, which a
+    // null window does cheaply. Only those that unexpectedly land inside
+    // the window are searched again with the full window.
+    template <PieceColor COLOR>
+    int search_child(const ChessBoard &next, int depth, int alpha, int beta,
+                     int ply, bool first_move) {
+        if (first_move || !options.principal_variation_search) {
+            return -search<other(COLOR)>(
+                next, depth, -beta, -alpha, ply + 1, true
+            );
+        }
+        int score = -search<other(COLOR)>(
+            next, depth, -alpha - 1, -alpha, ply + 1, true
+        );
+        if ((score > alpha) && (score < beta)) {
+            ++statistics.principal_variation_researches;
+            score = -search<other(COLOR)>(
+                next, depth, -beta, -alpha, ply + 1, true
+            );
+        }
+        return score;
+    }
+
+public:
+
+    template <PieceColor COLOR>
+    int quiescence(const ChessBoard &board, int alpha, int beta, int ply) {
+        pv_length[ply] = ply;
+        if (board.piece_count<COLOR, PieceType::KING>() == 0) {
+            return -(MATE_SCORE - ply);
+        }
+        ++statistics.quiescence_nodes;
+        if (out_of_budget()) { return 0; }
+        const AttackInfo info{board};
+        const int stand_pat = evaluate<COLOR>(board, info);
+        if ((stand_pat >= beta) || (ply >= MAX_PLY)) { return stand_pat; }
+        alpha = std::max(alpha, stand_pat);
+
+        MoveList moves{};
+        generate_moves<COLOR>(board, moves, board.get_pieces<other(COLOR)>());
+        std::array<int, MAX_MOVES> scores;
+        score_moves<COLOR>(board, moves, scores);
+
+        int best_score = stand_pat;
+        for (std::size_t i = 0; i < moves.size(); ++i) {
+            const ChessMove move = pick_move(moves, scores, i);
+            if (!info.is_legal<COLOR>(board, move)) { continue; }
+            // Captures that lose material once all recaptures on the
+            // square are played out cannot raise the stand-pat score.
+            if (options.static_exchange_pruning &&
+                (move.src_type == move.dst_type) &&
+                (static_exchange_evaluation<COLOR>(board, info, move) < 0)) {
+                ++statistics.static_exchange_prunes;
+                continue;
+            }
+            const int score = -quiescence<other(COLOR)>(
+                board.after_move<COLOR>(move), -beta, -alpha, ply + 1
+            );
+            if (score > best_score) {
+                best_score = score;
+                if (score > alpha) {
+                    alpha = score;
+                    update_pv(ply, move);
+                    if (alpha >= beta) { break; }
+                }
+            }
+        }
+        return best_score;
+    }
+
+    template <PieceColor COLOR>
+    int search(const ChessBoard &board, int depth,
+               int alpha, int beta, int ply, bool null_move_allowed) {
+        pv_length[ply] = ply;
+        if (board.piece_count<COLOR, PieceType::KING>() == 0) {
+            return -(MATE_SCORE - ply);
+        }
+        if (is_draw<COLOR>(board, ply)) {
+            ++statistics.draws;
+            return 0;
+        }
+        if ((tablebases != nullptr) &&
+            (board.get_all_pieces().popcount() <= tablebases->max_pieces())) {
+            if (const auto value = tablebases->probe<COLOR>(board)) {
+                ++statistics.tablebase_hits;
+                return tablebase_score(*value, ply);
+            }
+        }
+        if (is_kpk<COLOR>(board) && !kpk_is_win<COLOR>(board)) {
+            ++statistics.bitbase_hits;
+            return 0;
+        }
+        if ((depth <= 0) || (ply >= MAX_PLY)) {
+            return quiescence<COLOR>(board, alpha, beta, ply);
+        }
+        ++statistics.nodes;
+        if (out_of_budget()) { return 0; }
+
+        const bool use_table = options.transposition_table &&
+                               (transposition_table != nullptr);
+        const std::uint64_t key = position_key<COLOR>(board);
+        TranspositionEntry entry{};
+        bool table_hit = false;
+        if (use_table) {
+            ++statistics.transposition_probes;
+            table_hit = transposition_table->probe(key, entry);
+        }
+        if (table_hit) {
+            ++statistics.transposition_hits;
+            // Cutting off inside the principal variation would truncate
+            // it, so exact windows always search.
+            const int score = score_from_table(entry.score, ply);
+            if ((entry.depth >= depth) && (beta - alpha == 1) &&
+                ((entry.bound == Bound::EXACT) ||
+                 ((entry.bound == Bound::LOWER) && (score >= beta)) ||
+                 ((entry.bound == Bound::UPPER) && (score <= alpha)))) {
+                ++statistics.transposition_cutoffs;
+                return score;
+            }
+        }
+        const int original_alpha = alpha;
+
+        const AttackInfo info{board};
+        const bool in_check = info.in_check<COLOR>();
+        const int static_eval = evaluate<COLOR>(board, info);
+
+        // Razoring: a frontier node far below alpha is unlikely to recover
+        // through a quiet move, so verify with a capture search and drop it.
+        if (options.razoring && !in_check && (depth <= 2) &&
+            (static_eval + RAZORING_MARGIN[depth] <= alpha)) {
+            const int score = quiescence<COLOR>(board, alpha, beta, ply);
+            if (score <= alpha) {
+                ++statistics.razoring_cutoffs;
+                return score;
+            }
+        }
+
+        // Null-move pruning: if passing still fails high, so will the real
+        // moves. Positions with only king and pawns are skipped because
+        // zugzwang is common there and passing would be an illegal advantage.
+        if (options.null_move_pruning && null_move_allowed && !in_check &&
+            (depth >= 3) && (static_eval >= beta) &&
+            board.has_non_pawn_material<COLOR>()) {
+            const int reduction = 2 + depth / 4;
+            halfmove_clocks[ply + 1] = 0;
+            const int score = -search<other(COLOR)>(
+                board, depth - 1 - reduction, -beta, -beta + 1, ply + 1, false
+            );
+            if (score >= beta) {
+                ++statistics.null_move_cutoffs;
+                return (score >= MATE_BOUND) ? beta : score;
+            }
+        }
+
+        MoveList moves{};
+        generate_moves<COLOR>(board, moves);
+        std::array<int, MAX_MOVES> scores;
+        score_moves<COLOR>(board, moves, scores);
+        if (table_hit && entry.has_move) {
+            for (std::size_t i = 0; i < moves.size(); ++i) {
+                if (same_move(moves[i], entry.move)) {
+                    scores[i] = 3'000'000;
+                    break;
+                }
+            }
+        }
+
+        const bool futile = options.futility_pruning && !in_check &&
+            (depth < static_cast<int>(FUTILITY_MARGIN.size())) &&
+            (static_eval + FUTILITY_MARGIN[depth] <= alpha);
+
+        int best_score = -INFINITE_SCORE;
+        ChessMove best_move{};
+        int searched = 0;
+        for (std::size_t i = 0; i < moves.size(); ++i) {
+            const ChessMove move = pick_move(moves, scores, i);
+            if (!info.is_legal<COLOR>(board, move)) { continue; }
+            const bool quiet = is_quiet(board, move);
+
+            // Futility pruning: at frontier nodes, quiet moves cannot raise
+            // a static evaluation this far below alpha.
+            if (futile && quiet && (searched > 0)) {
+                ++statistics.futility_prunes;
+                continue;
+            }
+
+            const ChessBoard next = board.after_move<COLOR>(move);
+            enter_child(board, move, ply);
+            int score = -INFINITE_SCORE;
+            bool full_depth = true;
+            if (options.late_move_reductions && quiet && !in_check &&
+                (depth >= 3) && (searched >= 3)) {
+                // Late move reductions: quiet moves ordered late are rarely
+                // best. Reduce more the later they come, less when they have
+                // a good history of causing cutoffs elsewhere in the tree.
+                int reduction = (searched >= 6) ? 2 : 1;
+                if (history_entry<COLOR>(move) > depth * depth) {
+                    --reduction;
+                }
+                reduction = std::min(reduction, depth - 2);
+                if (reduction > 0) {
+                    ++statistics.late_move_reductions;
+                    score = -search<other(COLOR)>(
+                        next, depth - 1 - reduction,
+                        -alpha - 1, -alpha, ply + 1, true
+                    );
+                    full_depth = (score > alpha);
+                    if (full_depth) { ++statistics.late_move_researches; }
+                }
+            }
+            if (full_depth) {
+                score = search_child<COLOR>(next, depth - 1, alpha, beta,
+                                            ply, searched == 0);
+            }
+            ++searched;
+
+            if (score > best_score) {
+                best_score = score;
+                best_move = move;
+                if (score > alpha) {
+                    alpha = score;
+                    update_pv(ply, move);
+                    if (alpha >= beta) {
+                        if (quiet) {
+                            history_entry<COLOR>(move) += depth * depth;
+                        }
+                        break;
+                    }
+                }
+            }
+        }
+
+        // Without legal moves, the side to move is checkmated or stalemated.
+        if (searched == 0) { return in_check ? -(MATE_SCORE - ply) : 0; }
+        if (use_table && !aborted) {
+            const Bound bound = (best_score >= beta) ? Bound::LOWER
+                : (best_score > original_alpha) ? Bound::EXACT
+                : Bound::UPPER;
+            transposition_table->store(key, {
+                best_move, score_to_table(best_score, ply),
+                depth, bound, true
+            });
+        }
+        return best_score;
+    }
+
+    // Searches the root moves from index first onwards within the given
+    // window, moving the best of them to that index; earlier moves are
+    // excluded. Returns a fail-soft score, which is an upper bound when no
+    // move reaches alpha and a lower bound at beta.
+    template <PieceColor COLOR>
+    int search_root_moves(const ChessBoard &board, MoveList &moves,
+                          std::size_t first, int depth, int alpha, int beta) {
+        pv_length[0] = 0;
+        int best_score = -INFINITE_SCORE;
+        std::size_t best_index = first;
+        for (std::size_t i = first; i < moves.size(); ++i) {
+            enter_child(board, moves[i], 0);
+            const int score = search_child<COLOR>(
+                board.after_move<COLOR>(moves[i]), depth - 1,
+                alpha, beta, 0, i == first
+            );
+            best_score = std::max(best_score, score);
+            if (score > alpha) {
+                alpha = score;
+                best_index = i;
+                update_pv(0, moves[i]);
+                if (alpha >= beta) { break; }
+            }
+        }
+        std::swap(moves[first], moves[best_index]);
+        return best_score;
+    }
+
+    // Iterative deepening over the root moves, finding the best line_count
+    // lines (MultiPV). Each iteration searches the root once per line,
+    // excluding the moves of the lines already found, so later lines are
+    // only proven against the best remaining move and cost far less than
+    // a search of their own. Each line is searched inside an aspiration
+    // window around its previous score that is widened whenever the result
+    // falls outside it, and the best moves of each iteration are searched
+    // first in the next one. The report callback receives the lines of
+    // each completed iteration, best first.
+    template <PieceColor COLOR>
+    std::vector<SearchResult> search_lines(
+        const ChessBoard &board, int max_depth, std::size_t line_count,
+        const std::function<void(const std::vector<SearchResult> &)> &report
+            = {}
+    ) {
+        history = {};
+        aborted = false;
+        root_index = game_history.size();
+        position_keys = game_history;
+        position_keys.resize(root_index + MAX_PLY + 1);
+        position_keys[root_index] = position_key<COLOR>(board);
+        halfmove_clocks[0] = halfmove_clock;
+        node_limit = (limits.nodes == 0) ? UINT64_MAX :
+            statistics.nodes + statistics.quiescence_nodes + limits.nodes;
+        MoveList moves{};
+        generate_legal_moves<COLOR>(board, moves);
+        // Without a legal move the game is over, and the single line has no
+        // move and scores the checkmate or stalemate.
+        if (moves.empty()) {
+            const int score = board.in_check<COLOR>() ? -MATE_SCORE : 0;
+            return {{{}, relative<COLOR>(score), 0, {}}};
+        }
+        const int static_score = relative<COLOR>(evaluate<COLOR>(board));
+        line_count = std::min(std::max(line_count, std::size_t{1}),
+                              moves.size());
+        std::vector<SearchResult> lines{};
+        for (std::size_t i = 0; i < line_count; ++i) {
+            lines.push_back({moves[i], static_score, 0, {}});
+        }
+
+        for (int depth = 1; depth <= max_depth; ++depth) {
+            std::vector<SearchResult> next{};
+            for (std::size_t line = 0; line < line_count; ++line) {
+                const int previous_score = relative<COLOR>(lines[line].score);
+                int delta = ASPIRATION_WINDOW;
+                int alpha = -INFINITE_SCORE;
+                int beta = +INFINITE_SCORE;
+                if (options.aspiration_windows && (depth >= 4) &&
+                    (std::abs(previous_score) < MATE_BOUND)) {
+                    alpha = previous_score - delta;
+                    beta = previous_score + delta;
+                }
+                int score = 0;
+                while (true) {
+                    score = search_root_moves<COLOR>(
+                        board, moves, line, depth, alpha, beta);
+                    if (aborted) { return lines; }
+                    if ((score <= alpha) && (alpha > -INFINITE_SCORE)) {
+                        alpha = std::max(score - delta, -INFINITE_SCORE);
+                    } else if ((score >= beta) && (beta < INFINITE_SCORE)) {
+                        beta = std::min(score + delta, +INFINITE_SCORE);
+                    } else {
+                        break;
+                    }
+                    ++statistics.aspiration_researches;
+                    delta *= 2;
+                }
+                next.push_back({
+                    moves[line], relative<COLOR>(score), depth,
+                    {pv_table[0].begin(), pv_table[0].begin() + pv_length[0]}
+                });
+            }
+            // Pruning can let a later line score above an earlier one.
+            std::stable_sort(next.begin(), next.end(),
+                [](const SearchResult &a, const SearchResult &b) {
+                    return relative<COLOR>(a.score) > relative<COLOR>(b.score);
+                }
+            );
+            for (std::size_t line = 0; line < line_count; ++line) {
+                moves[line] = next[line].best_move;
+            }
+            lines = std::move(next);
+            if (report) { report(lines); }
+        }
+        return lines;
+    }
+
+    // The single best line, as search_lines with one line.
+    template <PieceColor COLOR>
+    SearchResult search_root(
+        const ChessBoard &board, int max_depth,
+        const std::function<void(const SearchResult &)> &report = {}
+    ) {
+        return search_lines<COLOR>(board, max_depth, 1,
+            [&report](const std::vector<SearchResult> &lines) {
+                if (report) { report(lines[0]); }
+            }
+        ).front();
+    }
+
+}; // class Searcher
+
+
+} // namespace DZChess
+
+#endif // DZCHESS_SEARCH_HPP_INCLUDED
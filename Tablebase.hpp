@@ -0,0 +1,508 @@
+#ifndef DZCHESS_TABLEBASE_HPP_INCLUDED
+#define DZCHESS_TABLEBASE_HPP_INCLUDED
+
+#include <algorithm>     // for std::max, std::swap
+#include <array>         // for std::array
+#include <cstddef>       // for std::size_t
+#include <cstdint>       // for std::uint8_t, std::uint32_t, std::uint64_t
+#include <cstring>       // for std::memcmp, std::memcpy
+#include <filesystem>    // for std::filesystem::directory_iterator
+#include <fstream>       // for std::ofstream
+#include <memory>        // for std::unique_ptr, std::make_unique
+#include <optional>      // for std::optional
+#include <string>        // for std::string
+#include <string_view>   // for std::string_view
+#include <unordered_map> // for std::unordered_map
+#include <utility>       // for std::move
+#include <vector>        // for std::vector
+
+#include <fcntl.h>    // for open, O_RDONLY
+#include <sys/mman.h> // for mmap, munmap
+#include <sys/stat.h> // for fstat
+#include <unistd.h>   // for close
+
+#include "ChessPiece.hpp"
+#include "BitBoard.hpp"
+#include "ChessBoard.hpp"
+
+namespace DZChess {
+
+
+// Piece counts of a position, indexed like the bitboards passed to the
+// ChessBoard constructor: white K, Q, R, B, N, P, then black k, ... p.
+using Material = std::array<int, 12>;
+
+// Packs piece counts of up to 15 into a hash key.
+constexpr std::uint64_t material_key(const Material &material) noexcept {
+    std::uint64_t key = 0;
+    for (std::size_t i = 0; i < 12; ++i) {
+        key |= static_cast<std::uint64_t>(material[i]) << (4 * i);
+    }
+    return key;
+}
+
+// The same material with the colors swapped.
+constexpr Material flipped(const Material &material) noexcept {
+    Material result{};
+    for (std::size_t i = 0; i < 6; ++i) {
+        result[i] = material[i + 6];
+        result[i + 6] = material[i];
+    }
+    return result;
+}
+
+inline std::array<BitBoard, 12> piece_bitboards(const ChessBoard &board) {
+    using enum PieceColor;
+    using enum PieceType;
+    return {
+        board.get_piece<WHITE, KING  >(), board.get_piece<WHITE, QUEEN >(),
+        board.get_piece<WHITE, ROOK  >(), board.get_piece<WHITE, BISHOP>(),
+        board.get_piece<WHITE, KNIGHT>(), board.get_piece<WHITE, PAWN  >(),
+        board.get_piece<BLACK, KING  >(), board.get_piece<BLACK, QUEEN >(),
+        board.get_piece<BLACK, ROOK  >(), board.get_piece<BLACK, BISHOP>(),
+        board.get_piece<BLACK, KNIGHT>(), board.get_piece<BLACK, PAWN  >(),
+    };
+}
+
+inline Material board_material(const ChessBoard &board) {
+    const std::array<BitBoard, 12> pieces = piece_bitboards(board);
+    Material result{};
+    for (std::size_t i = 0; i < 12; ++i) { result[i] = pieces[i].popcount(); }
+    return result;
+}
+
+// Names like KQKR: white's pieces, then black's, strongest first.
+inline std::string material_name(const Material &material) {
+    constexpr char NAMES[6] = {'K', 'Q', 'R', 'B', 'N', 'P'};
+    std::string result{};
+    for (std::size_t i = 0; i < 12; ++i) {
+        result.append(static_cast<std::size_t>(material[i]), NAMES[i % 6]);
+    }
+    return result;
+}
+
+inline std::optional<Material> parse_material(const std::string &name) {
+    constexpr std::string_view NAMES = "KQRBNP";
+    Material result{};
+    std::size_t side = 0;
+    for (std::size_t i = 0; i < name.size(); ++i) {
+        const std::size_t type = NAMES.find(name[i]);
+        if (type == std::string_view::npos) { return std::nullopt; }
+        if ((type == 0) && (i > 0)) { ++side; }
+        if ((side > 1) || ((i == 0) && (type != 0))) { return std::nullopt; }
+        ++result[6 * side + type];
+    }
+    if ((result[0] != 1) || (result[6] != 1)) { return std::nullopt; }
+    return result;
+}
+
+
+// Maps positions with a given material to dense indices. The king pair
+// is reduced by the symmetries of the board (the eight rotations and
+// reflections without pawns, the left-right mirror with them) to one of
+// 462 or 1806 canonical pairs, whose transformation is applied to the
+// other pieces. Each other piece then contributes its square, with pawns
+// limited to the 48 squares of ranks 2 through 7. Pieces may overlap in
+// the index space; such indices do not decode to a position.
+class TablebaseIndex {
+
+    struct KingPairs {
+        std::array<std::int16_t, 64 * 64> index;
+        std::array<std::uint8_t, 64 * 64> transform;
+        std::vector<std::array<std::uint8_t, 2>> squares;
+    };
+
+    static constexpr std::uint64_t transform_square(std::uint64_t square,
+                                                    unsigned t) noexcept {
+        std::uint64_t file = square & 7;
+        std::uint64_t rank = square >> 3;
+        if (t & 1) { file = 7 - file; }
+        if (t & 2) { rank = 7 - rank; }
+        if (t & 4) { std::swap(file, rank); }
+        return 8 * rank + file;
+    }
+
+    static KingPairs make_king_pairs(unsigned symmetries) {
+        KingPairs result{};
+        result.index.fill(-1);
+        for (std::uint64_t wk = 0; wk < 64; ++wk) {
+            for (std::uint64_t bk = 0; bk < 64; ++bk) {
+                const std::uint64_t file_distance =
+                    (wk & 7) > (bk & 7) ? (wk & 7) - (bk & 7)
+                                        : (bk & 7) - (wk & 7);
+                const std::uint64_t rank_distance =
+                    (wk >> 3) > (bk >> 3) ? (wk >> 3) - (bk >> 3)
+                                          : (bk >> 3) - (wk >> 3);
+                if (std::max(file_distance, rank_distance) <= 1) { continue; }
+                std::uint64_t best = 64 * 64;
+                unsigned best_transform = 0;
+                for (unsigned t = 0; t < symmetries; ++t) {
+                    const std::uint64_t pair =
+                        64 * transform_square(wk, t) + transform_square(bk, t);
+                    if (pair < best) {
+                        best = pair;
+                        best_transform = t;
+                    }
+                }
+                if (best == 64 * wk + bk) {
+                    result.index[best] =
+                        static_cast<std::int16_t>(result.squares.size());
+                    result.squares.push_back({static_cast<std::uint8_t>(wk),
+                                              static_cast<std::uint8_t>(bk)});
+                }
+                result.transform[64 * wk + bk] =
+                    static_cast<std::uint8_t>(best_transform);
+            }
+        }
+        // Now that the canonical pairs are numbered, every other pair can
+        // look up the index of its canonical form.
+        for (std::size_t pair = 0; pair < 64 * 64; ++pair) {
+            if (result.index[pair] >= 0) { continue; }
+            const std::uint64_t wk = pair / 64;
+            const std::uint64_t bk = pair % 64;
+            const unsigned t = result.transform[pair];
+            const std::size_t canonical =
+                64 * transform_square(wk, t) + transform_square(bk, t);
+            if (canonical != pair) {
+                result.index[pair] = result.index[canonical];
+            }
+        }
+        return result;
+    }
+
+    static const KingPairs &king_pairs(bool pawns) {
+        static const KingPairs without_pawns = make_king_pairs(8);
+        static const KingPairs with_pawns = make_king_pairs(2);
+        return pawns ? with_pawns : without_pawns;
+    }
+
+    Material material;
+    std::vector<std::size_t> pieces; // material index of each other piece
+    const KingPairs *pairs;
+    std::uint64_t piece_combinations;
+
+public:
+
+    explicit TablebaseIndex(const Material &material) :
+        material(material), pieces(), pairs(nullptr), piece_combinations(1) {
+        const bool pawns = (material[5] > 0) || (material[11] > 0);
+        pairs = &king_pairs(pawns);
+        for (std::size_t i = 0; i < 12; ++i) {
+            if ((i == 0) || (i == 6)) { continue; }
+            for (int n = 0; n < material[i]; ++n) {
+                pieces.push_back(i);
+                piece_combinations *= ((i % 6) == 5) ? 48 : 64;
+            }
+        }
+    }
+
+    const Material &get_material() const noexcept { return material; }
+
+    std::size_t piece_count() const noexcept { return pieces.size() + 2; }
+
+    std::uint64_t size() const noexcept {
+        return pairs->squares.size() * piece_combinations;
+    }
+
+    // Index of a position with this material and two kings that are not
+    // adjacent.
+    std::uint64_t index(const ChessBoard &board) const {
+        const std::array<BitBoard, 12> bitboards = piece_bitboards(board);
+        const std::size_t pair = 64 * *bitboards[0].begin() +
+                                 *bitboards[6].begin();
+        const unsigned t = pairs->transform[pair];
+        std::uint64_t result = static_cast<std::uint64_t>(pairs->index[pair]);
+        std::size_t i = 0;
+        while (i < pieces.size()) {
+            for (const std::uint64_t square : bitboards[pieces[i]]) {
+                const std::uint64_t s = transform_square(square, t);
+                if ((pieces[i] % 6) == 5) {
+                    result = 48 * result + (s - 8);
+                } else {
+                    result = 64 * result + s;
+                }
+                ++i;
+            }
+        }
+        return result;
+    }
+
+    // Position at an index, or nothing if two pieces share a square.
+    std::optional<ChessBoard> decode(std::uint64_t index) const {
+        std::array<std::uint64_t, 12> bitboards{};
+        std::uint64_t occupied = 0;
+        for (std::size_t i = pieces.size(); i-- > 0;) {
+            const bool pawn = (pieces[i] % 6) == 5;
+            const std::uint64_t radix = pawn ? 48 : 64;
+            const std::uint64_t square = (index % radix) + (pawn ? 8 : 0);
+            index /= radix;
+            const std::uint64_t bit = UINT64_C(1) << square;
+            if (occupied & bit) { return std::nullopt; }
+            occupied |= bit;
+            bitboards[pieces[i]] |= bit;
+        }
+        const auto &[wk, bk] = pairs->squares[index];
+        const std::uint64_t kings =
+            (UINT64_C(1) << wk) | (UINT64_C(1) << bk);
+        if (occupied & kings) { return std::nullopt; }
+        bitboards[0] = UINT64_C(1) << wk;
+        bitboards[6] = UINT64_C(1) << bk;
+        return ChessBoard{
+            bitboards[0], bitboards[1], bitboards[2],
+            bitboards[3], bitboards[4], bitboards[5],
+            bitboards[6], bitboards[7], bitboards[8],
+            bitboards[9], bitboards[10], bitboards[11]
+        };
+    }
+
+}; // class TablebaseIndex
+
+
+// Read-only memory map of a whole file.
+class MappedFile {
+
+    const std::uint8_t *data;
+    std::size_t size;
+
+public:
+
+    explicit MappedFile(const std::string &path) noexcept :
+        data(nullptr), size(0) {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) { return; }
+        struct stat info{};
+        if ((::fstat(fd, &info) == 0) && (info.st_size > 0)) {
+            void *map = ::mmap(nullptr, static_cast<std::size_t>(info.st_size),
+                               PROT_READ, MAP_SHARED, fd, 0);
+            if (map != MAP_FAILED) {
+                data = static_cast<const std::uint8_t *>(map);
+                size = static_cast<std::size_t>(info.st_size);
+            }
+        }
+        ::close(fd);
+    }
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    ~MappedFile() {
+        if (data != nullptr) {
+            ::munmap(const_cast<std::uint8_t *>(data), size);
+        }
+    }
+
+    const std::uint8_t *get_data() const noexcept { return data; }
+
+    std::size_t get_size() const noexcept { return size; }
+
+}; // class MappedFile
+
+
+// Values stored for each position, from the point of view of the side to
+// move: 0 for a draw, 1 for an index that is not a legal position, and
+// 2 + n for a result n plies from now, a win for odd n (mating on the
+// n-th ply) and a loss for even n (being mated on it).
+constexpr std::uint8_t TABLEBASE_DRAW = 0;
+constexpr std::uint8_t TABLEBASE_INVALID = 1;
+constexpr std::uint8_t TABLEBASE_RESULT = 2;
+constexpr int TABLEBASE_MAX_PLIES = 255 - TABLEBASE_RESULT;
+
+constexpr bool tablebase_win(std::uint8_t value) noexcept {
+    return (value >= TABLEBASE_RESULT) && ((value - TABLEBASE_RESULT) & 1);
+}
+
+constexpr bool tablebase_loss(std::uint8_t value) noexcept {
+    return (value >= TABLEBASE_RESULT) &&
+           !((value - TABLEBASE_RESULT) & 1);
+}
+
+
+// File layout: this header, then one byte per index with white to move,
+// then one byte per index with black to move.
+struct TablebaseHeader {
+    char magic[4];
+    std::uint32_t version;
+    std::uint8_t material[12];
+    std::uint32_t reserved;
+    std::uint64_t size; // indices per side to move
+};
+
+constexpr char TABLEBASE_MAGIC[4] = {'D', 'Z', 'T', 'B'};
+constexpr std::uint32_t TABLEBASE_VERSION = 1;
+constexpr const char *TABLEBASE_EXTENSION = ".dztb";
+
+
+// Distance-to-mate table for one material, held in memory while it is
+// generated or mapped from its file.
+class Tablebase {
+
+    TablebaseIndex indexer;
+    std::vector<std::uint8_t> storage;
+    std::unique_ptr<MappedFile> file;
+    const std::uint8_t *values;
+
+public:
+
+    // An empty table to be filled by a generator, with every value a draw.
+    explicit Tablebase(const Material &material) :
+        indexer(material), storage(2 * indexer.size(), TABLEBASE_DRAW),
+        file(), values(storage.data()) {}
+
+    // Maps a table file, returning nothing if it cannot be read or is not
+    // a table.
+    static std::unique_ptr<Tablebase> load(const std::string &path) {
+        auto file = std::make_unique<MappedFile>(path);
+        TablebaseHeader header{};
+        if (file->get_size() < sizeof(header)) { return nullptr; }
+        std::memcpy(&header, file->get_data(), sizeof(header));
+        if ((std::memcmp(header.magic, TABLEBASE_MAGIC, 4) != 0) ||
+            (header.version != TABLEBASE_VERSION)) {
+            return nullptr;
+        }
+        Material material{};
+        for (std::size_t i = 0; i < 12; ++i) {
+            material[i] = header.material[i];
+        }
+        if ((material[0] != 1) || (material[6] != 1)) { return nullptr; }
+        auto result = std::unique_ptr<Tablebase>(new Tablebase(material, 0));
+        if ((header.size != result->indexer.size()) ||
+            (file->get_size() != sizeof(header) + 2 * header.size)) {
+            return nullptr;
+        }
+        result->values = file->get_data() + sizeof(header);
+        result->file = std::move(file);
+        return result;
+    }
+
+    bool save(const std::string &path) const {
+        TablebaseHeader header{};
+        std::memcpy(header.magic, TABLEBASE_MAGIC, 4);
+        header.version = TABLEBASE_VERSION;
+        for (std::size_t i = 0; i < 12; ++i) {
+            header.material[i] =
+                static_cast<std::uint8_t>(indexer.get_material()[i]);
+        }
+        header.size = indexer.size();
+        std::ofstream out{path, std::ios::binary};
+        out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char *>(values),
+                  static_cast<std::streamsize>(2 * header.size));
+        return static_cast<bool>(out);
+    }
+
+    const TablebaseIndex &index() const noexcept { return indexer; }
+
+    std::string name() const { return material_name(indexer.get_material()); }
+
+    bool is_mapped() const noexcept { return file != nullptr; }
+
+    std::uint8_t get(PieceColor side, std::uint64_t index) const noexcept {
+        return values[static_cast<std::size_t>(side) * indexer.size() + index];
+    }
+
+    // Values of a table being generated; empty for a mapped table.
+    std::uint8_t *mutable_values(PieceColor side) noexcept {
+        if (storage.empty()) { return nullptr; }
+        return storage.data() + static_cast<std::size_t>(side) * indexer.size();
+    }
+
+private:
+
+    // A table whose values will be mapped from a file.
+    explicit Tablebase(const Material &material, int) :
+        indexer(material), storage(), file(), values(nullptr) {}
+
+}; // class Tablebase
+
+
+// Tables by material, probed for either color: a position whose material
+// has no table is looked up with the colors swapped, as the mirrored
+// position with the other side to move. Positions with two bare kings are
+// drawn without a table.
+class Tablebases {
+
+    std::unordered_map<std::uint64_t, std::unique_ptr<Tablebase>> tables;
+    int largest;
+
+public:
+
+    explicit Tablebases() : tables(), largest(0) {}
+
+    // Pieces, including kings, in the largest table, or 0 if there is
+    // none. Positions with more pieces need not be probed.
+    int max_pieces() const noexcept { return largest; }
+
+    std::size_t size() const noexcept { return tables.size(); }
+
+    void add(std::unique_ptr<Tablebase> table) {
+        largest = std::max(largest,
+                           static_cast<int>(table->index().piece_count()));
+        const std::uint64_t key = material_key(table->index().get_material());
+        tables[key] = std::move(table);
+    }
+
+    const Tablebase *find(const Material &material) const {
+        const auto it = tables.find(material_key(material));
+        return (it == tables.end()) ? nullptr : it->second.get();
+    }
+
+    std::vector<std::string> names() const {
+        std::vector<std::string> result{};
+        for (const auto &[key, table] : tables) {
+            result.push_back(table->name());
+        }
+        return result;
+    }
+
+    // Maps every table file in a directory and returns how many were
+    // loaded.
+    std::size_t load_directory(const std::string &directory) {
+        std::size_t count = 0;
+        std::error_code error{};
+        for (const auto &entry :
+             std::filesystem::directory_iterator{directory, error}) {
+            if (entry.path().extension() != TABLEBASE_EXTENSION) { continue; }
+            if (auto table = Tablebase::load(entry.path().string())) {
+                add(std::move(table));
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    // Value (see TABLEBASE_DRAW) of a position with COLOR to move, or
+    // nothing if no table covers its material. Positions that no table
+    // indexes, with a pawn on the first or last rank or with the side not
+    // to move in check (kings adjacent, for one), are not probed.
+    template <PieceColor COLOR>
+    std::optional<std::uint8_t> probe(const ChessBoard &board) const {
+        using enum PieceColor;
+        const Material material = board_material(board);
+        if ((material[0] != 1) || (material[6] != 1)) { return std::nullopt; }
+        constexpr std::uint64_t BACK_RANKS = 0xFF000000000000FF;
+        const BitBoard pawns = board.get_piece<WHITE, PieceType::PAWN>() |
+                               board.get_piece<BLACK, PieceType::PAWN>();
+        if (((pawns.get_data() & BACK_RANKS) != 0) ||
+            board.in_check<other(COLOR)>()) {
+            return std::nullopt;
+        }
+        if (material_key(material) ==
+            material_key(Material{1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0})) {
+            return TABLEBASE_DRAW;
+        }
+        if (const Tablebase *table = find(material)) {
+            return table->get(COLOR, table->index().index(board));
+        }
+        if (const Tablebase *table = find(flipped(material))) {
+            return table->get(other(COLOR),
+                              table->index().index(board.flipped()));
+        }
+        return std::nullopt;
+    }
+
+}; // class Tablebases
+
+
+} // namespace DZChess
+
+#endif // DZCHESS_TABLEBASE_HPP_INCLUDED
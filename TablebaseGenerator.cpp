@@ -0,0 +1,351 @@
+#include <algorithm> // for std::max, std::min
+#include <atomic>    // for std::atomic, std::atomic_ref
+#include <chrono>    // for std::chrono::steady_clock
+#include <cstddef>   // for std::size_t
+#include <cstdint>   // for std::uint8_t, std::uint64_t
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ChessPiece.hpp"
+#include "ChessBoard.hpp"
+#include "MoveList.hpp"
+#include "ParseNumber.hpp"
+#include "Search.hpp"
+#include "Tablebase.hpp"
+#include "ThreadPool.hpp"
+
+
+using namespace DZChess;
+
+
+// Generates distance-to-mate tablebases by retrograde analysis. Pass 0
+// marks checkmates as lost in 0 plies. Pass n then marks every unresolved
+// position that has a move to a position lost in n - 1 plies as won in n
+// (n odd), or every unresolved position all of whose moves lead to won
+// positions, the longest of them won in n - 1 plies, as lost in n (n
+// even). Positions still unresolved when the
+// passes stop changing anything are drawn.
+//
+// Each pass scans the whole table and generates moves forward rather than
+// unmaking them, which keeps the generator independent of the move tables
+// at the cost of redundant work on positions that cannot change yet. The
+// passes are split across threads: a pass only writes values of its own
+// kind (wins or losses), and only reads values of the other kind, so the
+// order in which threads see each other's writes does not matter.
+// Captures and promotions lead to smaller tables, which are generated
+// first.
+
+
+constexpr std::size_t CHUNK_SIZE = 4096;
+
+
+// Material with the stronger side as white, the orientation in which
+// tables are generated and named.
+Material canonical(const Material &material) {
+    constexpr int VALUES[6] = {0, 9, 5, 3, 3, 1};
+    int white = 0;
+    int black = 0;
+    for (std::size_t i = 0; i < 6; ++i) {
+        white += VALUES[i] * material[i];
+        black += VALUES[i] * material[i + 6];
+    }
+    const Material other = flipped(material);
+    const bool stronger_black = (white < black) ||
+        ((white == black) && (material_name(other) > material_name(material)));
+    return stronger_black ? other : material;
+}
+
+
+// Materials reachable by one capture or promotion.
+std::vector<Material> successors(const Material &material) {
+    std::vector<Material> result{};
+    for (std::size_t i = 0; i < 12; ++i) {
+        if ((i % 6 == 0) || (material[i] == 0)) { continue; }
+        Material captured = material;
+        --captured[i];
+        result.push_back(captured);
+        if (i % 6 == 5) {
+            for (std::size_t promotion = 1; promotion <= 4; ++promotion) {
+                Material promoted = captured;
+                ++promoted[i - 5 + promotion];
+                result.push_back(promoted);
+            }
+        }
+    }
+    return result;
+}
+
+
+class TablebaseGenerator {
+
+    Tablebases &tables;
+    ThreadPool &pool;
+    const TablebaseIndex &indexer;
+    std::uint8_t *values[2];
+    std::atomic<bool> missing;
+
+    static std::atomic_ref<std::uint8_t> at(std::uint8_t *values,
+                                            std::uint64_t index) noexcept {
+        return std::atomic_ref<std::uint8_t>{values[index]};
+    }
+
+    template <PieceColor COLOR>
+    std::uint8_t child_value(const ChessBoard &board,
+                             const ChessMove &move) noexcept {
+        const ChessBoard child = board.after_move<COLOR>(move);
+        const bool same_material = !board.is_occupied(move.dst) &&
+                                   (move.src_type == move.dst_type);
+        if (same_material) {
+            const std::uint64_t index = indexer.index(child);
+            return at(values[static_cast<std::size_t>(other(COLOR))], index)
+                .load(std::memory_order_relaxed);
+        }
+        if (const auto value = tables.probe<other(COLOR)>(child)) {
+            return *value;
+        }
+        missing.store(true, std::memory_order_relaxed);
+        return TABLEBASE_DRAW;
+    }
+
+    template <PieceColor COLOR>
+    void classify(const ChessBoard &board, std::uint64_t index) noexcept {
+        std::uint8_t &value = values[static_cast<std::size_t>(COLOR)][index];
+        if (board.in_check<other(COLOR)>()) {
+            value = TABLEBASE_INVALID;
+            return;
+        }
+        MoveList moves{};
+        generate_legal_moves<COLOR>(board, moves);
+        if (moves.empty() && board.in_check<COLOR>()) {
+            value = TABLEBASE_RESULT;
+        }
+    }
+
+    // Returns whether the position was resolved in this pass.
+    template <PieceColor COLOR>
+    bool update(const ChessBoard &board, std::uint64_t index, int plies) {
+        const auto value =
+            at(values[static_cast<std::size_t>(COLOR)], index);
+        if (value.load(std::memory_order_relaxed) != TABLEBASE_DRAW) {
+            return false;
+        }
+        MoveList moves{};
+        generate_legal_moves<COLOR>(board, moves);
+        if (moves.empty()) { return false; } // stalemate
+        const auto result = static_cast<std::uint8_t>(TABLEBASE_RESULT + plies);
+        if (plies % 2 == 1) {
+            for (const ChessMove &move : moves) {
+                if (child_value<COLOR>(board, move) == result - 1) {
+                    value.store(result, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+            return false;
+        }
+        // Lost in n only if the longest win among the moves is n - 1 plies:
+        // a capture or promotion can lead to a win further away, and the
+        // position is resolved by the pass that matches it.
+        std::uint8_t longest = 0;
+        for (const ChessMove &move : moves) {
+            const std::uint8_t child = child_value<COLOR>(board, move);
+            if (!tablebase_win(child) || (child > result - 1)) {
+                return false;
+            }
+            longest = std::max(longest, child);
+        }
+        if (longest != result - 1) { return false; }
+        value.store(result, std::memory_order_relaxed);
+        return true;
+    }
+
+    template <typename Function>
+    void for_each_position(Function f) {
+        const std::uint64_t size = indexer.size();
+        const std::size_t chunks = (size + CHUNK_SIZE - 1) / CHUNK_SIZE;
+        pool.parallel_for(chunks, [&](std::size_t chunk, std::size_t) {
+            const std::uint64_t end = std::min(
+                static_cast<std::uint64_t>(chunk + 1) * CHUNK_SIZE, size);
+            for (std::uint64_t i = chunk * CHUNK_SIZE; i < end; ++i) {
+                if (const auto board = indexer.decode(i)) {
+                    f(*board, i);
+                } else {
+                    values[0][i] = TABLEBASE_INVALID;
+                    values[1][i] = TABLEBASE_INVALID;
+                }
+            }
+        });
+    }
+
+public:
+
+    explicit TablebaseGenerator(Tablebases &tables, ThreadPool &pool,
+                                Tablebase &table) noexcept :
+        tables(tables), pool(pool), indexer(table.index()),
+        values{table.mutable_values(PieceColor::WHITE),
+               table.mutable_values(PieceColor::BLACK)},
+        missing(false) {}
+
+    // Fills the table and returns the number of passes. Results in the
+    // tables this one leads to can be up to their longest distance plus
+    // one ply away, so passes continue at least that far.
+    int generate(int longest_successor) {
+        for_each_position([&](const ChessBoard &board, std::uint64_t i) {
+            classify<PieceColor::WHITE>(board, i);
+            classify<PieceColor::BLACK>(board, i);
+        });
+        int quiet_passes = 0;
+        int plies = 1;
+        for (; plies <= TABLEBASE_MAX_PLIES; ++plies) {
+            std::atomic<std::uint64_t> changed{0};
+            for_each_position([&](const ChessBoard &board, std::uint64_t i) {
+                const std::uint64_t count =
+                    update<PieceColor::WHITE>(board, i, plies) +
+                    update<PieceColor::BLACK>(board, i, plies);
+                if (count > 0) { changed += count; }
+            });
+            quiet_passes = (changed == 0) ? quiet_passes + 1 : 0;
+            if ((quiet_passes >= 2) && (plies > longest_successor + 1)) {
+                break;
+            }
+        }
+        return plies;
+    }
+
+    bool successor_missing() const noexcept { return missing.load(); }
+
+}; // class TablebaseGenerator
+
+
+// Longest distance to mate in a table, in plies.
+int longest_result(const Tablebase &table) {
+    int result = 0;
+    for (const PieceColor side : {PieceColor::WHITE, PieceColor::BLACK}) {
+        for (std::uint64_t i = 0; i < table.index().size(); ++i) {
+            const std::uint8_t value = table.get(side, i);
+            if (value >= TABLEBASE_RESULT) {
+                result = std::max(result, value - TABLEBASE_RESULT);
+            }
+        }
+    }
+    return result;
+}
+
+
+void print_summary(const Tablebase &table, int passes, double seconds) {
+    std::uint64_t wins = 0;
+    std::uint64_t losses = 0;
+    std::uint64_t draws = 0;
+    int longest_mate = 0;
+    for (std::uint64_t i = 0; i < table.index().size(); ++i) {
+        const std::uint8_t value = table.get(PieceColor::WHITE, i);
+        if (tablebase_win(value)) {
+            ++wins;
+            longest_mate = std::max(longest_mate, value - TABLEBASE_RESULT);
+        } else if (tablebase_loss(value)) {
+            ++losses;
+        } else if (value == TABLEBASE_DRAW) {
+            ++draws;
+        }
+    }
+    std::cout << table.name() << ": " << wins + losses + draws
+              << " positions with white to move (" << wins << " won, "
+              << losses << " lost, " << draws << " drawn), longest mate "
+              << (longest_mate + 1) / 2 << " moves, " << passes
+              << " passes, " << seconds << " s" << std::endl;
+}
+
+
+// Makes sure that the table for a material, or for its mirror image, is
+// in tables, generating it and the tables it depends on if needed.
+bool ensure(Tablebases &tables, ThreadPool &pool, const Material &material,
+            const std::string &directory) {
+    if (material_name(material) == "KK") { return true; }
+    if ((tables.find(material) != nullptr) ||
+        (tables.find(flipped(material)) != nullptr)) {
+        return true;
+    }
+    int longest_successor = 0;
+    for (const Material &next : successors(material)) {
+        if (!ensure(tables, pool, canonical(next), directory)) {
+            return false;
+        }
+        const Tablebase *table = tables.find(next);
+        if (table == nullptr) { table = tables.find(flipped(next)); }
+        if (table != nullptr) {
+            longest_successor =
+                std::max(longest_successor, longest_result(*table));
+        }
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    auto table = std::make_unique<Tablebase>(material);
+    TablebaseGenerator generator{tables, pool, *table};
+    const int passes = generator.generate(longest_successor);
+    const auto stop = std::chrono::steady_clock::now();
+    if (generator.successor_missing()) {
+        std::cout << "ERROR: missing a table needed by "
+                  << material_name(material) << std::endl;
+        return false;
+    }
+    print_summary(*table, passes,
+                  std::chrono::duration<double>(stop - start).count());
+    const std::string path = (std::filesystem::path{directory} /
+        (table->name() + TABLEBASE_EXTENSION)).string();
+    if (!table->save(path)) {
+        std::cout << "ERROR: could not write " << path << std::endl;
+        return false;
+    }
+    tables.add(std::move(table));
+    return true;
+}
+
+
+void print_usage(const char *program) {
+    std::cout << "usage: " << program << " <directory> <material>..."
+              << " [--threads n]" << std::endl;
+    std::cout << "Generates tables like KQK or KQKR, and the smaller tables"
+                 " they need, into the directory, reusing the tables"
+                 " already there." << std::endl;
+}
+
+
+int main(int argc, char **argv) {
+
+    if (argc < 3) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    const std::string directory = argv[1];
+    std::vector<Material> materials{};
+    std::size_t threads = ThreadPool::default_thread_count();
+    for (int i = 2; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--threads") {
+            if ((i + 1 >= argc) || !parse_number(argv[++i], threads) ||
+                (threads == 0)) {
+                print_usage(argv[0]);
+                return 1;
+            }
+        } else if (const auto material = parse_material(arg)) {
+            materials.push_back(*material);
+        } else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    std::error_code error{};
+    std::filesystem::create_directories(directory, error);
+    Tablebases tables{};
+    const std::size_t loaded = tables.load_directory(directory);
+    std::cout << "Loaded " << loaded << " tables from " << directory
+              << std::endl;
+    ThreadPool pool{threads};
+    for (const Material &material : materials) {
+        if (!ensure(tables, pool, material, directory)) { return 1; }
+    }
+
+}
@@ -0,0 +1,457 @@
+#include <algorithm> // for std::fill, std::min
+#include <array>     // for std::array
+#include <chrono>    // for std::chrono::steady_clock
+#include <cmath>     // for std::exp, std::lround, std::pow, std::sqrt
+#include <cstddef>   // for std::size_t
+#include <cstdint>   // for std::uint8_t, std::uint16_t, std::uint32_t
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ChessPiece.hpp"
+#include "ChessBoard.hpp"
+#include "PieceSquareTables.hpp"
+#include "Fen.hpp"
+#include "ParseNumber.hpp"
+#include "ThreadPool.hpp"
+
+
+using namespace DZChess;
+
+
+// Texel's tuning method: choose evaluation weights that minimize the mean
+// squared error between game results and the win probability predicted
+// from the static evaluation, sigmoid(K * eval / 400) in base 10, over a
+// set of positions taken from games with known outcomes.
+//
+// The tuned evaluation is PieceSquareEvaluationVisitor's: material plus
+// piece-square tables, tapered by game phase. It is linear in the weights
+// for a fixed position, so each position is stored once as a short list
+// of active features, and the loss and its gradient are sums over
+// positions that split evenly across threads without any allocation.
+
+
+// A feature is one piece of one color on one table index. Bit 9 is set
+// for black pieces, which count negatively.
+constexpr std::uint16_t BLACK_FEATURE = 0x200;
+constexpr std::size_t FEATURES = 6 * 64;
+
+// Parameters: material then piece-square values for each piece type, for
+// the midgame and then the endgame.
+constexpr std::size_t MATERIAL_OFFSET = 0;
+constexpr std::size_t TABLE_OFFSET = 6;
+constexpr std::size_t PHASE_PARAMETERS = 6 + FEATURES;
+constexpr std::size_t PARAMETERS = 2 * PHASE_PARAMETERS;
+
+using Parameters = std::array<double, PARAMETERS>;
+
+
+class Dataset {
+
+public:
+
+    std::vector<std::uint16_t> features;
+    std::vector<std::uint32_t> offsets; // features of position i are in
+                                        // [offsets[i], offsets[i + 1])
+    std::vector<std::uint8_t> phases;
+    std::vector<float> results;         // 1 white win, 0.5 draw, 0 loss
+
+    explicit Dataset() : features(), offsets{0}, phases(), results() {}
+
+    std::size_t size() const noexcept { return results.size(); }
+
+    void add(const ChessBoard &board, float result) {
+        append<PieceColor::WHITE>(board);
+        append<PieceColor::BLACK>(board);
+        offsets.push_back(static_cast<std::uint32_t>(features.size()));
+        phases.push_back(static_cast<std::uint8_t>(
+            std::min(board.get_scores().phase, MAX_PHASE)));
+        results.push_back(result);
+    }
+
+private:
+
+    template <PieceColor COLOR, PieceType TYPE>
+    void append_type(const ChessBoard &board) {
+        const std::uint16_t color =
+            (COLOR == PieceColor::WHITE) ? 0 : BLACK_FEATURE;
+        for (const std::uint64_t square : board.get_piece<COLOR, TYPE>()) {
+            features.push_back(static_cast<std::uint16_t>(
+                color | (64 * static_cast<unsigned>(TYPE)) |
+                PieceSquareScore::table_index<COLOR>(square)));
+        }
+    }
+
+    template <PieceColor COLOR>
+    void append(const ChessBoard &board) {
+        append_type<COLOR, PieceType::KING  >(board);
+        append_type<COLOR, PieceType::QUEEN >(board);
+        append_type<COLOR, PieceType::ROOK  >(board);
+        append_type<COLOR, PieceType::BISHOP>(board);
+        append_type<COLOR, PieceType::KNIGHT>(board);
+        append_type<COLOR, PieceType::PAWN  >(board);
+    }
+
+}; // class Dataset
+
+
+// Accepts "1-0", "0-1" and "1/2-1/2", optionally quoted and followed by a
+// semicolon as in EPD, or a bracketed or decimal score such as "[0.5]".
+// Bare integers are rejected because FEN move counters look the same.
+bool parse_result(std::string_view token, float &result) noexcept {
+    while (!token.empty() && ((token.back() == ';') ||
+                              (token.back() == '"') ||
+                              (token.back() == ']'))) {
+        token.remove_suffix(1);
+    }
+    bool bracketed = false;
+    while (!token.empty() && ((token.front() == '"') ||
+                              (token.front() == '['))) {
+        bracketed = true;
+        token.remove_prefix(1);
+    }
+    if ((token == "1-0") || (token == "1.0") ||
+        (bracketed && (token == "1"))) {
+        result = 1.0f;
+    } else if ((token == "0-1") || (token == "0.0") ||
+               (bracketed && (token == "0"))) {
+        result = 0.0f;
+    } else if ((token == "1/2-1/2") || (token == "0.5")) {
+        result = 0.5f;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+
+bool load_dataset(const std::string &path, Dataset &dataset,
+                  std::size_t &skipped) {
+    std::ifstream file{path};
+    if (!file) { return false; }
+    std::string line;
+    while (std::getline(file, line)) {
+        std::string_view view{line};
+        while (!view.empty() && ((view.back() == '\r') ||
+                                 (view.back() == ' '))) {
+            view.remove_suffix(1);
+        }
+        if (view.empty()) { continue; }
+        const std::size_t space = view.rfind(' ');
+        float result = 0.0f;
+        ChessBoard board{};
+        PositionState state{};
+        if ((space == std::string_view::npos) ||
+            !parse_result(view.substr(space + 1), result) ||
+            !parse_fen(view.substr(0, space), board, state)) {
+            ++skipped;
+            continue;
+        }
+        dataset.add(board, result);
+    }
+    return true;
+}
+
+
+Parameters initial_parameters() {
+    Parameters result{};
+    const std::array<PieceSquareTable, 6> midgame = {
+        KING_MIDGAME_TABLE, QUEEN_TABLE, ROOK_TABLE,
+        BISHOP_TABLE, KNIGHT_TABLE, PAWN_MIDGAME_TABLE
+    };
+    const std::array<PieceSquareTable, 6> endgame = {
+        KING_ENDGAME_TABLE, QUEEN_TABLE, ROOK_TABLE,
+        BISHOP_TABLE, KNIGHT_TABLE, PAWN_ENDGAME_TABLE
+    };
+    for (std::size_t t = 0; t < 6; ++t) {
+        result[MATERIAL_OFFSET + t] = MIDGAME_MATERIAL[t];
+        result[PHASE_PARAMETERS + MATERIAL_OFFSET + t] = ENDGAME_MATERIAL[t];
+        for (std::size_t i = 0; i < 64; ++i) {
+            result[TABLE_OFFSET + 64 * t + i] = midgame[t][i];
+            result[PHASE_PARAMETERS + TABLE_OFFSET + 64 * t + i] =
+                endgame[t][i];
+        }
+    }
+    return result;
+}
+
+
+double evaluate(const Parameters &w, const Dataset &data,
+                std::size_t i) noexcept {
+    double midgame = 0.0;
+    double endgame = 0.0;
+    for (std::uint32_t j = data.offsets[i]; j < data.offsets[i + 1]; ++j) {
+        const std::uint16_t feature = data.features[j];
+        const std::size_t index = feature & 0x1FF;
+        const std::size_t type = index / 64;
+        const double mg = w[MATERIAL_OFFSET + type] + w[TABLE_OFFSET + index];
+        const double eg = w[PHASE_PARAMETERS + MATERIAL_OFFSET + type] +
+                          w[PHASE_PARAMETERS + TABLE_OFFSET + index];
+        if (feature & BLACK_FEATURE) {
+            midgame -= mg;
+            endgame -= eg;
+        } else {
+            midgame += mg;
+            endgame += eg;
+        }
+    }
+    const double phase = data.phases[i];
+    return (midgame * phase + endgame * (MAX_PHASE - phase)) / MAX_PHASE;
+}
+
+
+constexpr double LN10 = 2.302585092994046;
+
+double win_probability(double k, double eval) noexcept {
+    return 1.0 / (1.0 + std::exp(-LN10 * k * eval / 400.0));
+}
+
+
+// Computes the loss over the whole dataset, and, if gradient is non-null,
+// its gradient with respect to the parameters. Each thread accumulates
+// into its own preallocated row of scratch, which is summed at the end.
+class LossFunction {
+
+    static constexpr std::size_t CHUNK = 4096;
+
+    const Dataset &data;
+    ThreadPool &pool;
+    std::vector<Parameters> scratch;
+    std::vector<double> losses;
+
+public:
+
+    explicit LossFunction(const Dataset &data, ThreadPool &pool) :
+        data(data), pool(pool), scratch(pool.size()),
+        losses(pool.size()) {}
+
+    double operator()(const Parameters &w, double k,
+                      Parameters *gradient) {
+        for (Parameters &row : scratch) { row.fill(0.0); }
+        std::fill(losses.begin(), losses.end(), 0.0);
+        const std::size_t chunks = (data.size() + CHUNK - 1) / CHUNK;
+        pool.parallel_for(chunks, [&](std::size_t chunk, std::size_t thread) {
+            Parameters &g = scratch[thread];
+            double loss = 0.0;
+            const std::size_t end = std::min(data.size(), (chunk + 1) * CHUNK);
+            for (std::size_t i = chunk * CHUNK; i < end; ++i) {
+                const double p = win_probability(k, evaluate(w, data, i));
+                const double error = data.results[i] - p;
+                loss += error * error;
+                if (gradient == nullptr) { continue; }
+                // Derivative of the squared error with respect to eval.
+                const double d = -2.0 * error * p * (1.0 - p) *
+                                 LN10 * k / 400.0;
+                const double phase = data.phases[i];
+                const double d_mg = d * phase / MAX_PHASE;
+                const double d_eg = d * (MAX_PHASE - phase) / MAX_PHASE;
+                for (std::uint32_t j = data.offsets[i];
+                     j < data.offsets[i + 1]; ++j) {
+                    const std::uint16_t feature = data.features[j];
+                    const std::size_t index = feature & 0x1FF;
+                    const std::size_t type = index / 64;
+                    const double sign =
+                        (feature & BLACK_FEATURE) ? -1.0 : +1.0;
+                    g[MATERIAL_OFFSET + type] += sign * d_mg;
+                    g[TABLE_OFFSET + index] += sign * d_mg;
+                    g[PHASE_PARAMETERS + MATERIAL_OFFSET + type] +=
+                        sign * d_eg;
+                    g[PHASE_PARAMETERS + TABLE_OFFSET + index] +=
+                        sign * d_eg;
+                }
+            }
+            losses[thread] += loss;
+        });
+        const double n = static_cast<double>(data.size());
+        if (gradient != nullptr) {
+            gradient->fill(0.0);
+            for (const Parameters &row : scratch) {
+                for (std::size_t p = 0; p < PARAMETERS; ++p) {
+                    (*gradient)[p] += row[p] / n;
+                }
+            }
+        }
+        double loss = 0.0;
+        for (const double l : losses) { loss += l; }
+        return loss / n;
+    }
+
+}; // class LossFunction
+
+
+// The scaling constant K is fitted first, with the initial weights, and
+// then held fixed, so that the weights keep their centipawn scale.
+double fit_scaling(LossFunction &loss, const Parameters &w) {
+    double k = 1.0;
+    double step = 0.5;
+    double best = loss(w, k, nullptr);
+    while (step > 0.001) {
+        const double up = loss(w, k + step, nullptr);
+        const double down = (k > step) ? loss(w, k - step, nullptr) : best;
+        if (up < best) {
+            k += step;
+            best = up;
+        } else if (down < best) {
+            k -= step;
+            best = down;
+        } else {
+            step /= 2;
+        }
+    }
+    return k;
+}
+
+
+// King material is fixed at zero, since only material differences matter
+// and both sides always have one king.
+bool is_fixed(std::size_t p) noexcept {
+    const std::size_t q = p % PHASE_PARAMETERS;
+    return q == MATERIAL_OFFSET + static_cast<std::size_t>(PieceType::KING);
+}
+
+
+void write_array(std::ostream &out, const char *name, const Parameters &w,
+                 std::size_t offset) {
+    out << "constexpr std::array<int, 6> " << name << " = {";
+    for (std::size_t t = 0; t < 6; ++t) {
+        out << (t ? ", " : "") << std::lround(w[offset + t]);
+    }
+    out << "};\n";
+}
+
+
+void write_table(std::ostream &out, const std::string &name,
+                 const Parameters &w, std::size_t offset) {
+    out << "\nconstexpr PieceSquareTable " << name << " = {\n";
+    for (std::size_t row = 0; row < 8; ++row) {
+        out << "   ";
+        for (std::size_t col = 0; col < 8; ++col) {
+            out << ' ' << std::setw(4) << std::lround(w[offset + 8 * row + col])
+                << ',';
+        }
+        out << '\n';
+    }
+    out << "};\n";
+}
+
+
+bool write_weights_header(const std::string &path, const Parameters &w,
+                          const std::string &dataset, std::size_t positions,
+                          double k, double loss) {
+    std::ofstream out{path};
+    if (!out) { return false; }
+    static const char *const NAMES[6] = {
+        "KING", "QUEEN", "ROOK", "BISHOP", "KNIGHT", "PAWN"
+    };
+    out << "#ifndef DZCHESS_TUNED_WEIGHTS_HPP_INCLUDED\n"
+        << "#define DZCHESS_TUNED_WEIGHTS_HPP_INCLUDED\n\n"
+        << "#include <array> // for std::array\n\n"
+        << "#include \"PieceSquareTables.hpp\"\n\n"
+        << "namespace DZChess {\n\n\n"
+        << "// Generated by TexelTuner from " << dataset << ".\n"
+        << "// " << positions << " positions, K = " << k
+        << ", loss = " << loss << ".\n"
+        << "// Tables use the layout of PieceSquareTables.hpp.\n\n";
+    write_array(out, "TUNED_MIDGAME_MATERIAL", w, MATERIAL_OFFSET);
+    write_array(out, "TUNED_ENDGAME_MATERIAL", w,
+                PHASE_PARAMETERS + MATERIAL_OFFSET);
+    for (std::size_t t = 0; t < 6; ++t) {
+        write_table(out, std::string{"TUNED_"} + NAMES[t] + "_MIDGAME_TABLE",
+                    w, TABLE_OFFSET + 64 * t);
+        write_table(out, std::string{"TUNED_"} + NAMES[t] + "_ENDGAME_TABLE",
+                    w, PHASE_PARAMETERS + TABLE_OFFSET + 64 * t);
+    }
+    out << "\n\n} // namespace DZChess\n\n"
+        << "#endif // DZCHESS_TUNED_WEIGHTS_HPP_INCLUDED\n";
+    return static_cast<bool>(out);
+}
+
+
+void print_usage(const char *program) {
+    std::cout << "usage: " << program
+              << " <positions> [output header] [iterations] [threads]"
+              << std::endl;
+    std::cout << "Each line of the positions file holds a FEN followed "
+                 "by the game result (1-0, 0-1, 1/2-1/2 or [0.5])."
+              << std::endl;
+}
+
+
+int main(int argc, char **argv) {
+
+    if (argc < 2) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    const std::string dataset_path = argv[1];
+    const std::string output_path = (argc > 2) ? argv[2] : "TunedWeights.hpp";
+    int iterations = 1000;
+    std::size_t threads = ThreadPool::default_thread_count();
+    if (((argc > 3) &&
+         (!parse_number(argv[3], iterations) || (iterations < 0))) ||
+        ((argc > 4) && (!parse_number(argv[4], threads) || (threads == 0)))) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto elapsed = [&start]() {
+        const auto now = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(now - start).count();
+    };
+
+    Dataset data{};
+    std::size_t skipped = 0;
+    if (!load_dataset(dataset_path, data, skipped)) {
+        std::cout << "ERROR: could not read " << dataset_path << std::endl;
+        return 1;
+    }
+    std::cout << "Loaded " << data.size() << " positions (" << skipped
+              << " lines skipped) in " << elapsed() << " s" << std::endl;
+    if (data.size() == 0) { return 1; }
+
+    ThreadPool pool{threads};
+    LossFunction loss{data, pool};
+    Parameters w = initial_parameters();
+    const double k = fit_scaling(loss, w);
+    std::cout << "K = " << k << ", initial loss "
+              << loss(w, k, nullptr) << std::endl;
+
+    // Adam, with a step size in centipawns.
+    constexpr double RATE = 1.0;
+    constexpr double BETA1 = 0.9;
+    constexpr double BETA2 = 0.999;
+    constexpr double EPSILON = 1e-12;
+    Parameters gradient{};
+    Parameters m{};
+    Parameters v{};
+    double current = 0.0;
+    for (int iteration = 1; iteration <= iterations; ++iteration) {
+        current = loss(w, k, &gradient);
+        const double c1 = 1.0 - std::pow(BETA1, iteration);
+        const double c2 = 1.0 - std::pow(BETA2, iteration);
+        for (std::size_t p = 0; p < PARAMETERS; ++p) {
+            if (is_fixed(p)) { continue; }
+            m[p] = BETA1 * m[p] + (1.0 - BETA1) * gradient[p];
+            v[p] = BETA2 * v[p] + (1.0 - BETA2) * gradient[p] * gradient[p];
+            w[p] -= RATE * (m[p] / c1) / (std::sqrt(v[p] / c2) + EPSILON);
+        }
+        if ((iteration % 50 == 0) || (iteration == iterations)) {
+            std::cout << "iteration " << iteration << " loss " << current
+                      << " (" << elapsed() << " s)" << std::endl;
+        }
+    }
+
+    current = loss(w, k, nullptr);
+    if (!write_weights_header(output_path, w, dataset_path, data.size(),
+                              k, current)) {
+        std::cout << "ERROR: could not write " << output_path << std::endl;
+        return 1;
+    }
+    std::cout << "Final loss " << current << "; weights written to "
+              << output_path << " after " << elapsed() << " s" << std::endl;
+
+}
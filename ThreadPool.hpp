@@ -0,0 +1,104 @@
+#ifndef DZCHESS_THREAD_POOL_HPP_INCLUDED
+#define DZCHESS_THREAD_POOL_HPP_INCLUDED
+
+#include <algorithm>          // for std::max
+#include <atomic>             // for std::atomic
+#include <condition_variable> // for std::condition_variable
+#include <cstddef>            // for std::size_t
+#include <functional>         // for std::function
+#include <mutex>              // for std::mutex, std::unique_lock
+#include <thread>             // for std::thread
+#include <vector>             // for std::vector
+
+namespace DZChess {
+
+
+// Fixed set of worker threads that stay alive between jobs, so that jobs
+// run many times in a loop do not pay for thread creation every time.
+// Work items are handed out one index at a time from a shared counter,
+// which balances items of uneven cost across the workers.
+class ThreadPool {
+
+    using Job = std::function<void(std::size_t index, std::size_t thread)>;
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable start;
+    std::condition_variable done;
+    const Job *job;
+    std::size_t job_size;
+    std::atomic<std::size_t> next_index;
+    std::size_t generation;
+    std::size_t active;
+    bool stopping;
+
+    void work(std::size_t thread) {
+        std::size_t seen = 0;
+        std::unique_lock<std::mutex> lock{mutex};
+        while (true) {
+            start.wait(lock, [&] { return stopping || (generation != seen); });
+            if (stopping) { return; }
+            seen = generation;
+            const Job &f = *job;
+            const std::size_t size = job_size;
+            lock.unlock();
+            for (std::size_t i = next_index++; i < size; i = next_index++) {
+                f(i, thread);
+            }
+            lock.lock();
+            if (--active == 0) { done.notify_all(); }
+        }
+    }
+
+public:
+
+    explicit ThreadPool(std::size_t threads = default_thread_count()) :
+        workers(), mutex(), start(), done(), job(nullptr), job_size(0),
+        next_index(0), generation(0), active(0), stopping(false) {
+        threads = std::max(threads, std::size_t{1});
+        workers.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i) {
+            workers.emplace_back([this, i] { work(i); });
+        }
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            stopping = true;
+        }
+        start.notify_all();
+        for (std::thread &worker : workers) { worker.join(); }
+    }
+
+    static std::size_t default_thread_count() noexcept {
+        return std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    std::size_t size() const noexcept { return workers.size(); }
+
+    // Calls f(index, thread) for every index below count and returns once
+    // all calls have finished. The thread argument is below size() and
+    // identifies the worker, so that f can use per-thread scratch space.
+    // Only one job may run at a time.
+    void parallel_for(std::size_t count, const Job &f) {
+        std::unique_lock<std::mutex> lock{mutex};
+        job = &f;
+        job_size = count;
+        next_index = 0;
+        active = workers.size();
+        ++generation;
+        start.notify_all();
+        done.wait(lock, [&] { return active == 0; });
+        job = nullptr;
+    }
+
+}; // class ThreadPool
+
+
+} // namespace DZChess
+
+#endif // DZCHESS_THREAD_POOL_HPP_INCLUDED
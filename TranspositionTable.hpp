@@ -0,0 +1,130 @@
+#ifndef DZCHESS_TRANSPOSITION_TABLE_HPP_INCLUDED
+#define DZCHESS_TRANSPOSITION_TABLE_HPP_INCLUDED
+
+#include <atomic>  // for std::atomic, std::memory_order_relaxed
+#include <bit>     // for std::bit_floor
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::uint64_t, std::int32_t, std::uint32_t
+#include <memory>  // for std::unique_ptr
+
+#include "ChessPiece.hpp"
+
+namespace DZChess {
+
+
+enum class Bound : std::uint8_t { EXACT, LOWER, UPPER };
+
+
+struct TranspositionEntry {
+    ChessMove move;
+    int score;
+    int depth;
+    Bound bound;
+    bool has_move;
+};
+
+
+// Direct-mapped table of search results keyed by position hash, shared by
+// all search threads without locking. As in EvaluationCache, each entry
+// stores its key XORed with its data, so torn writes fail the key check.
+// Entries are always replaced: the newest result is usually the most
+// relevant one, and the table is sized so that collisions are rare.
+class TranspositionTable {
+
+    struct Entry {
+        std::atomic<std::uint64_t> check;
+        std::atomic<std::uint64_t> data;
+    };
+
+    std::unique_ptr<Entry[]> entries;
+    std::size_t size;
+
+    // Layout of data: score in bits 0-31, depth in bits 32-39, bound in
+    // bits 40-41, then the move: a flag in bit 42, source and destination
+    // squares in bits 43-54, and source and destination types in 55-60.
+    static constexpr std::uint64_t pack(const TranspositionEntry &entry)
+        noexcept {
+        return static_cast<std::uint64_t>(
+                   static_cast<std::uint32_t>(entry.score)) |
+               (static_cast<std::uint64_t>(entry.depth & 0xFF) << 32) |
+               (static_cast<std::uint64_t>(entry.bound) << 40) |
+               (static_cast<std::uint64_t>(entry.has_move) << 42) |
+               (entry.move.src << 43) | (entry.move.dst << 49) |
+               (static_cast<std::uint64_t>(entry.move.src_type) << 55) |
+               (static_cast<std::uint64_t>(entry.move.dst_type) << 58);
+    }
+
+    static constexpr TranspositionEntry unpack(std::uint64_t data) noexcept {
+        TranspositionEntry entry{};
+        entry.score = static_cast<std::int32_t>(
+            static_cast<std::uint32_t>(data));
+        entry.depth = static_cast<std::int8_t>((data >> 32) & 0xFF);
+        entry.bound = static_cast<Bound>((data >> 40) & 0x3);
+        entry.has_move = ((data >> 42) & 1) != 0;
+        entry.move.src = (data >> 43) & 0x3F;
+        entry.move.dst = (data >> 49) & 0x3F;
+        entry.move.src_type = static_cast<PieceType>((data >> 55) & 0x7);
+        entry.move.dst_type = static_cast<PieceType>((data >> 58) & 0x7);
+        return entry;
+    }
+
+    static std::size_t entries_for(std::size_t megabytes) noexcept {
+        const std::size_t bytes = (megabytes << 20) / sizeof(Entry);
+        return std::bit_floor(bytes > 0 ? bytes : std::size_t{1});
+    }
+
+public:
+
+    explicit TranspositionTable(std::size_t megabytes = 16) :
+        entries(new Entry[entries_for(megabytes)]()),
+        size(entries_for(megabytes)) {}
+
+    std::size_t capacity() const noexcept { return size; }
+
+    // Discards all entries. Must not be called during a search.
+    void resize(std::size_t megabytes) {
+        entries.reset();
+        size = entries_for(megabytes);
+        entries.reset(new Entry[size]());
+    }
+
+    bool probe(std::uint64_t key, TranspositionEntry &entry) const noexcept {
+        const Entry &slot = entries[key & (size - 1)];
+        const std::uint64_t data = slot.data.load(std::memory_order_relaxed);
+        const std::uint64_t check =
+            slot.check.load(std::memory_order_relaxed);
+        if (((check ^ data) != key) || (data == 0)) { return false; }
+        entry = unpack(data);
+        return true;
+    }
+
+    void store(std::uint64_t key, const TranspositionEntry &entry) noexcept {
+        Entry &slot = entries[key & (size - 1)];
+        const std::uint64_t data = pack(entry);
+        slot.check.store(key ^ data, std::memory_order_relaxed);
+        slot.data.store(data, std::memory_order_relaxed);
+    }
+
+    void clear() noexcept {
+        for (std::size_t i = 0; i < size; ++i) {
+            entries[i].check.store(0, std::memory_order_relaxed);
+            entries[i].data.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    // Occupancy in permille, estimated from the first thousand entries.
+    int permille_full() const noexcept {
+        const std::size_t sample = (size < 1000) ? size : 1000;
+        std::size_t used = 0;
+        for (std::size_t i = 0; i < sample; ++i) {
+            used += (entries[i].data.load(std::memory_order_relaxed) != 0);
+        }
+        return static_cast<int>(1000 * used / sample);
+    }
+
+}; // class TranspositionTable
+
+
+} // namespace DZChess
+
+#endif // DZCHESS_TRANSPOSITION_TABLE_HPP_INCLUDED
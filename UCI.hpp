@@ -0,0 +1,573 @@
+#ifndef DZCHESS_UCI_HPP_INCLUDED
+#define DZCHESS_UCI_HPP_INCLUDED
+
+#include <algorithm>          // for std::max, std::min
+#include <atomic>             // for std::atomic
+#include <charconv>           // for std::from_chars
+#include <chrono>             // for std::chrono::steady_clock
+#include <condition_variable> // for std::condition_variable
+#include <cstddef>            // for std::size_t
+#include <cstdint>            // for std::uint64_t
+#include <iostream>           // for std::cin, std::cout
+#include <memory>             // for std::unique_ptr, std::make_unique
+#include <mutex>              // for std::mutex, std::lock_guard
+#include <sstream>            // for std::istringstream, std::ostringstream
+#include <string>             // for std::string, std::getline
+#include <string_view>        // for std::string_view
+#include <system_error>       // for std::errc
+#include <thread>             // for std::thread
+#include <utility>            // for std::move
+#include <vector>             // for std::vector
+
+#include "ChessPiece.hpp"
+#include "ChessBoard.hpp"
+#include "MoveList.hpp"
+#include "Evaluation.hpp"
+#include "EvaluationCache.hpp"
+#include "TranspositionTable.hpp"
+#include "Search.hpp"
+#include "Tablebase.hpp"
+#include "NNUE.hpp"
+#include "Fen.hpp"
+
+namespace DZChess {
+
+
+// Long algebraic notation used by UCI: source and destination squares,
+// followed by the promotion piece, as in e2e4 or e7e8q.
+inline std::string uci_move_name(const ChessMove &move) {
+    std::string result{square_name(move.src).data()};
+    result += square_name(move.dst).data();
+    if (move.src_type != move.dst_type) {
+        constexpr char NAMES[6] = {'k', 'q', 'r', 'b', 'n', 'p'};
+        result += NAMES[static_cast<std::size_t>(move.dst_type)];
+    }
+    return result;
+}
+
+
+constexpr bool parse_uci_square(std::string_view text,
+                                std::uint64_t &square) noexcept {
+    if ((text.size() < 2) || (text[0] < 'a') || (text[0] > 'h') ||
+        (text[1] < '1') || (text[1] > '8')) {
+        return false;
+    }
+    square = static_cast<std::uint64_t>(8 * (text[1] - '1') +
+                                        (text[0] - 'a'));
+    return true;
+}
+
+
+// Plays a move given in UCI notation. ChessBoard does not generate
+// castling or en passant, but the other side of a UCI connection does, so
+// both are recognized here from the king moving two files and from a pawn
+// capturing onto the en passant square, checked against the castling
+// rights and en passant square in state, and played piece by piece.
+// Returns false, leaving the position untouched, for an illegal move.
+template <PieceColor COLOR>
+bool play_uci_move(ChessBoard &board, PositionState &state,
+                   std::string_view text) {
+    std::uint64_t src = 0;
+    std::uint64_t dst = 0;
+    if ((text.size() < 4) || (text.size() > 5) ||
+        !parse_uci_square(text.substr(0, 2), src) ||
+        !parse_uci_square(text.substr(2, 2), dst)) {
+        return false;
+    }
+    if (!board.get_pieces<COLOR>().is_set(src)) { return false; }
+    const PieceType type = board.piece_type_at<COLOR>(src);
+    PieceType promotion = type;
+    if (text.size() == 5) {
+        switch (text[4]) {
+            case 'q': promotion = PieceType::QUEEN ; break;
+            case 'r': promotion = PieceType::ROOK  ; break;
+            case 'b': promotion = PieceType::BISHOP; break;
+            case 'n': promotion = PieceType::KNIGHT; break;
+            default: return false;
+        }
+    }
+
+    ChessBoard next = board;
+    const std::uint64_t distance = (src > dst) ? (src - dst) : (dst - src);
+    const bool capture = board.is_occupied(dst);
+    if ((type == PieceType::KING) && (distance == 2)) {
+        // The king may not castle out of, through or into check, and every
+        // square between king and rook must be empty.
+        constexpr std::uint64_t home = (COLOR == PieceColor::WHITE) ? 4 : 60;
+        const bool kingside = (dst > src);
+        const std::uint8_t right = (COLOR == PieceColor::WHITE)
+            ? (kingside ? WHITE_KINGSIDE : WHITE_QUEENSIDE)
+            : (kingside ? BLACK_KINGSIDE : BLACK_QUEENSIDE);
+        const std::uint64_t rook_src = kingside ? (src + 3) : (src - 4);
+        const std::uint64_t rook_dst = (src + dst) / 2;
+        if ((src != home) || !(state.castling_rights & right) ||
+            !board.has_piece<COLOR, PieceType::ROOK>(rook_src) ||
+            board.in_check<COLOR>() ||
+            board.is_attacked_by<other(COLOR)>(rook_dst) ||
+            board.is_attacked_by<other(COLOR)>(dst)) {
+            return false;
+        }
+        for (std::uint64_t square = std::min(src, rook_src) + 1;
+             square < std::max(src, rook_src); ++square) {
+            if (board.is_occupied(square)) { return false; }
+        }
+        next = next.template after_move<COLOR>(
+            {src, dst, PieceType::KING, PieceType::KING});
+        next = next.template after_move<COLOR>(
+            {rook_src, rook_dst, PieceType::ROOK, PieceType::ROOK});
+    } else if ((type == PieceType::PAWN) && !capture &&
+               (static_cast<int>(dst) == state.en_passant) &&
+               ((distance == 7) || (distance == 9))) {
+        const std::uint64_t captured =
+            (COLOR == PieceColor::WHITE) ? dst - 8 : dst + 8;
+        if (!board.has_piece<other(COLOR), PieceType::PAWN>(captured)) {
+            return false;
+        }
+        next = next.template after_move<COLOR>(
+            {src, dst, PieceType::PAWN, PieceType::PAWN});
+        next.clear_square(captured);
+        // Removing both pawns from the rank can expose the king.
+        if (next.in_check<COLOR>()) { return false; }
+    } else {
+        MoveList moves{};
+        generate_legal_moves<COLOR>(board, moves);
+        bool found = false;
+        for (const ChessMove &move : moves) {
+            if ((move.src == src) && (move.dst == dst) &&
+                (move.dst_type == promotion)) {
+                next = board.after_move<COLOR>(move);
+                found = true;
+                break;
+            }
+        }
+        if (!found) { return false; }
+    }
+
+    board = next;
+    state.side_to_move = other(COLOR);
+    state.castling_rights =
+        possible_castling_rights(board, state.castling_rights);
+    state.en_passant = ((type == PieceType::PAWN) && (distance == 16))
+        ? static_cast<int>((src + dst) / 2) : NO_EN_PASSANT;
+    state.halfmove_clock = ((type == PieceType::PAWN) || capture)
+        ? 0 : state.halfmove_clock + 1;
+    if (COLOR == PieceColor::BLACK) { ++state.fullmove_number; }
+    return true;
+}
+
+
+inline bool play_uci_move(ChessBoard &board, PositionState &state,
+                          std::string_view text) {
+    return (state.side_to_move == PieceColor::WHITE)
+        ? play_uci_move<PieceColor::WHITE>(board, state, text)
+        : play_uci_move<PieceColor::BLACK>(board, state, text);
+}
+
+
+struct UCIGoParameters {
+    int depth = MAX_PLY - 1;
+    std::uint64_t nodes = 0;
+    long long movetime = 0;
+    long long time[2] = {0, 0};
+    long long increment[2] = {0, 0};
+    int movestogo = 0;
+    bool infinite = false;
+    bool ponder = false;
+};
+
+
+// Time to spend on one move, in milliseconds, or zero for no limit.
+constexpr long long allocate_time(const UCIGoParameters &go,
+                                  PieceColor side) noexcept {
+    // Reserved for reading input and writing output around each search.
+    constexpr long long OVERHEAD = 20;
+    if (go.movetime > 0) { return std::max(go.movetime - OVERHEAD, 1LL); }
+    const long long remaining = go.time[static_cast<std::size_t>(side)];
+    if (remaining <= 0) { return 0; }
+    const long long increment =
+        go.increment[static_cast<std::size_t>(side)];
+    const long long moves = (go.movestogo > 0) ? go.movestogo : 30;
+    const long long budget = remaining / moves + 3 * increment / 4;
+    return std::max(std::min(budget, remaining / 2 - OVERHEAD), 1LL);
+}
+
+
+// Universal Chess Interface front end. Input is read on the calling
+// thread while searches run on a separate one, so that stop, ponderhit
+// and isready are answered at once. The search thread runs the main
+// searcher, whose iterations are reported, and Threads - 1 helpers that
+// search the same position and share the transposition table with it
+// (lazy SMP). A timer thread turns the time limit into the same stop flag
+// that the stop command sets, so that ponderhit can start the clock.
+class UCIEngine {
+
+    ChessBoard board;
+    PositionState state;
+    std::vector<std::uint64_t> history; // keys of the earlier positions
+    SearchOptions options;
+    TranspositionTable table;
+    EvaluationCache cache;
+    Tablebases tablebases;
+    std::size_t threads;
+    std::size_t multipv;
+
+    std::mutex output_mutex;
+    std::thread search_thread;
+    std::atomic<bool> stop;
+
+    // Guarded by timer_mutex.
+    std::mutex timer_mutex;
+    std::condition_variable timer_signal;
+    std::chrono::steady_clock::time_point deadline;
+    long long budget;
+    bool pondering;
+    bool infinite;
+    bool stop_requested;
+    bool search_finished;
+
+    void send(const std::string &line) {
+        std::lock_guard<std::mutex> lock{output_mutex};
+        std::cout << line << std::endl;
+    }
+
+    static std::string score_text(int score) {
+        if (score >= MATE_BOUND) {
+            return "mate " + std::to_string((MATE_SCORE - score + 1) / 2);
+        } else if (score <= -MATE_BOUND) {
+            return "mate -" + std::to_string((MATE_SCORE + score) / 2);
+        }
+        return "cp " + std::to_string(score);
+    }
+
+    void run_timer() {
+        std::unique_lock<std::mutex> lock{timer_mutex};
+        while (!search_finished) {
+            if (!pondering &&
+                (std::chrono::steady_clock::now() >= deadline)) {
+                stop = true;
+                return;
+            }
+            if (pondering ||
+                (deadline == std::chrono::steady_clock::time_point::max())) {
+                timer_signal.wait(lock);
+            } else {
+                timer_signal.wait_until(lock, deadline);
+            }
+        }
+    }
+
+    template <template <PieceColor, int> typename Visitor, PieceColor COLOR>
+    void run_search(const ChessBoard &root, const UCIGoParameters &go) {
+        using SearcherType = Searcher<Visitor>;
+        const auto start = std::chrono::steady_clock::now();
+
+        std::vector<std::unique_ptr<SearcherType>> helpers{};
+        std::vector<std::thread> helper_threads{};
+        for (std::size_t i = 1; i < threads; ++i) {
+            helpers.push_back(std::make_unique<SearcherType>());
+            SearcherType &helper = *helpers.back();
+            helper.options = options;
+            helper.limits.stop = &stop;
+            helper.evaluation_cache = &cache;
+            helper.transposition_table = &table;
+            helper.tablebases = &tablebases;
+            helper.game_history = history;
+            helper.halfmove_clock = static_cast<int>(state.halfmove_clock);
+            helper_threads.emplace_back([&helper, &root, &go] {
+                helper.template search_root<COLOR>(root, go.depth);
+            });
+        }
+
+        auto searcher = std::make_unique<SearcherType>();
+        searcher->options = options;
+        searcher->limits.nodes = go.nodes;
+        searcher->limits.stop = &stop;
+        searcher->evaluation_cache = &cache;
+        searcher->transposition_table = &table;
+        searcher->tablebases = &tablebases;
+        searcher->game_history = history;
+        searcher->halfmove_clock = static_cast<int>(state.halfmove_clock);
+        const std::vector<SearchResult> lines =
+            searcher->template search_lines<COLOR>(
+            root, go.depth, multipv,
+            [&](const std::vector<SearchResult> &iteration) {
+                const auto now = std::chrono::steady_clock::now();
+                const auto elapsed = std::chrono::duration_cast<
+                    std::chrono::milliseconds>(now - start).count();
+                const SearchStatistics &stats = searcher->statistics;
+                const std::uint64_t nodes =
+                    stats.nodes + stats.quiescence_nodes;
+                for (std::size_t i = 0; i < iteration.size(); ++i) {
+                    const int score = (COLOR == PieceColor::WHITE)
+                        ? iteration[i].score : -iteration[i].score;
+                    std::ostringstream line{};
+                    line << "info depth " << iteration[i].depth
+                         << " multipv " << i + 1
+                         << " score " << score_text(score)
+                         << " nodes " << nodes
+                         << " nps " << (1000 * nodes) /
+                            static_cast<std::uint64_t>(elapsed + 1)
+                         << " time " << elapsed
+                         << " hashfull " << table.permille_full() << " pv";
+                    for (const ChessMove &move :
+                         iteration[i].principal_variation) {
+                        line << ' ' << uci_move_name(move);
+                    }
+                    send(line.str());
+                }
+            }
+        );
+        const SearchResult &result = lines.front();
+        stop = true;
+        for (std::thread &helper : helper_threads) { helper.join(); }
+
+        // A search that ends by itself while pondering or in infinite mode
+        // must hold its move until the GUI asks for it.
+        {
+            std::unique_lock<std::mutex> lock{timer_mutex};
+            timer_signal.wait(lock, [this] {
+                return stop_requested || (!pondering && !infinite);
+            });
+            search_finished = true;
+        }
+        timer_signal.notify_all();
+
+        MoveList moves{};
+        generate_legal_moves<COLOR>(root, moves);
+        if (moves.empty()) {
+            send("bestmove 0000");
+        } else if (result.principal_variation.size() >= 2) {
+            send("bestmove " + uci_move_name(result.best_move) + " ponder " +
+                 uci_move_name(result.principal_variation[1]));
+        } else {
+            send("bestmove " + uci_move_name(result.best_move));
+        }
+    }
+
+    template <PieceColor COLOR>
+    void run_search(const ChessBoard &root, const UCIGoParameters &go) {
+        std::thread timer{[this] { run_timer(); }};
+        if (active_nnue_network()) {
+            run_search<NNUEEvaluationVisitor, COLOR>(root, go);
+        } else {
+            run_search<PositionalEvaluationVisitor, COLOR>(root, go);
+        }
+        timer.join();
+    }
+
+    void stop_search() {
+        if (!search_thread.joinable()) { return; }
+        {
+            std::lock_guard<std::mutex> lock{timer_mutex};
+            stop_requested = true;
+            pondering = false;
+        }
+        stop = true;
+        timer_signal.notify_all();
+        search_thread.join();
+    }
+
+    void handle_go(std::istringstream &input) {
+        stop_search();
+        UCIGoParameters go{};
+        std::string token;
+        while (input >> token) {
+            if (token == "depth") {
+                input >> go.depth;
+                go.depth = std::clamp(go.depth, 1, MAX_PLY - 1);
+            } else if (token == "nodes") {
+                input >> go.nodes;
+            } else if (token == "movetime") {
+                input >> go.movetime;
+            } else if (token == "wtime") {
+                input >> go.time[0];
+            } else if (token == "btime") {
+                input >> go.time[1];
+            } else if (token == "winc") {
+                input >> go.increment[0];
+            } else if (token == "binc") {
+                input >> go.increment[1];
+            } else if (token == "movestogo") {
+                input >> go.movestogo;
+            } else if (token == "infinite") {
+                go.infinite = true;
+            } else if (token == "ponder") {
+                go.ponder = true;
+            }
+        }
+
+        const PieceColor side = state.side_to_move;
+        budget = allocate_time(go, side);
+        deadline = (budget > 0)
+            ? std::chrono::steady_clock::now() +
+              std::chrono::milliseconds{budget}
+            : std::chrono::steady_clock::time_point::max();
+        pondering = go.ponder;
+        infinite = go.infinite;
+        stop_requested = false;
+        search_finished = false;
+        stop = false;
+        search_thread = std::thread{[this, go, side, root = board] {
+            if (side == PieceColor::WHITE) {
+                run_search<PieceColor::WHITE>(root, go);
+            } else {
+                run_search<PieceColor::BLACK>(root, go);
+            }
+        }};
+    }
+
+    void handle_ponderhit() {
+        {
+            std::lock_guard<std::mutex> lock{timer_mutex};
+            if (!pondering) { return; }
+            pondering = false;
+            if (budget > 0) {
+                deadline = std::chrono::steady_clock::now() +
+                           std::chrono::milliseconds{budget};
+            }
+        }
+        timer_signal.notify_all();
+    }
+
+    void handle_position(std::istringstream &input) {
+        std::string token;
+        input >> token;
+        ChessBoard next{};
+        PositionState next_state{};
+        std::vector<std::uint64_t> next_history{};
+        if (token == "fen") {
+            std::string fen;
+            while ((input >> token) && (token != "moves")) {
+                if (!fen.empty()) { fen += ' '; }
+                fen += token;
+            }
+            if (!parse_fen(fen, next, next_state)) {
+                send("info string invalid FEN " + fen);
+                return;
+            }
+        } else if (token == "startpos") {
+            input >> token;
+        } else {
+            send("info string invalid position command");
+            return;
+        }
+        if (token == "moves") {
+            while (input >> token) {
+                next_history.push_back(
+                    position_key(next, next_state.side_to_move));
+                if (!play_uci_move(next, next_state, token)) {
+                    send("info string illegal move " + token);
+                    return;
+                }
+            }
+        }
+        board = next;
+        state = next_state;
+        history = std::move(next_history);
+    }
+
+    void handle_setoption(std::istringstream &input) {
+        std::string token;
+        std::string name;
+        std::string value;
+        input >> token; // "name"
+        while ((input >> token) && (token != "value")) {
+            name += (name.empty() ? "" : " ") + token;
+        }
+        input >> value;
+        // Numeric options ignore values that are missing or not numbers.
+        long long number = 0;
+        const char *end = value.data() + value.size();
+        const auto [last, error] =
+            std::from_chars(value.data(), end, number);
+        const bool numeric = (error == std::errc{}) && (last == end);
+        if (((name == "Hash") || (name == "Threads") ||
+             (name == "MultiPV")) && !numeric) {
+            send("info string invalid value for " + name);
+        } else if (name == "Hash") {
+            table.resize(static_cast<std::size_t>(
+                std::clamp(number, 1LL, 65536LL)));
+        } else if (name == "Threads") {
+            threads = static_cast<std::size_t>(
+                std::clamp(number, 1LL, 256LL));
+        } else if (name == "MultiPV") {
+            multipv = static_cast<std::size_t>(
+                std::clamp(number, 1LL, 256LL));
+        } else if (name == "TablebasePath") {
+            // Tables are only ever added, so replace the whole set.
+            tablebases = Tablebases{};
+            table.clear();
+            if (!value.empty() && (value != "<empty>")) {
+                const std::size_t count = tablebases.load_directory(value);
+                send("info string loaded " + std::to_string(count) +
+                     " tablebases from " + value);
+            }
+        } else if (name == "Ponder") {
+            // Pondering needs no preparation.
+        } else {
+            send("info string unknown option " + name);
+        }
+    }
+
+public:
+
+    explicit UCIEngine() :
+        board(), state(), history(), options(), table(16), cache(18),
+        tablebases(), threads(1), multipv(1), output_mutex(),
+        search_thread(), stop(false), timer_mutex(), timer_signal(),
+        deadline(), budget(0),
+        pondering(false), infinite(false), stop_requested(false),
+        search_finished(true) {}
+
+    UCIEngine(const UCIEngine &) = delete;
+    UCIEngine &operator=(const UCIEngine &) = delete;
+
+    ~UCIEngine() { stop_search(); }
+
+    // Reads commands from standard input until quit or end of input.
+    void run() {
+        send("id name DZChess");
+        send("id author David K. Zhang");
+        send("option name Hash type spin default 16 min 1 max 65536");
+        send("option name Threads type spin default 1 min 1 max 256");
+        send("option name Ponder type check default false");
+        send("option name MultiPV type spin default 1 min 1 max 256");
+        send("option name TablebasePath type string default <empty>");
+        send("uciok");
+        std::string line;
+        while (std::getline(std::cin, line)) {
+            std::istringstream input{line};
+            std::string command;
+            input >> command;
+            if (command == "isready") {
+                send("readyok");
+            } else if (command == "ucinewgame") {
+                stop_search();
+                table.clear();
+            } else if (command == "position") {
+                stop_search();
+                handle_position(input);
+            } else if (command == "go") {
+                handle_go(input);
+            } else if (command == "stop") {
+                stop_search();
+            } else if (command == "ponderhit") {
+                handle_ponderhit();
+            } else if (command == "setoption") {
+                stop_search();
+                handle_setoption(input);
+            } else if (command == "quit") {
+                break;
+            } else if (!command.empty() && (command != "uci")) {
+                send("info string unknown command " + command);
+            }
+        }
+        stop_search();
+    }
+
+}; // class UCIEngine
+
+
+} // namespace DZChess
+
+#endif // DZCHESS_UCI_HPP_INCLUDED
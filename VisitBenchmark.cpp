@@ -0,0 +1,146 @@
+#include <chrono>   // for std::chrono::steady_clock
+#include <cstddef>  // for std::size_t
+#include <cstdint>  // for std::uint64_t
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ChessPiece.hpp"
+#include "ChessBoard.hpp"
+#include "Evaluation.hpp"
+#include "RandomGames.hpp"
+#include "Visitors.hpp"
+
+
+using namespace DZChess;
+
+
+constexpr int DEPTH = 4;
+
+
+template <typename Function>
+std::uint64_t benchmark(const std::string &name, std::uint64_t leaves,
+                        Function f) {
+    const auto start = std::chrono::steady_clock::now();
+    const std::uint64_t checksum = f();
+    const auto stop = std::chrono::steady_clock::now();
+    const double seconds = std::chrono::duration<double>(stop - start).count();
+    std::cout << "    " << name << ": "
+              << static_cast<double>(leaves) / seconds << " leaves/s"
+              << " (checksum " << checksum << ")" << std::endl;
+    return checksum;
+}
+
+
+template <template <PieceColor, int> typename Visitor>
+std::uint64_t template_depth(const ChessBoard &board, PieceColor color) {
+    return static_cast<std::uint64_t>((color == PieceColor::WHITE)
+        ? board.visit<Visitor, PieceColor::WHITE, DEPTH>()
+        : board.visit<Visitor, PieceColor::BLACK, DEPTH>());
+}
+
+
+template <template <PieceColor, int> typename Visitor>
+std::uint64_t runtime_depth(const ChessBoard &board, PieceColor color) {
+    return static_cast<std::uint64_t>((color == PieceColor::WHITE)
+        ? board.visit_to_depth<Visitor, PieceColor::WHITE>(DEPTH)
+        : board.visit_to_depth<Visitor, PieceColor::BLACK>(DEPTH));
+}
+
+
+// The flipped traversal scores from the side to move; this converts to
+// white's point of view, like the other traversals.
+template <template <PieceColor, int> typename Visitor>
+std::uint64_t flipped(const ChessBoard &board, PieceColor color) {
+    return static_cast<std::uint64_t>((color == PieceColor::WHITE)
+        ? board.visit_flipped<Visitor>(DEPTH)
+        : -board.flipped().visit_flipped<Visitor>(DEPTH));
+}
+
+
+int main() {
+
+    const std::size_t count = 40;
+    const auto positions = random_game_positions(count, 4);
+    std::uint64_t leaves = 0;
+    for (const auto &[board, color] : positions) {
+        leaves += template_depth<LeafCountVisitor>(board, color);
+    }
+    std::cout << count << " positions, depth " << DEPTH << ", "
+              << leaves << " leaves" << std::endl;
+
+    std::uint64_t mismatches = 0;
+    for (const std::string name : {"leaf count", "materialistic"}) {
+        const bool counting = (name == "leaf count");
+        std::cout << name << ":" << std::endl;
+        const std::uint64_t expected = benchmark("template", leaves, [&]() {
+            std::uint64_t checksum = 0;
+            for (const auto &[board, color] : positions) {
+                checksum += counting
+                    ? template_depth<LeafCountVisitor>(board, color)
+                    : template_depth<MaterialisticEvaluationVisitor>(
+                          board, color);
+            }
+            return checksum;
+        });
+        mismatches += expected != benchmark("runtime", leaves, [&]() {
+            std::uint64_t checksum = 0;
+            for (const auto &[board, color] : positions) {
+                checksum += counting
+                    ? runtime_depth<LeafCountVisitor>(board, color)
+                    : runtime_depth<MaterialisticEvaluationVisitor>(
+                          board, color);
+            }
+            return checksum;
+        });
+    }
+
+    // Negating leaf counts would be meaningless, so only the evaluation is
+    // timed with the side to move always white.
+    std::cout << "materialistic, color-flipped:" << std::endl;
+    mismatches += benchmark("template", leaves, [&]() {
+        std::uint64_t checksum = 0;
+        for (const auto &[board, color] : positions) {
+            checksum += template_depth<MaterialisticEvaluationVisitor>(
+                board, color);
+        }
+        return checksum;
+    }) != benchmark("flipped", leaves, [&]() {
+        std::uint64_t checksum = 0;
+        for (const auto &[board, color] : positions) {
+            checksum += flipped<MaterialisticEvaluationVisitor>(board, color);
+        }
+        return checksum;
+    });
+
+    // Evaluation and perft counts in two traversals and in one.
+    using Fused = CompositeVisitor<
+        MaterialisticEvaluationVisitor, LeafCountVisitor>;
+    std::cout << "materialistic and leaf count:" << std::endl;
+    mismatches += benchmark("separate", leaves, [&]() {
+        std::uint64_t checksum = 0;
+        for (const auto &[board, color] : positions) {
+            checksum += template_depth<MaterialisticEvaluationVisitor>(
+                board, color);
+            checksum += template_depth<LeafCountVisitor>(board, color);
+        }
+        return checksum;
+    }) != benchmark("composite", leaves, [&]() {
+        std::uint64_t checksum = 0;
+        for (const auto &[board, color] : positions) {
+            const auto [score, count] = (color == PieceColor::WHITE)
+                ? board.visit<Fused::Visitor, PieceColor::WHITE, DEPTH>()
+                : board.visit<Fused::Visitor, PieceColor::BLACK, DEPTH>();
+            checksum += static_cast<std::uint64_t>(score) + count;
+        }
+        return checksum;
+    });
+
+    if (mismatches == 0) {
+        std::cout << "All traversals agree." << std::endl;
+    } else {
+        std::cout << "ERROR: the traversals disagree." << std::endl;
+        return 1;
+    }
+
+}
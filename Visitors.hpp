@@ -0,0 +1,110 @@
+#ifndef DZCHESS_VISITORS_HPP_INCLUDED
+#define DZCHESS_VISITORS_HPP_INCLUDED
+
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::uint64_t
+#include <tuple>   // for std::tuple, std::get
+#include <utility> // for std::index_sequence, std::index_sequence_for
+
+#include "ChessPiece.hpp"
+#include "ChessBoard.hpp"
+
+namespace DZChess {
+
+
+// Counts the leaves of the pseudo-legal move tree (perft, without the
+// legality filter).
+template <PieceColor COLOR, int DEPTH>
+struct LeafCountVisitor {
+
+    std::uint64_t count;
+
+    using result_type = std::uint64_t;
+
+    static constexpr result_type visit(const ChessBoard &) noexcept {
+        return 1;
+    }
+
+    explicit constexpr LeafCountVisitor() noexcept : count(0) {}
+
+    template <PieceType TYPE>
+    constexpr void visit(const ChessBoard &, const ChessBoard &,
+                         std::uint64_t, std::uint64_t,
+                         result_type result) noexcept {
+        count += result;
+    }
+
+    template <PieceType TYPE>
+    constexpr void visit_promotion(const ChessBoard &, const ChessBoard &,
+                                   std::uint64_t, std::uint64_t,
+                                   result_type result) noexcept {
+        count += result;
+    }
+
+    constexpr result_type get_result() const noexcept { return count; }
+
+}; // struct LeafCountVisitor
+
+
+// Runs several visitors in one traversal. Each node holds one instance of
+// every visitor, forwards each callback to all of them with their own
+// component of the child's result, and returns a tuple of their results:
+//
+//     const auto [score, leaves] = board.visit<CompositeVisitor<
+//         MaterialisticEvaluationVisitor, LeafCountVisitor
+//     >::Visitor, PieceColor::WHITE, 5>();
+//
+// The fold expressions and tuples compile away, so a fused traversal costs
+// one tree walk plus the callbacks of each visitor.
+template <template <PieceColor, int> typename... Visitors>
+struct CompositeVisitor {
+
+    template <PieceColor COLOR, int DEPTH>
+    struct Visitor {
+
+        std::tuple<Visitors<COLOR, DEPTH>...> visitors;
+
+        using result_type =
+            std::tuple<typename Visitors<COLOR, DEPTH>::result_type...>;
+
+        static constexpr result_type visit(const ChessBoard &b) noexcept {
+            return result_type{Visitors<COLOR, DEPTH>::visit(b)...};
+        }
+
+        explicit constexpr Visitor() noexcept : visitors() {}
+
+        template <PieceType TYPE>
+        constexpr void visit(const ChessBoard &current, const ChessBoard &next,
+                             std::uint64_t src, std::uint64_t dst,
+                             const result_type &result) noexcept {
+            [&]<std::size_t... I>(std::index_sequence<I...>) {
+                (std::get<I>(visitors).template visit<TYPE>(
+                     current, next, src, dst, std::get<I>(result)), ...);
+            }(std::index_sequence_for<Visitors<COLOR, DEPTH>...>{});
+        }
+
+        template <PieceType TYPE>
+        constexpr void visit_promotion(const ChessBoard &current,
+                                       const ChessBoard &next,
+                                       std::uint64_t src, std::uint64_t dst,
+                                       const result_type &result) noexcept {
+            [&]<std::size_t... I>(std::index_sequence<I...>) {
+                (std::get<I>(visitors).template visit_promotion<TYPE>(
+                     current, next, src, dst, std::get<I>(result)), ...);
+            }(std::index_sequence_for<Visitors<COLOR, DEPTH>...>{});
+        }
+
+        constexpr result_type get_result() const noexcept {
+            return [&]<std::size_t... I>(std::index_sequence<I...>) {
+                return result_type{std::get<I>(visitors).get_result()...};
+            }(std::index_sequence_for<Visitors<COLOR, DEPTH>...>{});
+        }
+
+    }; // struct Visitor
+
+}; // struct CompositeVisitor
+
+
+} // namespace DZChess
+
+#endif // DZCHESS_VISITORS_HPP_INCLUDED
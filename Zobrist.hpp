@@ -0,0 +1,64 @@
+#ifndef DZCHESS_ZOBRIST_HPP_INCLUDED
+#define DZCHESS_ZOBRIST_HPP_INCLUDED
+
+#include <array>   // for std::array
+#include <bit>     // for std::rotl
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::uint64_t, UINT64_C
+
+#include "ChessPiece.hpp"
+
+namespace DZChess {
+
+
+struct ZobristKeys {
+    std::array<std::array<std::array<std::uint64_t, 64>, 6>, 2> pieces;
+    std::uint64_t black_to_move;
+};
+
+
+// Keys are generated at compile time by splitmix64 from a fixed seed, so
+// hashes are reproducible across runs and builds. Only the white keys are
+// random: the key of a black piece is the key of a white piece of the same
+// type on the mirrored square, rotated by 32 bits. Swapping colors and
+// mirroring the board therefore rotates the hash by 32 bits, so the hash of
+// a color-flipped board is available without recomputing it.
+constexpr ZobristKeys make_zobrist_keys() noexcept {
+    ZobristKeys result{};
+    std::uint64_t state = UINT64_C(0x2545F4914F6CDD1D);
+    const auto next = [&state]() {
+        state += UINT64_C(0x9E3779B97F4A7C15);
+        std::uint64_t z = state;
+        z = (z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+        z = (z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB);
+        return z ^ (z >> 31);
+    };
+    auto &white = result.pieces[static_cast<std::size_t>(PieceColor::WHITE)];
+    auto &black = result.pieces[static_cast<std::size_t>(PieceColor::BLACK)];
+    for (auto &type : white) {
+        for (auto &key : type) { key = next(); }
+    }
+    for (std::size_t type = 0; type < 6; ++type) {
+        for (std::size_t square = 0; square < 64; ++square) {
+            black[type][square] = std::rotl(white[type][square ^ 56], 32);
+        }
+    }
+    result.black_to_move = next();
+    return result;
+}
+
+
+constexpr ZobristKeys ZOBRIST_KEYS = make_zobrist_keys();
+
+
+template <PieceColor COLOR>
+constexpr std::uint64_t zobrist_key(PieceType type,
+                                    std::uint64_t square) noexcept {
+    return ZOBRIST_KEYS.pieces[static_cast<std::size_t>(COLOR)]
+                              [static_cast<std::size_t>(type)][square];
+}
+
+
+} // namespace DZChess
+
+#endif // DZCHESS_ZOBRIST_HPP_INCLUDED